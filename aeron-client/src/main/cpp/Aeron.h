@@ -131,6 +131,44 @@ public:
         return m_conductor.findPublication(registrationId);
     }
 
+    /**
+     * Add a {@link Publication} and be called back when the media driver has answered.
+     *
+     * This function returns immediately. The handler is called on the client conductor thread with the Publication,
+     * or with the error that Aeron::findPublication would have thrown, so there is no need to poll for the result.
+     *
+     * @param channel      for sending the messages known to the media layer.
+     * @param streamId     within the channel scope.
+     * @param onRegistered called once when the add completes or fails.
+     * @return registration id for the publication
+     */
+    inline std::int64_t asyncAddPublication(
+        const std::string& channel, std::int32_t streamId, const on_publication_registered_t& onRegistered)
+    {
+        return m_conductor.addPublication(channel, streamId, onRegistered);
+    }
+
+    /**
+     * Add many {@link Publication}s without waiting for any response from the media driver.
+     *
+     * All the commands are sent before any answer is awaited, so the cost is one round trip to the media driver
+     * rather than one per publication. The handler is called once for each publication. With
+     * Context::useCommandBatching the commands are also packed into as few messages to the media driver as fit.
+     *
+     * If the media driver's command buffer fills up part way this throws. The handler is still called for each
+     * publication whose command had already been sent, and not for the others.
+     *
+     * @param channelStreams pairs of channel and stream id to add.
+     * @param onRegistered   called once for each publication when its add completes or fails.
+     * @return registration ids for the publications in the order given.
+     */
+    inline std::vector<std::int64_t> asyncAddPublications(
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        const on_publication_registered_t& onRegistered)
+    {
+        return m_conductor.addPublications(channelStreams, onRegistered);
+    }
+
     /**
      * Add an {@link ExclusivePublication} for publishing messages to subscribers from a single thread.
      *
@@ -165,6 +203,38 @@ public:
         return m_conductor.findExclusivePublication(registrationId);
     }
 
+    /**
+     * Add an {@link ExclusivePublication} and be called back when the media driver has answered.
+     *
+     * @see Aeron::asyncAddPublication
+     *
+     * @param channel      for sending the messages known to the media layer.
+     * @param streamId     within the channel scope.
+     * @param onRegistered called once when the add completes or fails.
+     * @return registration id for the publication
+     */
+    inline std::int64_t asyncAddExclusivePublication(
+        const std::string& channel, std::int32_t streamId, const on_exclusive_publication_registered_t& onRegistered)
+    {
+        return m_conductor.addExclusivePublication(channel, streamId, onRegistered);
+    }
+
+    /**
+     * Add many {@link ExclusivePublication}s without waiting for any response from the media driver.
+     *
+     * @see Aeron::asyncAddPublications
+     *
+     * @param channelStreams pairs of channel and stream id to add.
+     * @param onRegistered   called once for each publication when its add completes or fails.
+     * @return registration ids for the publications in the order given.
+     */
+    inline std::vector<std::int64_t> asyncAddExclusivePublications(
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        const on_exclusive_publication_registered_t& onRegistered)
+    {
+        return m_conductor.addExclusivePublications(channelStreams, onRegistered);
+    }
+
     /**
      * Add a new {@link Subscription} for subscribing to messages from publishers.
      *
@@ -223,6 +293,71 @@ public:
         return m_conductor.findSubscription(registrationId);
     }
 
+    /**
+     * Add a {@link Subscription} and be called back when the media driver has answered.
+     *
+     * The image handlers from the {@link Context} are used.
+     *
+     * @see Aeron::asyncAddPublication
+     *
+     * @param channel      for receiving the messages known to the media layer.
+     * @param streamId     within the channel scope.
+     * @param onRegistered called once when the add completes or fails.
+     * @return registration id for the subscription
+     */
+    inline std::int64_t asyncAddSubscription(
+        const std::string& channel, std::int32_t streamId, const on_subscription_registered_t& onRegistered)
+    {
+        return m_conductor.addSubscription(
+            channel,
+            streamId,
+            m_context.m_onAvailableImageHandler,
+            m_context.m_onUnavailableImageHandler,
+            onRegistered);
+    }
+
+    /**
+     * Add a {@link Subscription} with its own image handlers and be called back when the media driver has answered.
+     *
+     * @see Aeron::asyncAddPublication
+     *
+     * @param channel                   for receiving the messages known to the media layer.
+     * @param streamId                  within the channel scope.
+     * @param onAvailableImageHandler   called when {@link Image}s become available for consumption.
+     * @param onUnavailableImageHandler called when {@link Image}s go unavailable for consumption.
+     * @param onRegistered              called once when the add completes or fails.
+     * @return registration id for the subscription
+     */
+    inline std::int64_t asyncAddSubscription(
+        const std::string& channel,
+        std::int32_t streamId,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler,
+        const on_subscription_registered_t& onRegistered)
+    {
+        return m_conductor.addSubscription(
+            channel, streamId, onAvailableImageHandler, onUnavailableImageHandler, onRegistered);
+    }
+
+    /**
+     * Add many {@link Subscription}s without waiting for any response from the media driver.
+     *
+     * The image handlers from the {@link Context} are used.
+     *
+     * @see Aeron::asyncAddPublications
+     *
+     * @param channelStreams pairs of channel and stream id to add.
+     * @param onRegistered   called once for each subscription when its add completes or fails.
+     * @return registration ids for the subscriptions in the order given.
+     */
+    inline std::vector<std::int64_t> asyncAddSubscriptions(
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        const on_subscription_registered_t& onRegistered)
+    {
+        return m_conductor.addSubscriptions(
+            channelStreams, m_context.m_onAvailableImageHandler, m_context.m_onUnavailableImageHandler, onRegistered);
+    }
+
     /**
      * Generate the next correlation id that is unique for the connected Media Driver.
      *
@@ -279,6 +414,28 @@ public:
         return m_conductor.findCounter(registrationId);
     }
 
+    /**
+     * Allocate a counter on the media driver and be called back with the {@link Counter} when it is available.
+     *
+     * @see Aeron::asyncAddPublication
+     *
+     * @param typeId       for the counter.
+     * @param keyBuffer    containing the optional key for the counter.
+     * @param keyLength    of the key in the keyBuffer.
+     * @param label        for the counter.
+     * @param onRegistered called once when the add completes or fails.
+     * @return registration id for the Counter
+     */
+    inline std::int64_t asyncAddCounter(
+        std::int32_t typeId,
+        const std::uint8_t *keyBuffer,
+        std::size_t keyLength,
+        const std::string& label,
+        const on_counter_registered_t& onRegistered)
+    {
+        return m_conductor.addCounter(typeId, keyBuffer, keyLength, label, onRegistered);
+    }
+
     /**
      * Add a handler to the list to be called when a counter becomes available.
      *
@@ -292,6 +449,9 @@ public:
     /**
      * Remove a handler from the list to be called when a counter becomes available.
      *
+     * The handler will not be called for notifications dispatched after this method has returned. A notification
+     * already being dispatched on the conductor thread may still call it.
+     *
      * @param handler to be removed from the available counters list.
      */
     inline void removeAvailableCounterHandler(const on_available_counter_t& handler)
@@ -312,6 +472,9 @@ public:
     /**
      * Remove a handler from the list to be called when a counter becomes unavailable.
      *
+     * The handler will not be called for notifications dispatched after this method has returned. A notification
+     * already being dispatched on the conductor thread may still call it.
+     *
      * @param handler to be removed from the unavailable counters list.
      */
     inline void removeUnavailableCounterHandler(const on_unavailable_counter_t& handler)
@@ -0,0 +1,307 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARENA_FRAGMENT_ASSEMBLER_H
+#define AERON_ARENA_FRAGMENT_ASSEMBLER_H
+
+#include <vector>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "Aeron.h"
+
+namespace aeron {
+
+static const std::size_t DEFAULT_ARENA_FRAGMENT_ASSEMBLY_MAX_SESSIONS = 16;
+
+/**
+ * A handler that sits in a chain-of-responsibility pattern that reassembles fragmented messages
+ * so that the next handler in the chain only sees whole messages, without allocating once constructed.
+ * <p>
+ * Unfragmented messages are delegated without copy. Fragmented messages are copied for reassembly into a slot of an
+ * arena of maxSessions slots of maxMessageLength, allocated up front. Sessions are mapped to slots by an
+ * open-addressing table when their first fragment arrives and keep the slot until evicted with
+ * {@link #deleteSessionBuffer(std::int32_t)}, which should be called when the Image goes unavailable, see
+ * {@link on_unavailable_image_t}.
+ * <p>
+ * A message longer than maxMessageLength, or the first fragment of a session when all slots are in use, results in an
+ * IllegalStateException for the poll exception handler and the rest of that message is dropped.
+ *
+ * @tparam H type of the delegate onto which whole messages are forwarded.
+ */
+template <typename H>
+class BasicArenaFragmentAssembler
+{
+public:
+
+    /**
+     * Construct an adapter to reassemble message fragments and delegate on only whole messages.
+     *
+     * @param delegate         onto which whole messages are forwarded.
+     * @param maxMessageLength of a reassembled message for any one session.
+     * @param maxSessions      which may be reassembling messages at the same time, must be greater than 0.
+     * @throws util::IllegalArgumentException if maxSessions is 0.
+     */
+    BasicArenaFragmentAssembler(
+        const H& delegate,
+        std::uint32_t maxMessageLength,
+        std::size_t maxSessions = DEFAULT_ARENA_FRAGMENT_ASSEMBLY_MAX_SESSIONS) :
+        m_delegate(delegate),
+        m_slotLength(util::BitUtil::align(
+            maxMessageLength + static_cast<std::uint32_t>(DataFrameHeader::LENGTH),
+            static_cast<std::uint32_t>(FrameDescriptor::FRAME_ALIGNMENT))),
+        m_maxSessions(checkMaxSessions(maxSessions)),
+        m_arena(new std::uint8_t[m_slotLength * maxSessions]),
+        m_sessions(util::BitUtil::findNextPowerOfTwo(static_cast<std::uint32_t>(maxSessions * 2))),
+        m_mask(static_cast<std::uint32_t>(m_sessions.size() - 1))
+    {
+        m_freeSlots.reserve(maxSessions);
+        for (std::size_t i = maxSessions; i > 0; i--)
+        {
+            m_freeSlots.push_back(static_cast<std::int32_t>(i - 1));
+        }
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls the this assembler instance for reassembly. Suitable for
+     * passing to Subscription::poll(fragment_handler_t, int).
+     *
+     * @return fragment_handler_t composed with the assembler instance
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            this->onFragment(buffer, offset, length, header);
+        };
+    }
+
+    /**
+     * Reassemble a fragment and delegate on whole messages. Allows the assembler to be passed by reference to
+     * Subscription::poll or Image::poll in place of {@link #handler()}.
+     */
+    inline void operator()(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        onFragment(buffer, offset, length, header);
+    }
+
+    /**
+     * Evict a session and return its slot to the arena when an Image goes inactive.
+     *
+     * @param sessionId to have its buffer freed
+     */
+    void deleteSessionBuffer(std::int32_t sessionId)
+    {
+        const std::int32_t index = findSession(sessionId);
+
+        if (NULL_INDEX != index)
+        {
+            m_freeSlots.push_back(m_sessions[index].slot);
+            removeSessionAt(static_cast<std::uint32_t>(index));
+        }
+    }
+
+    /**
+     * Number of sessions holding a slot in the arena.
+     *
+     * @return number of sessions holding a slot in the arena.
+     */
+    inline std::size_t sessionCount() const
+    {
+        return m_maxSessions - m_freeSlots.size();
+    }
+
+private:
+    static const std::int32_t NULL_INDEX = -1;
+
+    struct SessionEntry
+    {
+        std::int32_t sessionId = 0;
+        std::int32_t slot = NULL_INDEX;
+        std::uint32_t limit = 0;
+    };
+
+    H m_delegate;
+    const std::uint32_t m_slotLength;
+    const std::size_t m_maxSessions;
+    std::unique_ptr<std::uint8_t[]> m_arena;
+    std::vector<SessionEntry> m_sessions;
+    std::vector<std::int32_t> m_freeSlots;
+    const std::uint32_t m_mask;
+
+    static std::size_t checkMaxSessions(std::size_t maxSessions)
+    {
+        if (0 == maxSessions)
+        {
+            throw util::IllegalArgumentException("maxSessions must be greater than 0", SOURCEINFO);
+        }
+
+        return maxSessions;
+    }
+
+    inline std::uint32_t hash(std::int32_t sessionId) const
+    {
+        const std::uint32_t h = static_cast<std::uint32_t>(sessionId) * 0x9E3779B9u;
+
+        return (h ^ (h >> 16)) & m_mask;
+    }
+
+    inline std::int32_t findSession(std::int32_t sessionId) const
+    {
+        for (std::uint32_t i = hash(sessionId); NULL_INDEX != m_sessions[i].slot; i = (i + 1) & m_mask)
+        {
+            if (m_sessions[i].sessionId == sessionId)
+            {
+                return static_cast<std::int32_t>(i);
+            }
+        }
+
+        return NULL_INDEX;
+    }
+
+    inline SessionEntry *addSession(std::int32_t sessionId)
+    {
+        if (m_freeSlots.empty())
+        {
+            throw util::IllegalStateException(
+                "no free reassembly slot for sessionId=" + std::to_string(sessionId) +
+                ", maxSessions=" + std::to_string(m_maxSessions), SOURCEINFO);
+        }
+
+        std::uint32_t i = hash(sessionId);
+        while (NULL_INDEX != m_sessions[i].slot)
+        {
+            i = (i + 1) & m_mask;
+        }
+
+        SessionEntry& entry = m_sessions[i];
+        entry.sessionId = sessionId;
+        entry.slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+
+        return &entry;
+    }
+
+    void removeSessionAt(std::uint32_t index)
+    {
+        std::uint32_t i = index;
+        std::uint32_t j = index;
+
+        while (true)
+        {
+            j = (j + 1) & m_mask;
+            if (NULL_INDEX == m_sessions[j].slot)
+            {
+                break;
+            }
+
+            const std::uint32_t k = hash(m_sessions[j].sessionId);
+            const bool isInPlace = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+            if (!isInPlace)
+            {
+                m_sessions[i] = m_sessions[j];
+                i = j;
+            }
+        }
+
+        m_sessions[i].slot = NULL_INDEX;
+    }
+
+    inline void append(
+        SessionEntry& entry, AtomicBuffer& buffer, util::index_t offset, util::index_t length, std::int32_t sessionId)
+    {
+        if (entry.limit + static_cast<std::uint32_t>(length) > m_slotLength)
+        {
+            entry.limit = static_cast<std::uint32_t>(DataFrameHeader::LENGTH);
+            throw util::IllegalStateException(
+                "message exceeds maxMessageLength of " +
+                std::to_string(m_slotLength - DataFrameHeader::LENGTH) + " for sessionId=" + std::to_string(sessionId),
+                SOURCEINFO);
+        }
+
+        std::uint8_t *slotBuffer = &m_arena[static_cast<std::size_t>(entry.slot) * m_slotLength];
+        ::memcpy(slotBuffer + entry.limit, buffer.buffer() + offset, static_cast<std::size_t>(length));
+        entry.limit += static_cast<std::uint32_t>(length);
+    }
+
+    inline void onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        const std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
+        {
+            m_delegate(buffer, offset, length, header);
+        }
+        else
+        {
+            const std::int32_t sessionId = header.sessionId();
+            const std::int32_t index = findSession(sessionId);
+
+            if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
+            {
+                SessionEntry *entry = NULL_INDEX != index ? &m_sessions[index] : addSession(sessionId);
+
+                entry->limit = static_cast<std::uint32_t>(DataFrameHeader::LENGTH);
+                append(*entry, buffer, offset, length, sessionId);
+            }
+            else if (NULL_INDEX != index)
+            {
+                SessionEntry& entry = m_sessions[index];
+
+                if (entry.limit != static_cast<std::uint32_t>(DataFrameHeader::LENGTH))
+                {
+                    append(entry, buffer, offset, length, sessionId);
+
+                    if ((flags & FrameDescriptor::END_FRAG) == FrameDescriptor::END_FRAG)
+                    {
+                        const util::index_t msgLength =
+                            static_cast<util::index_t>(entry.limit) - DataFrameHeader::LENGTH;
+                        AtomicBuffer msgBuffer(
+                            &m_arena[static_cast<std::size_t>(entry.slot) * m_slotLength],
+                            static_cast<util::index_t>(entry.limit));
+
+                        entry.limit = static_cast<std::uint32_t>(DataFrameHeader::LENGTH);
+                        m_delegate(msgBuffer, DataFrameHeader::LENGTH, msgLength, header);
+                    }
+                }
+            }
+        }
+    }
+};
+
+typedef BasicArenaFragmentAssembler<fragment_handler_t> ArenaFragmentAssembler;
+
+/**
+ * Construct a BasicArenaFragmentAssembler for the type of the delegate so it can be called without indirection.
+ *
+ * @param delegate         onto which whole messages are forwarded.
+ * @param maxMessageLength of a reassembled message for any one session.
+ * @param maxSessions      which may be reassembling messages at the same time.
+ * @return the assembler for the delegate.
+ */
+template <typename H>
+inline BasicArenaFragmentAssembler<typename std::decay<H>::type> makeArenaFragmentAssembler(
+    H&& delegate,
+    std::uint32_t maxMessageLength,
+    std::size_t maxSessions = DEFAULT_ARENA_FRAGMENT_ASSEMBLY_MAX_SESSIONS)
+{
+    return BasicArenaFragmentAssembler<typename std::decay<H>::type>(
+        std::forward<H>(delegate), maxMessageLength, maxSessions);
+}
+
+}
+
+#endif
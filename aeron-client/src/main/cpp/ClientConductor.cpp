@@ -24,18 +24,21 @@ static size_t getAddress(const std::function<T(U...)>& f)
     typedef T(fnType)(U...);
     auto fnPointer = f.template target<fnType*>();
 
-    return (size_t)*fnPointer;
+    return nullptr != fnPointer ? (size_t)*fnPointer : 0;
 }
 
 ClientConductor::~ClientConductor()
 {
-    std::vector<std::shared_ptr<Subscription>> subscriptions;
+    m_publicationByRegistrationId.forEach(
+        [](std::int64_t, PublicationStateDefn &state) { state.releaseCache(); });
+    m_exclusivePublicationByRegistrationId.forEach(
+        [](std::int64_t, ExclusivePublicationStateDefn &state) { state.releaseCache(); });
+    m_subscriptionByRegistrationId.forEach(
+        [](std::int64_t, SubscriptionStateDefn &state) { state.releaseCache(); });
+    m_counterByRegistrationId.forEach(
+        [](std::int64_t, CounterStateDefn &state) { state.releaseCache(); });
 
-    for (auto& kv : m_subscriptionByRegistrationId)
-    {
-        subscriptions.push_back(kv.second.m_subscriptionCache);
-        kv.second.m_subscriptionCache.reset();
-    }
+    processCommands();
 
     std::for_each(m_lingeringImageLists.begin(), m_lingeringImageLists.end(),
         [](ImageListLingerDefn &entry)
@@ -48,169 +51,176 @@ ClientConductor::~ClientConductor()
     std::atomic_store_explicit(&m_isClosed, true, std::memory_order_release);
 }
 
-std::int64_t ClientConductor::addPublication(const std::string &channel, std::int32_t streamId)
+std::int64_t ClientConductor::addPublication(
+    const std::string &channel, std::int32_t streamId, const on_publication_registered_t &onRegistered)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t registrationId = m_driverProxy.addPublication(channel, streamId);
+    return addRegistration(
+        m_publicationByRegistrationId,
+        static_cast<bool>(onRegistered),
+        [&](std::int64_t registrationId)
+        {
+            m_publicationByRegistrationId.emplace(
+                registrationId, channel, registrationId, streamId, m_epochClock(), onRegistered);
+        },
+        [&](std::int64_t registrationId)
+        {
+            m_driverProxy.addPublication(registrationId, channel, streamId);
+        });
+}
+
+std::vector<std::int64_t> ClientConductor::addPublications(
+    const std::vector<std::pair<std::string, std::int32_t>> &channelStreams,
+    const on_publication_registered_t &onRegistered)
+{
+    if (!m_useCommandBatching)
+    {
+        std::vector<std::int64_t> registrationIds;
+        registrationIds.reserve(channelStreams.size());
+
+        for (auto &channelStream : channelStreams)
+        {
+            registrationIds.push_back(addPublication(channelStream.first, channelStream.second, onRegistered));
+        }
+
+        return registrationIds;
+    }
 
-    m_publicationByRegistrationId.insert(std::pair<std::int64_t, PublicationStateDefn>(
-        registrationId,
-        PublicationStateDefn(channel, registrationId, streamId, m_epochClock())));
+    verifyDriverIsActive();
+    ensureNotReentrant();
+    ensureOpen();
 
-    return registrationId;
+    return addRegistrations(
+        m_publicationByRegistrationId,
+        channelStreams.size(),
+        static_cast<bool>(onRegistered),
+        [&](std::size_t index, std::int64_t registrationId)
+        {
+            m_publicationByRegistrationId.emplace(
+                registrationId,
+                channelStreams[index].first,
+                registrationId,
+                channelStreams[index].second,
+                m_epochClock(),
+                onRegistered);
+        },
+        [&](const std::vector<std::int64_t> &registrationIds, std::size_t &writtenCount)
+        {
+            m_driverProxy.addPublications(registrationIds, channelStreams, writtenCount);
+        });
 }
 
 std::shared_ptr<Publication> ClientConductor::findPublication(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto it = m_publicationByRegistrationId.find(registrationId);
-    if (it == m_publicationByRegistrationId.end())
+    PublicationStateDefn *state = m_publicationByRegistrationId.find(registrationId);
+    if (nullptr == state)
     {
         return std::shared_ptr<Publication>();
     }
 
-    PublicationStateDefn &state = it->second;
-    std::shared_ptr<Publication> pub(state.m_publication.lock());
-
-    if (!pub)
-    {
-        switch (state.m_status)
-        {
-            case RegistrationStatus::AWAITING_MEDIA_DRIVER:
-                if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
-                {
-                    throw DriverTimeoutException(
-                        "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
-                }
-                break;
-
-            case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
-            {
-                UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, state.m_publicationLimitCounterId);
-
-                pub = std::make_shared<Publication>(
-                    *this,
-                    state.m_channel,
-                    state.m_registrationId,
-                    state.m_originalRegistrationId,
-                    state.m_streamId,
-                    state.m_sessionId,
-                    publicationLimit,
-                    state.m_channelStatusId,
-                    state.m_buffers);
-
-                state.m_publication = std::weak_ptr<Publication>(pub);
-                break;
-            }
-
-            case RegistrationStatus::ERRORED_MEDIA_DRIVER:
-                throw RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO);
-        }
-    }
-
-    return pub;
+    return findResource(*state);
 }
 
 void ClientConductor::releasePublication(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActiveViaErrorHandler();
 
-    auto it = m_publicationByRegistrationId.find(registrationId);
-    if (it != m_publicationByRegistrationId.end())
+    if (nullptr != m_publicationByRegistrationId.remove(registrationId))
     {
         m_driverProxy.removePublication(registrationId);
-        m_publicationByRegistrationId.erase(it);
     }
 }
 
-std::int64_t ClientConductor::addExclusivePublication(const std::string &channel, std::int32_t streamId)
+std::int64_t ClientConductor::addExclusivePublication(
+    const std::string &channel, std::int32_t streamId, const on_exclusive_publication_registered_t &onRegistered)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t registrationId = m_driverProxy.addExclusivePublication(channel, streamId);
+    return addRegistration(
+        m_exclusivePublicationByRegistrationId,
+        static_cast<bool>(onRegistered),
+        [&](std::int64_t registrationId)
+        {
+            m_exclusivePublicationByRegistrationId.emplace(
+                registrationId, channel, registrationId, streamId, m_epochClock(), onRegistered);
+        },
+        [&](std::int64_t registrationId)
+        {
+            m_driverProxy.addExclusivePublication(registrationId, channel, streamId);
+        });
+}
+
+std::vector<std::int64_t> ClientConductor::addExclusivePublications(
+    const std::vector<std::pair<std::string, std::int32_t>> &channelStreams,
+    const on_exclusive_publication_registered_t &onRegistered)
+{
+    if (!m_useCommandBatching)
+    {
+        std::vector<std::int64_t> registrationIds;
+        registrationIds.reserve(channelStreams.size());
+
+        for (auto &channelStream : channelStreams)
+        {
+            registrationIds.push_back(
+                addExclusivePublication(channelStream.first, channelStream.second, onRegistered));
+        }
+
+        return registrationIds;
+    }
 
-    m_exclusivePublicationByRegistrationId.insert(std::pair<std::int64_t, ExclusivePublicationStateDefn>(
-        registrationId,
-        ExclusivePublicationStateDefn(channel, registrationId, streamId, m_epochClock())));
+    verifyDriverIsActive();
+    ensureNotReentrant();
+    ensureOpen();
 
-    return registrationId;
+    return addRegistrations(
+        m_exclusivePublicationByRegistrationId,
+        channelStreams.size(),
+        static_cast<bool>(onRegistered),
+        [&](std::size_t index, std::int64_t registrationId)
+        {
+            m_exclusivePublicationByRegistrationId.emplace(
+                registrationId,
+                channelStreams[index].first,
+                registrationId,
+                channelStreams[index].second,
+                m_epochClock(),
+                onRegistered);
+        },
+        [&](const std::vector<std::int64_t> &registrationIds, std::size_t &writtenCount)
+        {
+            m_driverProxy.addExclusivePublications(registrationIds, channelStreams, writtenCount);
+        });
 }
 
 std::shared_ptr<ExclusivePublication> ClientConductor::findExclusivePublication(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto it = m_exclusivePublicationByRegistrationId.find(registrationId);
-    if (it == m_exclusivePublicationByRegistrationId.end())
+    ExclusivePublicationStateDefn *state = m_exclusivePublicationByRegistrationId.find(registrationId);
+    if (nullptr == state)
     {
         return std::shared_ptr<ExclusivePublication>();
     }
 
-    ExclusivePublicationStateDefn &state = it->second;
-    std::shared_ptr<ExclusivePublication> pub(state.m_publication.lock());
-
-    if (!pub)
-    {
-        switch (state.m_status)
-        {
-            case RegistrationStatus::AWAITING_MEDIA_DRIVER:
-                if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
-                {
-                    throw DriverTimeoutException(
-                        "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
-                }
-                break;
-
-            case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
-            {
-                UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, state.m_publicationLimitCounterId);
-
-                pub = std::make_shared<ExclusivePublication>(
-                    *this,
-                    state.m_channel,
-                    state.m_registrationId,
-                    state.m_originalRegistrationId,
-                    state.m_streamId,
-                    state.m_sessionId,
-                    publicationLimit,
-                    state.m_channelStatusId,
-                    state.m_buffers);
-
-                state.m_publication = std::weak_ptr<ExclusivePublication>(pub);
-                break;
-            }
-
-            case RegistrationStatus::ERRORED_MEDIA_DRIVER:
-                throw RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO);
-        }
-    }
-
-    return pub;
+    return findResource(*state);
 }
 
 void ClientConductor::releaseExclusivePublication(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActiveViaErrorHandler();
 
-    auto it = m_exclusivePublicationByRegistrationId.find(registrationId);
-    if (it != m_exclusivePublicationByRegistrationId.end())
+    if (nullptr != m_exclusivePublicationByRegistrationId.remove(registrationId))
     {
         m_driverProxy.removePublication(registrationId);
-        m_exclusivePublicationByRegistrationId.erase(it);
     }
 }
 
@@ -218,77 +228,113 @@ std::int64_t ClientConductor::addSubscription(
     const std::string &channel,
     std::int32_t streamId,
     const on_available_image_t &onAvailableImageHandler,
-    const on_unavailable_image_t &onUnavailableImageHandler)
+    const on_unavailable_image_t &onUnavailableImageHandler,
+    const on_subscription_registered_t &onRegistered)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t registrationId = m_driverProxy.addSubscription(channel, streamId);
+    return addRegistration(
+        m_subscriptionByRegistrationId,
+        static_cast<bool>(onRegistered),
+        [&](std::int64_t registrationId)
+        {
+            m_subscriptionByRegistrationId.emplace(
+                registrationId,
+                channel,
+                registrationId,
+                streamId,
+                m_epochClock(),
+                onAvailableImageHandler,
+                onUnavailableImageHandler,
+                onRegistered);
+        },
+        [&](std::int64_t registrationId)
+        {
+            m_driverProxy.addSubscription(registrationId, channel, streamId);
+        });
+}
+
+std::vector<std::int64_t> ClientConductor::addSubscriptions(
+    const std::vector<std::pair<std::string, std::int32_t>> &channelStreams,
+    const on_available_image_t &onAvailableImageHandler,
+    const on_unavailable_image_t &onUnavailableImageHandler,
+    const on_subscription_registered_t &onRegistered)
+{
+    if (!m_useCommandBatching)
+    {
+        std::vector<std::int64_t> registrationIds;
+        registrationIds.reserve(channelStreams.size());
+
+        for (auto &channelStream : channelStreams)
+        {
+            registrationIds.push_back(addSubscription(
+                channelStream.first,
+                channelStream.second,
+                onAvailableImageHandler,
+                onUnavailableImageHandler,
+                onRegistered));
+        }
+
+        return registrationIds;
+    }
 
-    m_subscriptionByRegistrationId.insert(std::pair<std::int64_t, SubscriptionStateDefn>(
-        registrationId,
-        SubscriptionStateDefn(
-            channel, registrationId, streamId, m_epochClock(), onAvailableImageHandler, onUnavailableImageHandler)));
+    verifyDriverIsActive();
+    ensureNotReentrant();
+    ensureOpen();
 
-    return registrationId;
+    return addRegistrations(
+        m_subscriptionByRegistrationId,
+        channelStreams.size(),
+        static_cast<bool>(onRegistered),
+        [&](std::size_t index, std::int64_t registrationId)
+        {
+            m_subscriptionByRegistrationId.emplace(
+                registrationId,
+                channelStreams[index].first,
+                registrationId,
+                channelStreams[index].second,
+                m_epochClock(),
+                onAvailableImageHandler,
+                onUnavailableImageHandler,
+                onRegistered);
+        },
+        [&](const std::vector<std::int64_t> &registrationIds, std::size_t &writtenCount)
+        {
+            m_driverProxy.addSubscriptions(registrationIds, channelStreams, writtenCount);
+        });
 }
 
 std::shared_ptr<Subscription> ClientConductor::findSubscription(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto it = m_subscriptionByRegistrationId.find(registrationId);
-    if (it == m_subscriptionByRegistrationId.end())
+    SubscriptionStateDefn *state = m_subscriptionByRegistrationId.find(registrationId);
+    if (nullptr == state)
     {
         return std::shared_ptr<Subscription>();
     }
 
-    SubscriptionStateDefn &state = it->second;
-    std::shared_ptr<Subscription> sub = state.m_subscription.lock();
-
-    if (state.m_subscriptionCache)
-    {
-        state.m_subscriptionCache.reset();
-    }
-
-    if (!sub && RegistrationStatus::AWAITING_MEDIA_DRIVER == state.m_status)
-    {
-        if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
-        {
-            throw DriverTimeoutException(
-                "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
-        }
-    }
-    else if (!sub && RegistrationStatus::ERRORED_MEDIA_DRIVER == state.m_status)
-    {
-        throw RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO);
-    }
-
-    return sub;
+    return findResource(*state);
 }
 
 void ClientConductor::releaseSubscription(std::int64_t registrationId, Image::array_t imageArray, std::size_t length)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActiveViaErrorHandler();
 
-    auto it = m_subscriptionByRegistrationId.find(registrationId);
-    if (it != m_subscriptionByRegistrationId.end())
+    SubscriptionStateDefn *state = m_subscriptionByRegistrationId.remove(registrationId);
+    if (nullptr != state)
     {
         m_driverProxy.removeSubscription(registrationId);
 
         for (std::size_t i = 0; i < length; i++)
         {
-            it->second.m_onUnavailableImageHandler(*imageArray[i]);
+            state->m_onUnavailableImageHandler(*imageArray[i]);
         }
 
-        m_subscriptionByRegistrationId.erase(it);
-
-        lingerAllResources(m_epochClock(), imageArray);
+        m_commandQueue.offer([this, imageArray]() { lingerAllResources(m_epochClock(), imageArray); });
     }
     else
     {
@@ -297,9 +343,12 @@ void ClientConductor::releaseSubscription(std::int64_t registrationId, Image::ar
 }
 
 std::int64_t ClientConductor::addCounter(
-    std::int32_t typeId, const std::uint8_t *keyBuffer, std::size_t keyLength, const std::string &label)
+    std::int32_t typeId,
+    const std::uint8_t *keyBuffer,
+    std::size_t keyLength,
+    const std::string &label,
+    const on_counter_registered_t &onRegistered)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
@@ -314,152 +363,143 @@ std::int64_t ClientConductor::addCounter(
         throw IllegalArgumentException("label length out of bounds: " + std::to_string(label.length()), SOURCEINFO);
     }
 
-    std::int64_t registrationId = m_driverProxy.addCounter(typeId, keyBuffer, keyLength, label);
-
-    m_counterByRegistrationId.insert(std::pair<std::int64_t, CounterStateDefn>(
-        registrationId, CounterStateDefn(registrationId, m_epochClock())));
-
-    return registrationId;
+    return addRegistration(
+        m_counterByRegistrationId,
+        static_cast<bool>(onRegistered),
+        [&](std::int64_t registrationId)
+        {
+            m_counterByRegistrationId.emplace(registrationId, registrationId, m_epochClock(), onRegistered);
+        },
+        [&](std::int64_t registrationId)
+        {
+            m_driverProxy.addCounter(registrationId, typeId, keyBuffer, keyLength, label);
+        });
 }
 
 std::shared_ptr<Counter> ClientConductor::findCounter(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto it = m_counterByRegistrationId.find(registrationId);
-    if (it == m_counterByRegistrationId.end())
+    CounterStateDefn *state = m_counterByRegistrationId.find(registrationId);
+    if (nullptr == state)
     {
         return std::shared_ptr<Counter>();
     }
 
-    CounterStateDefn &state = it->second;
-    std::shared_ptr<Counter> counter = state.m_counter.lock();
-
-    if (state.m_counterCache)
-    {
-        state.m_counterCache.reset();
-    }
-
-    if (!counter && RegistrationStatus::AWAITING_MEDIA_DRIVER == state.m_status)
-    {
-        if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
-        {
-            throw DriverTimeoutException(
-                "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
-        }
-    }
-    else if (!counter && RegistrationStatus::ERRORED_MEDIA_DRIVER == state.m_status)
-    {
-        throw RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO);
-    }
-
-    return counter;
+    return findResource(*state);
 }
 
 void ClientConductor::releaseCounter(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActiveViaErrorHandler();
 
-    auto it = m_counterByRegistrationId.find(registrationId);
-    if (it != m_counterByRegistrationId.end())
+    if (nullptr != m_counterByRegistrationId.remove(registrationId))
     {
         m_driverProxy.removeCounter(registrationId);
-
-        m_counterByRegistrationId.erase(it);
     }
 }
 
-void ClientConductor::addDestination(std::int64_t publicationRegistrationId, const std::string &endpointChannel)
+std::int64_t ClientConductor::addDestination(
+    std::int64_t publicationRegistrationId, const std::string &endpointChannel, const on_destination_complete_t &onComplete)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    verifyDriverIsActive();
-    ensureNotReentrant();
-    ensureOpen();
-
-    m_driverProxy.addDestination(publicationRegistrationId, endpointChannel);
+    return sendDestinationCommand(
+        onComplete,
+        [&](std::int64_t correlationId)
+        {
+            m_driverProxy.addDestination(correlationId, publicationRegistrationId, endpointChannel);
+        });
 }
 
-void ClientConductor::removeDestination(std::int64_t publicationRegistrationId, const std::string &endpointChannel)
+std::int64_t ClientConductor::removeDestination(
+    std::int64_t publicationRegistrationId, const std::string &endpointChannel, const on_destination_complete_t &onComplete)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    verifyDriverIsActive();
-    ensureNotReentrant();
-    ensureOpen();
-
-    m_driverProxy.removeDestination(publicationRegistrationId, endpointChannel);
+    return sendDestinationCommand(
+        onComplete,
+        [&](std::int64_t correlationId)
+        {
+            m_driverProxy.removeDestination(correlationId, publicationRegistrationId, endpointChannel);
+        });
 }
 
-void ClientConductor::addRcvDestination(std::int64_t subscriptionRegistrationId, const std::string &endpointChannel)
+std::int64_t ClientConductor::addRcvDestination(
+    std::int64_t subscriptionRegistrationId, const std::string &endpointChannel, const on_destination_complete_t &onComplete)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    verifyDriverIsActive();
-    ensureNotReentrant();
-    ensureOpen();
-
-    m_driverProxy.addRcvDestination(subscriptionRegistrationId, endpointChannel);
+    return sendDestinationCommand(
+        onComplete,
+        [&](std::int64_t correlationId)
+        {
+            m_driverProxy.addRcvDestination(correlationId, subscriptionRegistrationId, endpointChannel);
+        });
 }
 
-void ClientConductor::removeRcvDestination(std::int64_t subscriptionRegistrationId, const std::string &endpointChannel)
+std::int64_t ClientConductor::removeRcvDestination(
+    std::int64_t subscriptionRegistrationId, const std::string &endpointChannel, const on_destination_complete_t &onComplete)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    verifyDriverIsActive();
-    ensureNotReentrant();
-    ensureOpen();
-
-    m_driverProxy.removeRcvDestination(subscriptionRegistrationId, endpointChannel);
+    return sendDestinationCommand(
+        onComplete,
+        [&](std::int64_t correlationId)
+        {
+            m_driverProxy.removeRcvDestination(correlationId, subscriptionRegistrationId, endpointChannel);
+        });
 }
 
 void ClientConductor::addAvailableCounterHandler(const on_available_counter_t& handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    m_onAvailableCounterHandlers.emplace_back(handler);
+    std::lock_guard<std::mutex> lock(m_counterHandlersLock);
+    auto handlers = std::make_shared<std::vector<on_available_counter_t>>(*m_onAvailableCounterHandlers);
+    handlers->emplace_back(handler);
+    m_onAvailableCounterHandlers = handlers;
 }
 
 void ClientConductor::removeAvailableCounterHandler(const on_available_counter_t& handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto &v = m_onAvailableCounterHandlers;
+    std::lock_guard<std::mutex> lock(m_counterHandlersLock);
+    auto handlers = std::make_shared<std::vector<on_available_counter_t>>(*m_onAvailableCounterHandlers);
+    const size_t address = getAddress(handler);
     auto predicate =
-        [handler](const on_available_counter_t &item)
+        [address](const on_available_counter_t &item)
         {
-            return getAddress(item) == getAddress(handler);
+            return 0 != address && getAddress(item) == address;
         };
 
-    v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+    handlers->erase(std::remove_if(handlers->begin(), handlers->end(), predicate), handlers->end());
+    m_onAvailableCounterHandlers = handlers;
 }
 
 void ClientConductor::addUnavailableCounterHandler(const on_unavailable_counter_t& handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    m_onUnavailableCounterHandlers.emplace_back(handler);
+    std::lock_guard<std::mutex> lock(m_counterHandlersLock);
+    auto handlers = std::make_shared<std::vector<on_unavailable_counter_t>>(*m_onUnavailableCounterHandlers);
+    handlers->emplace_back(handler);
+    m_onUnavailableCounterHandlers = handlers;
 }
 
 void ClientConductor::removeUnavailableCounterHandler(const on_unavailable_counter_t& handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto &v = m_onUnavailableCounterHandlers;
+    std::lock_guard<std::mutex> lock(m_counterHandlersLock);
+    auto handlers = std::make_shared<std::vector<on_unavailable_counter_t>>(*m_onUnavailableCounterHandlers);
+    const size_t address = getAddress(handler);
     auto predicate =
-        [handler](const on_unavailable_counter_t &item)
+        [address](const on_unavailable_counter_t &item)
         {
-            return getAddress(item) == getAddress(handler);
+            return 0 != address && getAddress(item) == address;
         };
 
-    v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+    handlers->erase(std::remove_if(handlers->begin(), handlers->end(), predicate), handlers->end());
+    m_onUnavailableCounterHandlers = handlers;
 }
 
 void ClientConductor::onNewPublication(
@@ -471,22 +511,38 @@ void ClientConductor::onNewPublication(
     std::int32_t channelStatusIndicatorId,
     const std::string &logFileName)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto it = m_publicationByRegistrationId.find(registrationId);
-    if (it != m_publicationByRegistrationId.end())
-    {
-        PublicationStateDefn &state = it->second;
+    PublicationStateDefn *state = m_publicationByRegistrationId.find(registrationId);
+    if (nullptr != state &&
+        RegistrationStatus::AWAITING_MEDIA_DRIVER == state->m_status.load(std::memory_order_acquire))
+    {
+        UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, publicationLimitCounterId);
+
+        state->m_resourceCache = std::make_shared<Publication>(
+            *this,
+            state->m_channel,
+            registrationId,
+            originalRegistrationId,
+            streamId,
+            sessionId,
+            publicationLimit,
+            channelStatusIndicatorId,
+            getLogBuffers(originalRegistrationId, logFileName));
+        state->m_resource = std::weak_ptr<Publication>(state->m_resourceCache);
+        state->m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_sessionId = sessionId;
-        state.m_publicationLimitCounterId = publicationLimitCounterId;
-        state.m_channelStatusId = channelStatusIndicatorId;
-        state.m_buffers = getLogBuffers(originalRegistrationId, logFileName);
-        state.m_originalRegistrationId = originalRegistrationId;
+        {
+            CallbackGuard callbackGuard(m_callbackThreadId);
+            m_onNewPublicationHandler(state->m_channel, streamId, sessionId, registrationId);
+        }
 
-        CallbackGuard callbackGuard(m_isInCallback);
-        m_onNewPublicationHandler(state.m_channel, streamId, sessionId, registrationId);
+        if (state->m_onRegistered)
+        {
+            completeRegistration(*state, nullptr);
+        }
+    }
+    else if (removeOrphanedRegistration(registrationId))
+    {
+        m_driverProxy.removePublication(registrationId);
     }
 }
 
@@ -499,120 +555,149 @@ void ClientConductor::onNewExclusivePublication(
     std::int32_t channelStatusIndicatorId,
     const std::string &logFileName)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    ExclusivePublicationStateDefn *state = m_exclusivePublicationByRegistrationId.find(registrationId);
+    if (nullptr != state &&
+        RegistrationStatus::AWAITING_MEDIA_DRIVER == state->m_status.load(std::memory_order_acquire))
+    {
+        UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, publicationLimitCounterId);
+
+        state->m_resourceCache = std::make_shared<ExclusivePublication>(
+            *this,
+            state->m_channel,
+            registrationId,
+            originalRegistrationId,
+            streamId,
+            sessionId,
+            publicationLimit,
+            channelStatusIndicatorId,
+            getLogBuffers(originalRegistrationId, logFileName));
+        state->m_resource = std::weak_ptr<ExclusivePublication>(state->m_resourceCache);
+        state->m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
 
-    auto it = m_exclusivePublicationByRegistrationId.find(registrationId);
-    if (it != m_exclusivePublicationByRegistrationId.end())
-    {
-        ExclusivePublicationStateDefn &state = it->second;
-
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_sessionId = sessionId;
-        state.m_publicationLimitCounterId = publicationLimitCounterId;
-        state.m_channelStatusId = channelStatusIndicatorId;
-        state.m_buffers = getLogBuffers(originalRegistrationId, logFileName);
-        state.m_originalRegistrationId = originalRegistrationId;
+        {
+            CallbackGuard callbackGuard(m_callbackThreadId);
+            m_onNewExclusivePublicationHandler(state->m_channel, streamId, sessionId, registrationId);
+        }
 
-        CallbackGuard callbackGuard(m_isInCallback);
-        m_onNewExclusivePublicationHandler(state.m_channel, streamId, sessionId, registrationId);
+        if (state->m_onRegistered)
+        {
+            completeRegistration(*state, nullptr);
+        }
+    }
+    else if (removeOrphanedRegistration(registrationId))
+    {
+        m_driverProxy.removePublication(registrationId);
     }
 }
 
 void ClientConductor::onSubscriptionReady(std::int64_t registrationId, std::int32_t channelStatusId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto it = m_subscriptionByRegistrationId.find(registrationId);
-    if (it != m_subscriptionByRegistrationId.end() && it->second.m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+    SubscriptionStateDefn *state = m_subscriptionByRegistrationId.find(registrationId);
+    if (nullptr != state &&
+        RegistrationStatus::AWAITING_MEDIA_DRIVER == state->m_status.load(std::memory_order_acquire))
     {
-        SubscriptionStateDefn &state = it->second;
+        state->m_resourceCache = std::make_shared<Subscription>(
+            *this, state->m_registrationId, state->m_channel, state->m_streamId, channelStatusId);
+        state->m_resource = std::weak_ptr<Subscription>(state->m_resourceCache);
+        state->m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_subscriptionCache = std::make_shared<Subscription>(
-            *this, state.m_registrationId, state.m_channel, state.m_streamId, channelStatusId);
-        state.m_subscription = std::weak_ptr<Subscription>(state.m_subscriptionCache);
+        {
+            CallbackGuard callbackGuard(m_callbackThreadId);
+            m_onNewSubscriptionHandler(state->m_channel, state->m_streamId, registrationId);
+        }
 
-        CallbackGuard callbackGuard(m_isInCallback);
-        m_onNewSubscriptionHandler(state.m_channel, state.m_streamId, registrationId);
+        if (state->m_onRegistered)
+        {
+            completeRegistration(*state, nullptr);
+        }
+    }
+    else if (removeOrphanedRegistration(registrationId))
+    {
+        m_driverProxy.removeSubscription(registrationId);
     }
 }
 
 void ClientConductor::onAvailableCounter(std::int64_t registrationId, std::int32_t counterId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    CounterStateDefn *state = m_counterByRegistrationId.find(registrationId);
+    if (nullptr != state &&
+        RegistrationStatus::AWAITING_MEDIA_DRIVER == state->m_status.load(std::memory_order_acquire))
+    {
+        state->m_counterId = counterId;
+        state->m_resourceCache = std::make_shared<Counter>(
+            this, m_counterValuesBuffer, state->m_registrationId, counterId);
+        state->m_resource = std::weak_ptr<Counter>(state->m_resourceCache);
+        state->m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
 
-    auto it = m_counterByRegistrationId.find(registrationId);
-    if (it != m_counterByRegistrationId.end() && it->second.m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+        if (state->m_onRegistered)
+        {
+            completeRegistration(*state, nullptr);
+        }
+    }
+    else if (removeOrphanedRegistration(registrationId))
     {
-        CounterStateDefn &state = it->second;
+        m_driverProxy.removeCounter(registrationId);
+    }
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_counterId = counterId;
-        state.m_counterCache = std::make_shared<Counter>(this, m_counterValuesBuffer, state.m_registrationId, counterId);
-        state.m_counter = std::weak_ptr<Counter>(state.m_counterCache);
+    std::shared_ptr<const std::vector<on_available_counter_t>> handlers;
+    {
+        std::lock_guard<std::mutex> lock(m_counterHandlersLock);
+        handlers = m_onAvailableCounterHandlers;
     }
 
-    for (auto const& handler: m_onAvailableCounterHandlers)
+    for (auto const& handler: *handlers)
     {
-        CallbackGuard callbackGuard(m_isInCallback);
+        CallbackGuard callbackGuard(m_callbackThreadId);
         handler(m_countersReader, registrationId, counterId);
     }
 }
 
 void ClientConductor::onUnavailableCounter(std::int64_t registrationId, std::int32_t counterId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    std::shared_ptr<const std::vector<on_unavailable_counter_t>> handlers;
+    {
+        std::lock_guard<std::mutex> lock(m_counterHandlersLock);
+        handlers = m_onUnavailableCounterHandlers;
+    }
 
-    for (auto const& handler: m_onUnavailableCounterHandlers)
+    for (auto const& handler: *handlers)
     {
-        CallbackGuard callbackGuard(m_isInCallback);
+        CallbackGuard callbackGuard(m_callbackThreadId);
         handler(m_countersReader, registrationId, counterId);
     }
 }
 
 void ClientConductor::onOperationSuccess(std::int64_t correlationId)
 {
+    DestinationStateDefn *state = m_destinationByCorrelationId.remove(correlationId);
+    if (nullptr != state)
+    {
+        completeDestination(*state, nullptr);
+    }
 }
 
 void ClientConductor::onErrorResponse(
     std::int64_t offendingCommandCorrelationId, std::int32_t errorCode, const std::string &errorMessage)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto subIt = m_subscriptionByRegistrationId.find(offendingCommandCorrelationId);
-    if (subIt != m_subscriptionByRegistrationId.end())
+    if (setRegistrationError(m_subscriptionByRegistrationId, offendingCommandCorrelationId, errorCode, errorMessage) ||
+        setRegistrationError(m_publicationByRegistrationId, offendingCommandCorrelationId, errorCode, errorMessage) ||
+        setRegistrationError(
+            m_exclusivePublicationByRegistrationId, offendingCommandCorrelationId, errorCode, errorMessage))
     {
-        subIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        subIt->second.m_errorCode = errorCode;
-        subIt->second.m_errorMessage = errorMessage;
         return;
     }
 
-    auto pubIt = m_publicationByRegistrationId.find(offendingCommandCorrelationId);
-    if (pubIt != m_publicationByRegistrationId.end())
+    if (setRegistrationError(m_counterByRegistrationId, offendingCommandCorrelationId, errorCode, errorMessage) ||
+        removeOrphanedRegistration(offendingCommandCorrelationId))
     {
-        pubIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        pubIt->second.m_errorCode = errorCode;
-        pubIt->second.m_errorMessage = errorMessage;
         return;
     }
 
-    auto exPubIt = m_exclusivePublicationByRegistrationId.find(offendingCommandCorrelationId);
-    if (exPubIt != m_exclusivePublicationByRegistrationId.end())
+    DestinationStateDefn *state = m_destinationByCorrelationId.remove(offendingCommandCorrelationId);
+    if (nullptr != state)
     {
-        exPubIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        exPubIt->second.m_errorCode = errorCode;
-        exPubIt->second.m_errorMessage = errorMessage;
-        return;
-    }
-
-    auto counterIt = m_counterByRegistrationId.find(offendingCommandCorrelationId);
-    if (counterIt != m_counterByRegistrationId.end())
-    {
-        counterIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        counterIt->second.m_errorCode = errorCode;
-        counterIt->second.m_errorMessage = errorMessage;
-        return;
+        completeDestination(
+            *state, std::make_exception_ptr(RegistrationException(errorCode, errorMessage, SOURCEINFO)));
     }
 }
 
@@ -624,13 +709,10 @@ void ClientConductor::onAvailableImage(
     const std::string &logFilename,
     const std::string &sourceIdentity)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto it = m_subscriptionByRegistrationId.find(subscriptionRegistrationId);
-    if (it != m_subscriptionByRegistrationId.end())
+    SubscriptionStateDefn *entry = m_subscriptionByRegistrationId.find(subscriptionRegistrationId);
+    if (nullptr != entry)
     {
-        SubscriptionStateDefn &entry = it->second;
-        std::shared_ptr<Subscription> subscription = entry.m_subscription.lock();
+        std::shared_ptr<Subscription> subscription = entry->m_resource.lock();
 
         if (nullptr != subscription)
         {
@@ -645,8 +727,8 @@ void ClientConductor::onAvailableImage(
                 getLogBuffers(correlationId, logFilename),
                 m_errorHandler);
 
-            CallbackGuard callbackGuard(m_isInCallback);
-            entry.m_onAvailableImageHandler(*image);
+            CallbackGuard callbackGuard(m_callbackThreadId);
+            entry->m_onAvailableImageHandler(*image);
 
             Image::array_t oldImageArray = subscription->addImage(image);
 
@@ -660,14 +742,12 @@ void ClientConductor::onAvailableImage(
 
 void ClientConductor::onUnavailableImage(std::int64_t correlationId, std::int64_t subscriptionRegistrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     const long long nowMs = m_epochClock();
 
-    auto it = m_subscriptionByRegistrationId.find(subscriptionRegistrationId);
-    if (it != m_subscriptionByRegistrationId.end())
+    SubscriptionStateDefn *entry = m_subscriptionByRegistrationId.find(subscriptionRegistrationId);
+    if (nullptr != entry)
     {
-        SubscriptionStateDefn &entry = it->second;
-        std::shared_ptr<Subscription> subscription = entry.m_subscription.lock();
+        std::shared_ptr<Subscription> subscription = entry->m_resource.lock();
 
         if (nullptr != subscription)
         {
@@ -679,8 +759,8 @@ void ClientConductor::onUnavailableImage(std::int64_t correlationId, std::int64_
             {
                 lingerResource(nowMs, oldImageArray);
 
-                CallbackGuard callbackGuard(m_isInCallback);
-                entry.m_onUnavailableImageHandler(*oldImageArray[index]);
+                CallbackGuard callbackGuard(m_callbackThreadId);
+                entry->m_onUnavailableImageHandler(*oldImageArray[index]);
             }
         }
     }
@@ -690,7 +770,6 @@ void ClientConductor::onClientTimeout(std::int64_t clientId)
 {
     if (m_driverProxy.clientId() == clientId && !isClosed())
     {
-        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
         const long long nowMs = m_epochClock();
 
         closeAllResources(nowMs);
@@ -703,45 +782,77 @@ void ClientConductor::onClientTimeout(std::int64_t clientId)
 void ClientConductor::closeAllResources(long long nowMs)
 {
     forceClose();
+    m_orphanedRegistrationIds.clear();
 
-    for (auto& kv : m_publicationByRegistrationId)
-    {
-        std::shared_ptr<Publication> pub = kv.second.m_publication.lock();
+    m_publicationByRegistrationId.removeAll(
+        [&](std::int64_t, PublicationStateDefn &state)
+        {
+            failPendingRegistration(state, "client conductor closed");
+
+            std::shared_ptr<Publication> pub = state.m_resource.lock();
+
+            if (nullptr != pub)
+            {
+                pub->close();
+            }
 
-        if (nullptr != pub)
+            state.releaseCache();
+        });
+
+    m_exclusivePublicationByRegistrationId.removeAll(
+        [&](std::int64_t, ExclusivePublicationStateDefn &state)
         {
-            pub->close();
-        }
-    }
-    m_publicationByRegistrationId.clear();
+            failPendingRegistration(state, "client conductor closed");
 
-    for (auto& kv : m_exclusivePublicationByRegistrationId)
-    {
-        std::shared_ptr<ExclusivePublication> pub = kv.second.m_publication.lock();
+            std::shared_ptr<ExclusivePublication> pub = state.m_resource.lock();
+
+            if (nullptr != pub)
+            {
+                pub->close();
+            }
+
+            state.releaseCache();
+        });
 
-        if (nullptr != pub)
+    m_subscriptionByRegistrationId.removeAll(
+        [&](std::int64_t, SubscriptionStateDefn &state)
         {
-            pub->close();
-        }
-    }
-    m_exclusivePublicationByRegistrationId.clear();
+            failPendingRegistration(state, "client conductor closed");
 
-    for (auto& kv : m_subscriptionByRegistrationId)
-    {
-        std::shared_ptr<Subscription> sub = kv.second.m_subscription.lock();
+            std::shared_ptr<Subscription> sub = state.m_resource.lock();
 
-        if (nullptr != sub)
+            if (nullptr != sub)
+            {
+                lingerAllResources(nowMs, sub->removeAndCloseAllImages());
+            }
+
+            state.releaseCache();
+        });
+
+    m_counterByRegistrationId.removeAll(
+        [&](std::int64_t, CounterStateDefn &state)
         {
-            lingerAllResources(nowMs, sub->removeAndCloseAllImages());
-        }
-    }
-    m_subscriptionByRegistrationId.clear();
+            failPendingRegistration(state, "client conductor closed");
+
+            std::shared_ptr<Counter> counter = state.m_resource.lock();
+
+            if (nullptr != counter)
+            {
+                counter->close();
+            }
+
+            state.releaseCache();
+        });
+
+    m_destinationByCorrelationId.removeAll(
+        [&](std::int64_t, DestinationStateDefn &state)
+        {
+            completeDestination(state, std::make_exception_ptr(AeronException("client conductor closed", SOURCEINFO)));
+        });
 }
 
 void ClientConductor::onCheckManagedResources(long long nowMs)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
     for (auto it = m_logBuffersByRegistrationId.begin(); it != m_logBuffersByRegistrationId.end(); )
     {
         LogBuffersDefn &entry = it->second;
@@ -777,6 +888,35 @@ void ClientConductor::onCheckManagedResources(long long nowMs)
         });
 
     m_lingeringImageLists.erase(arrayIt, m_lingeringImageLists.end());
+
+    if (m_pendingCompletionCount.load(std::memory_order_acquire) > 0)
+    {
+        checkRegistrationTimeouts(m_publicationByRegistrationId, nowMs);
+        checkRegistrationTimeouts(m_exclusivePublicationByRegistrationId, nowMs);
+        checkRegistrationTimeouts(m_subscriptionByRegistrationId, nowMs);
+        checkRegistrationTimeouts(m_counterByRegistrationId, nowMs);
+        checkDestinationTimeouts(nowMs);
+    }
+
+    m_publicationByRegistrationId.reclaim(nowMs, m_resourceLingerTimeoutMs);
+    m_exclusivePublicationByRegistrationId.reclaim(nowMs, m_resourceLingerTimeoutMs);
+    m_subscriptionByRegistrationId.reclaim(nowMs, m_resourceLingerTimeoutMs);
+    m_counterByRegistrationId.reclaim(nowMs, m_resourceLingerTimeoutMs);
+    m_destinationByCorrelationId.reclaim(nowMs, m_resourceLingerTimeoutMs);
+}
+
+void ClientConductor::checkDestinationTimeouts(long long nowMs)
+{
+    m_destinationByCorrelationId.forEach(
+        [&](std::int64_t correlationId, DestinationStateDefn &state)
+        {
+            if (nowMs > (state.m_timeOfRegistrationMs + m_driverTimeoutMs) &&
+                nullptr != m_destinationByCorrelationId.remove(correlationId))
+            {
+                completeDestination(state, std::make_exception_ptr(DriverTimeoutException(
+                    "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO)));
+            }
+        });
 }
 
 void ClientConductor::lingerResource(long long nowMs, Image::array_t imageArray)
@@ -18,9 +18,14 @@
 #define AERON_CLIENT_CONDUCTOR_H
 
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <concurrent/logbuffer/TermReader.h>
+#include <concurrent/ManyToOneConcurrentLinkedQueue.h>
+#include <concurrent/RegistrationMap.h>
 #include <concurrent/status/UnsafeBufferPosition.h>
 #include <util/LangUtil.h>
 #include "Publication.h"
@@ -48,14 +53,14 @@ static const long RESOURCE_TIMEOUT_MS = 1000;
 class CallbackGuard
 {
 public:
-    explicit CallbackGuard(bool& isInCallback) : m_isInCallback(isInCallback)
+    explicit CallbackGuard(std::atomic<std::thread::id>& callbackThreadId) : m_callbackThreadId(callbackThreadId)
     {
-        m_isInCallback = true;
+        m_callbackThreadId.store(std::this_thread::get_id(), std::memory_order_release);
     }
 
     ~CallbackGuard()
     {
-        m_isInCallback = false;
+        m_callbackThreadId.store(std::thread::id(), std::memory_order_release);
     }
 
     CallbackGuard(const CallbackGuard&) = delete;
@@ -63,7 +68,7 @@ public:
     CallbackGuard& operator = (const CallbackGuard&) = delete;
 
 private:
-    bool& m_isInCallback;
+    std::atomic<std::thread::id>& m_callbackThreadId;
 };
 
 class ClientConductor
@@ -85,7 +90,8 @@ public:
         long driverTimeoutMs,
         long resourceLingerTimeoutMs,
         long long interServiceTimeoutNs,
-        bool preTouchMappedMemory) :
+        bool preTouchMappedMemory,
+        bool useCommandBatching = false) :
         m_driverProxy(driverProxy),
         m_driverListenerAdapter(broadcastReceiver, *this),
         m_countersReader(counterMetadataBuffer, counterValuesBuffer),
@@ -103,10 +109,14 @@ public:
         m_interServiceTimeoutMs(static_cast<long>(interServiceTimeoutNs / 1000000)),
         m_driverActive(true),
         m_isClosed(false),
-        m_preTouchMappedMemory(preTouchMappedMemory)
+        m_preTouchMappedMemory(preTouchMappedMemory),
+        m_useCommandBatching(useCommandBatching),
+        m_callbackThreadId(std::thread::id())
     {
-        m_onAvailableCounterHandlers.emplace_back(availableCounterHandler);
-        m_onUnavailableCounterHandlers.emplace_back(unavailableCounterHandler);
+        m_onAvailableCounterHandlers =
+            std::make_shared<std::vector<on_available_counter_t>>(1, availableCounterHandler);
+        m_onUnavailableCounterHandlers =
+            std::make_shared<std::vector<on_unavailable_counter_t>>(1, unavailableCounterHandler);
     }
 
     virtual ~ClientConductor();
@@ -119,6 +129,7 @@ public:
     {
         int workCount = 0;
 
+        workCount += processCommands();
         workCount += m_driverListenerAdapter.receiveMessages();
         workCount += onHeartbeatCheckTimeouts();
 
@@ -129,11 +140,21 @@ public:
     {
     }
 
-    std::int64_t addPublication(const std::string& channel, std::int32_t streamId);
+    std::int64_t addPublication(
+        const std::string& channel, std::int32_t streamId, const on_publication_registered_t& onRegistered = nullptr);
+    std::vector<std::int64_t> addPublications(
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        const on_publication_registered_t& onRegistered);
     std::shared_ptr<Publication> findPublication(std::int64_t registrationId);
     void releasePublication(std::int64_t registrationId);
 
-    std::int64_t addExclusivePublication(const std::string& channel, std::int32_t streamId);
+    std::int64_t addExclusivePublication(
+        const std::string& channel,
+        std::int32_t streamId,
+        const on_exclusive_publication_registered_t& onRegistered = nullptr);
+    std::vector<std::int64_t> addExclusivePublications(
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        const on_exclusive_publication_registered_t& onRegistered);
     std::shared_ptr<ExclusivePublication> findExclusivePublication(std::int64_t registrationId);
     void releaseExclusivePublication(std::int64_t registrationId);
 
@@ -141,7 +162,13 @@ public:
         const std::string& channel,
         std::int32_t streamId,
         const on_available_image_t &onAvailableImageHandler,
-        const on_unavailable_image_t &onUnavailableImageHandler);
+        const on_unavailable_image_t &onUnavailableImageHandler,
+        const on_subscription_registered_t& onRegistered = nullptr);
+    std::vector<std::int64_t> addSubscriptions(
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler,
+        const on_subscription_registered_t& onRegistered);
     std::shared_ptr<Subscription> findSubscription(std::int64_t registrationId);
     void releaseSubscription(std::int64_t registrationId, Image::array_t imageArray, std::size_t length);
 
@@ -149,7 +176,8 @@ public:
         std::int32_t typeId,
         const std::uint8_t *keyBuffer,
         std::size_t keyLength,
-        const std::string& label);
+        const std::string& label,
+        const on_counter_registered_t& onRegistered = nullptr);
     std::shared_ptr<Counter> findCounter(std::int64_t registrationId);
     void releaseCounter(std::int64_t registrationId);
 
@@ -196,11 +224,23 @@ public:
 
     void closeAllResources(long long nowMs);
 
-    void addDestination(std::int64_t publicationRegistrationId, const std::string& endpointChannel);
-    void removeDestination(std::int64_t publicationRegistrationId, const std::string& endpointChannel);
+    std::int64_t addDestination(
+        std::int64_t publicationRegistrationId,
+        const std::string& endpointChannel,
+        const on_destination_complete_t& onComplete = nullptr);
+    std::int64_t removeDestination(
+        std::int64_t publicationRegistrationId,
+        const std::string& endpointChannel,
+        const on_destination_complete_t& onComplete = nullptr);
 
-    void addRcvDestination(std::int64_t subscriptionRegistrationId, const std::string& endpointChannel);
-    void removeRcvDestination(std::int64_t subscriptionRegistrationId, const std::string& endpointChannel);
+    std::int64_t addRcvDestination(
+        std::int64_t subscriptionRegistrationId,
+        const std::string& endpointChannel,
+        const on_destination_complete_t& onComplete = nullptr);
+    std::int64_t removeRcvDestination(
+        std::int64_t subscriptionRegistrationId,
+        const std::string& endpointChannel,
+        const on_destination_complete_t& onComplete = nullptr);
 
     void addAvailableCounterHandler(const on_available_counter_t& handler);
     void removeAvailableCounterHandler(const on_available_counter_t& handler);
@@ -249,6 +289,8 @@ public:
 protected:
     void onCheckManagedResources(long long nowMs);
 
+    void checkDestinationTimeouts(long long nowMs);
+
     void lingerResource(long long nowMs, Image::array_t imageArray);
 
     void lingerAllResources(long long nowMs, Image::array_t imageArray);
@@ -259,69 +301,84 @@ private:
         AWAITING_MEDIA_DRIVER, REGISTERED_MEDIA_DRIVER, ERRORED_MEDIA_DRIVER
     };
 
-    struct PublicationStateDefn
+    /*
+     * Registration state is inserted by the application thread before the command is sent to the driver and is
+     * completed by the conductor thread. The conductor writes the resource, or the error, and then publishes the
+     * status with a release store so find* on any thread can read the rest of the state after an acquire load.
+     */
+    template<typename T>
+    struct RegistrationStateDefn
     {
-        std::string m_channel;
+        typedef std::function<void(std::int64_t, std::shared_ptr<T>, std::exception_ptr)> on_registered_t;
+
         std::int64_t m_registrationId;
-        std::int64_t m_originalRegistrationId = -1;
-        std::int32_t m_streamId;
-        std::int32_t m_sessionId = -1;
-        std::int32_t m_publicationLimitCounterId = -1;
-        std::int32_t m_channelStatusId = -1;
         long long m_timeOfRegistrationMs;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
+        std::atomic<RegistrationStatus> m_status;
         std::int32_t m_errorCode = -1;
         std::string m_errorMessage;
-        std::shared_ptr<LogBuffers> m_buffers;
-        std::weak_ptr<Publication> m_publication;
+        std::shared_ptr<T> m_resourceCache;
+        std::weak_ptr<T> m_resource;
+        std::atomic<bool> m_isCacheReleased;
+        on_registered_t m_onRegistered;
+
+        RegistrationStateDefn(std::int64_t registrationId, long long nowMs, const on_registered_t& onRegistered) :
+            m_registrationId(registrationId),
+            m_timeOfRegistrationMs(nowMs),
+            m_status(RegistrationStatus::AWAITING_MEDIA_DRIVER),
+            m_isCacheReleased(false),
+            m_onRegistered(onRegistered)
+        {
+        }
+
+        inline void releaseCache()
+        {
+            if (!m_isCacheReleased.exchange(true, std::memory_order_acq_rel))
+            {
+                m_resourceCache.reset();
+            }
+        }
+    };
+
+    struct PublicationStateDefn : RegistrationStateDefn<Publication>
+    {
+        std::string m_channel;
+        std::int32_t m_streamId;
 
         PublicationStateDefn(
-            const std::string& channel, std::int64_t registrationId, std::int32_t streamId, long long nowMs) :
+            const std::string& channel,
+            std::int64_t registrationId,
+            std::int32_t streamId,
+            long long nowMs,
+            const on_registered_t& onRegistered) :
+            RegistrationStateDefn<Publication>(registrationId, nowMs, onRegistered),
             m_channel(channel),
-            m_registrationId(registrationId),
-            m_streamId(streamId),
-            m_timeOfRegistrationMs(nowMs)
+            m_streamId(streamId)
         {
         }
     };
 
-    struct ExclusivePublicationStateDefn
+    struct ExclusivePublicationStateDefn : RegistrationStateDefn<ExclusivePublication>
     {
         std::string m_channel;
-        std::int64_t m_registrationId;
-        std::int64_t m_originalRegistrationId = -1;
         std::int32_t m_streamId;
-        std::int32_t m_sessionId = -1;
-        std::int32_t m_publicationLimitCounterId = -1;
-        std::int32_t m_channelStatusId = -1;
-        long long m_timeOfRegistrationMs;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
-        std::int32_t m_errorCode = -1;
-        std::string m_errorMessage;
-        std::shared_ptr<LogBuffers> m_buffers;
-        std::weak_ptr<ExclusivePublication> m_publication;
 
         ExclusivePublicationStateDefn(
-            const std::string& channel, std::int64_t registrationId, std::int32_t streamId, long long nowMs) :
+            const std::string& channel,
+            std::int64_t registrationId,
+            std::int32_t streamId,
+            long long nowMs,
+            const on_registered_t& onRegistered) :
+            RegistrationStateDefn<ExclusivePublication>(registrationId, nowMs, onRegistered),
             m_channel(channel),
-            m_registrationId(registrationId),
-            m_streamId(streamId),
-            m_timeOfRegistrationMs(nowMs)
+            m_streamId(streamId)
         {
         }
     };
 
-    struct SubscriptionStateDefn
+    struct SubscriptionStateDefn : RegistrationStateDefn<Subscription>
     {
         std::string m_channel;
-        std::int64_t m_registrationId;
         std::int32_t m_streamId;
-        long long m_timeOfRegistrationMs;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
-        std::int32_t m_errorCode = -1;
-        std::string m_errorMessage;
-        std::shared_ptr<Subscription> m_subscriptionCache;
-        std::weak_ptr<Subscription> m_subscription;
         on_available_image_t m_onAvailableImageHandler;
         on_unavailable_image_t m_onUnavailableImageHandler;
 
@@ -331,31 +388,37 @@ private:
             std::int32_t streamId,
             long long nowMs,
             const on_available_image_t &onAvailableImageHandler,
-            const on_unavailable_image_t &onUnavailableImageHandler) :
+            const on_unavailable_image_t &onUnavailableImageHandler,
+            const on_registered_t& onRegistered) :
+            RegistrationStateDefn<Subscription>(registrationId, nowMs, onRegistered),
             m_channel(channel),
-            m_registrationId(registrationId),
             m_streamId(streamId),
-            m_timeOfRegistrationMs(nowMs),
             m_onAvailableImageHandler(onAvailableImageHandler),
             m_onUnavailableImageHandler(onUnavailableImageHandler)
         {
         }
     };
 
-    struct CounterStateDefn
+    struct CounterStateDefn : RegistrationStateDefn<Counter>
     {
-        std::int64_t m_registrationId;
         std::int32_t m_counterId = -1;
+
+        CounterStateDefn(std::int64_t registrationId, long long nowMs, const on_registered_t& onRegistered) :
+            RegistrationStateDefn<Counter>(registrationId, nowMs, onRegistered)
+        {
+        }
+    };
+
+    struct DestinationStateDefn
+    {
+        std::int64_t m_correlationId;
         long long m_timeOfRegistrationMs;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
-        std::int32_t m_errorCode = -1;
-        std::string m_errorMessage;
-        std::shared_ptr<Counter> m_counterCache;
-        std::weak_ptr<Counter> m_counter;
+        on_destination_complete_t m_onComplete;
 
-        CounterStateDefn(std::int64_t registrationId, long long nowMs) :
-            m_registrationId(registrationId),
-            m_timeOfRegistrationMs(nowMs)
+        DestinationStateDefn(std::int64_t correlationId, long long nowMs, const on_destination_complete_t& onComplete) :
+            m_correlationId(correlationId),
+            m_timeOfRegistrationMs(nowMs),
+            m_onComplete(onComplete)
         {
         }
     };
@@ -384,13 +447,22 @@ private:
         }
     };
 
-    std::recursive_mutex m_adminLock;
+    typedef std::function<void()> conductor_command_t;
+
+    RegistrationMap<PublicationStateDefn> m_publicationByRegistrationId;
+    RegistrationMap<ExclusivePublicationStateDefn> m_exclusivePublicationByRegistrationId;
+    RegistrationMap<SubscriptionStateDefn> m_subscriptionByRegistrationId;
+    RegistrationMap<CounterStateDefn> m_counterByRegistrationId;
+    RegistrationMap<DestinationStateDefn> m_destinationByCorrelationId;
+    std::atomic<std::int64_t> m_pendingCompletionCount = { 0 };
 
-    std::unordered_map<std::int64_t, PublicationStateDefn> m_publicationByRegistrationId;
-    std::unordered_map<std::int64_t, ExclusivePublicationStateDefn> m_exclusivePublicationByRegistrationId;
-    std::unordered_map<std::int64_t, SubscriptionStateDefn> m_subscriptionByRegistrationId;
-    std::unordered_map<std::int64_t, CounterStateDefn> m_counterByRegistrationId;
+    ManyToOneConcurrentLinkedQueue<conductor_command_t> m_commandQueue;
 
+    /*
+     * Registrations nobody is waiting on any more, because an async add timed out or a batch failed part way, so the
+     * conductor can release whatever a late driver response creates.
+     */
+    std::unordered_set<std::int64_t> m_orphanedRegistrationIds;
     std::unordered_map<std::int64_t, LogBuffersDefn> m_logBuffersByRegistrationId;
     std::vector<ImageListLingerDefn> m_lingeringImageLists;
 
@@ -405,8 +477,10 @@ private:
     on_new_subscription_t m_onNewSubscriptionHandler;
     exception_handler_t m_errorHandler;
 
-    std::vector<on_available_counter_t> m_onAvailableCounterHandlers;
-    std::vector<on_unavailable_counter_t> m_onUnavailableCounterHandlers;
+    // copied on write under the lock so handlers are invoked without holding it and may add or remove handlers
+    std::mutex m_counterHandlersLock;
+    std::shared_ptr<const std::vector<on_available_counter_t>> m_onAvailableCounterHandlers;
+    std::shared_ptr<const std::vector<on_unavailable_counter_t>> m_onUnavailableCounterHandlers;
 
     epoch_clock_t m_epochClock;
     long long m_timeOfLastKeepaliveMs;
@@ -419,7 +493,8 @@ private:
     std::atomic<bool> m_driverActive;
     std::atomic<bool> m_isClosed;
     bool m_preTouchMappedMemory;
-    bool m_isInCallback = false;
+    bool m_useCommandBatching;
+    std::atomic<std::thread::id> m_callbackThreadId;
 
     inline int onHeartbeatCheckTimeouts()
     {
@@ -481,15 +556,262 @@ private:
         }
     }
 
+    inline int processCommands()
+    {
+        return m_commandQueue.drain([](conductor_command_t &command) { command(); });
+    }
+
     inline void ensureNotReentrant()
     {
-        if (m_isInCallback)
+        if (std::this_thread::get_id() == m_callbackThreadId.load(std::memory_order_acquire))
         {
             ReentrantException exception("client cannot be invoked within callback", SOURCEINFO);
             m_errorHandler(exception);
         }
     }
 
+    template<typename T>
+    std::shared_ptr<T> findResource(RegistrationStateDefn<T> &state)
+    {
+        std::shared_ptr<T> resource;
+
+        switch (state.m_status.load(std::memory_order_acquire))
+        {
+            case RegistrationStatus::AWAITING_MEDIA_DRIVER:
+                if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
+                {
+                    throw DriverTimeoutException(
+                        "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
+                }
+                break;
+
+            case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
+                resource = state.m_resource.lock();
+                state.releaseCache();
+                break;
+
+            case RegistrationStatus::ERRORED_MEDIA_DRIVER:
+                throw RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO);
+        }
+
+        return resource;
+    }
+
+    template<typename S>
+    bool setRegistrationError(
+        RegistrationMap<S> &map, std::int64_t registrationId, std::int32_t errorCode, const std::string &errorMessage)
+    {
+        S *state = map.find(registrationId);
+        if (nullptr == state)
+        {
+            return false;
+        }
+
+        state->m_errorCode = errorCode;
+        state->m_errorMessage = errorMessage;
+        state->m_status.store(RegistrationStatus::ERRORED_MEDIA_DRIVER, std::memory_order_release);
+
+        if (state->m_onRegistered)
+        {
+            completeRegistration(
+                *state, std::make_exception_ptr(RegistrationException(errorCode, errorMessage, SOURCEINFO)));
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    void completeRegistration(RegistrationStateDefn<T> &state, std::exception_ptr error)
+    {
+        typename RegistrationStateDefn<T>::on_registered_t onRegistered = std::move(state.m_onRegistered);
+        state.m_onRegistered = nullptr;
+        m_pendingCompletionCount.fetch_sub(1, std::memory_order_acq_rel);
+
+        std::shared_ptr<T> resource;
+        if (nullptr == error)
+        {
+            resource = state.m_resource.lock();
+            state.releaseCache();
+        }
+
+        CallbackGuard callbackGuard(m_callbackThreadId);
+        onRegistered(state.m_registrationId, resource, error);
+    }
+
+    template<typename S>
+    void checkRegistrationTimeouts(RegistrationMap<S> &map, long long nowMs)
+    {
+        map.forEach(
+            [&](std::int64_t registrationId, S &state)
+            {
+                if (state.m_onRegistered &&
+                    RegistrationStatus::AWAITING_MEDIA_DRIVER == state.m_status.load(std::memory_order_acquire) &&
+                    nowMs > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
+                {
+                    map.remove(registrationId);
+                    m_orphanedRegistrationIds.insert(registrationId);
+                    completeRegistration(state, std::make_exception_ptr(DriverTimeoutException(
+                        "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO)));
+                }
+            });
+    }
+
+    inline bool removeOrphanedRegistration(std::int64_t registrationId)
+    {
+        return m_orphanedRegistrationIds.erase(registrationId) > 0;
+    }
+
+    template<typename S>
+    void releaseOrphanedRegistrations(RegistrationMap<S> &map, const std::vector<std::int64_t> &registrationIds)
+    {
+        for (std::int64_t registrationId : registrationIds)
+        {
+            S *state = map.find(registrationId);
+            if (nullptr == state)
+            {
+                continue;
+            }
+
+            switch (state->m_status.load(std::memory_order_acquire))
+            {
+                case RegistrationStatus::AWAITING_MEDIA_DRIVER:
+                    map.remove(registrationId);
+                    m_orphanedRegistrationIds.insert(registrationId);
+                    break;
+
+                case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
+                    // the resource sends its own remove to the driver when the cached reference is dropped
+                    state->releaseCache();
+                    break;
+
+                case RegistrationStatus::ERRORED_MEDIA_DRIVER:
+                    map.remove(registrationId);
+                    break;
+            }
+        }
+    }
+
+    template<typename S>
+    void failPendingRegistration(S &state, const std::string &reason)
+    {
+        if (state.m_onRegistered)
+        {
+            completeRegistration(state, std::make_exception_ptr(AeronException(reason, SOURCEINFO)));
+        }
+    }
+
+    void completeDestination(DestinationStateDefn &state, std::exception_ptr error)
+    {
+        m_pendingCompletionCount.fetch_sub(1, std::memory_order_acq_rel);
+
+        CallbackGuard callbackGuard(m_callbackThreadId);
+        state.m_onComplete(state.m_correlationId, error);
+    }
+
+    template<typename S, typename E, typename F>
+    std::int64_t addRegistration(RegistrationMap<S> &map, bool isAsync, E&& emplacer, F&& sender)
+    {
+        const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+        if (isAsync)
+        {
+            m_pendingCompletionCount.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        emplacer(registrationId);
+
+        try
+        {
+            sender(registrationId);
+        }
+        catch (...)
+        {
+            if (nullptr != map.remove(registrationId) && isAsync)
+            {
+                m_pendingCompletionCount.fetch_sub(1, std::memory_order_acq_rel);
+            }
+            throw;
+        }
+
+        return registrationId;
+    }
+
+    template<typename S, typename E, typename F>
+    std::vector<std::int64_t> addRegistrations(
+        RegistrationMap<S> &map, std::size_t count, bool isAsync, E&& emplacer, F&& sender)
+    {
+        std::vector<std::int64_t> registrationIds;
+        registrationIds.reserve(count);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+            if (isAsync)
+            {
+                m_pendingCompletionCount.fetch_add(1, std::memory_order_acq_rel);
+            }
+
+            emplacer(i, registrationId);
+            registrationIds.push_back(registrationId);
+        }
+
+        std::size_t writtenCount = 0;
+        try
+        {
+            sender(registrationIds, writtenCount);
+        }
+        catch (...)
+        {
+            for (std::size_t i = writtenCount; i < count; i++)
+            {
+                if (nullptr != map.remove(registrationIds[i]) && isAsync)
+                {
+                    m_pendingCompletionCount.fetch_sub(1, std::memory_order_acq_rel);
+                }
+            }
+
+            // async adds that were sent still complete through their callback, sync ones have nobody to find them
+            if (!isAsync && writtenCount > 0)
+            {
+                std::vector<std::int64_t> writtenIds(registrationIds.begin(), registrationIds.begin() + writtenCount);
+                m_commandQueue.offer(
+                    [this, &map, writtenIds]() { releaseOrphanedRegistrations(map, writtenIds); });
+            }
+            throw;
+        }
+
+        return registrationIds;
+    }
+
+    template<typename F>
+    std::int64_t sendDestinationCommand(const on_destination_complete_t &onComplete, F&& sender)
+    {
+        verifyDriverIsActive();
+        ensureNotReentrant();
+        ensureOpen();
+
+        const std::int64_t correlationId = m_driverProxy.nextCorrelationId();
+        if (onComplete)
+        {
+            m_pendingCompletionCount.fetch_add(1, std::memory_order_acq_rel);
+            m_destinationByCorrelationId.emplace(correlationId, correlationId, m_epochClock(), onComplete);
+        }
+
+        try
+        {
+            sender(correlationId);
+        }
+        catch (...)
+        {
+            if (onComplete && nullptr != m_destinationByCorrelationId.remove(correlationId))
+            {
+                m_pendingCompletionCount.fetch_sub(1, std::memory_order_acq_rel);
+            }
+            throw;
+        }
+
+        return correlationId;
+    }
+
     inline std::shared_ptr<LogBuffers> getLogBuffers(std::int64_t registrationId, const std::string& logFilename)
     {
         auto it = m_logBuffersByRegistrationId.find(registrationId);
@@ -18,6 +18,8 @@
 #define AERON_CONTEXT_H
 
 #include <memory>
+#include <exception>
+#include <functional>
 #include <util/Exceptions.h>
 #include <concurrent/AgentRunner.h>
 #include <concurrent/broadcast/CopyBroadcastReceiver.h>
@@ -32,6 +34,10 @@ using namespace aeron::concurrent::broadcast;
 using namespace aeron::concurrent;
 
 class Image;
+class Publication;
+class ExclusivePublication;
+class Subscription;
+class Counter;
 
 /**
  * Used to represent a null value for when some value is not yet set.
@@ -125,6 +131,78 @@ typedef std::function<void(
     std::int64_t registrationId,
     std::int32_t counterId)> on_unavailable_counter_t;
 
+/**
+ * Function called by Aeron when an asynchronous add of a Publication completes.
+ *
+ * On success the publication is passed and error is null. On failure the publication is null and error holds the
+ * RegistrationException or DriverTimeoutException that Aeron::findPublication would have thrown. The handler must
+ * keep a reference to the publication, otherwise it is closed once the handler returns.
+ *
+ * The function is called on the client conductor thread and should not make a reentrant call back into the Aeron
+ * instance.
+ *
+ * @param registrationId returned by Aeron::asyncAddPublication.
+ * @param publication    that has been added or nullptr on failure.
+ * @param error          cause of the failure or nullptr on success.
+ */
+typedef std::function<void(
+    std::int64_t registrationId,
+    std::shared_ptr<Publication> publication,
+    std::exception_ptr error)> on_publication_registered_t;
+
+/**
+ * Function called by Aeron when an asynchronous add of an ExclusivePublication completes.
+ *
+ * @see on_publication_registered_t
+ *
+ * @param registrationId returned by Aeron::asyncAddExclusivePublication.
+ * @param publication    that has been added or nullptr on failure.
+ * @param error          cause of the failure or nullptr on success.
+ */
+typedef std::function<void(
+    std::int64_t registrationId,
+    std::shared_ptr<ExclusivePublication> publication,
+    std::exception_ptr error)> on_exclusive_publication_registered_t;
+
+/**
+ * Function called by Aeron when an asynchronous add of a Subscription completes.
+ *
+ * @see on_publication_registered_t
+ *
+ * @param registrationId returned by Aeron::asyncAddSubscription.
+ * @param subscription   that has been added or nullptr on failure.
+ * @param error          cause of the failure or nullptr on success.
+ */
+typedef std::function<void(
+    std::int64_t registrationId,
+    std::shared_ptr<Subscription> subscription,
+    std::exception_ptr error)> on_subscription_registered_t;
+
+/**
+ * Function called by Aeron when an asynchronous add of a Counter completes.
+ *
+ * @see on_publication_registered_t
+ *
+ * @param registrationId returned by Aeron::asyncAddCounter.
+ * @param counter        that has been added or nullptr on failure.
+ * @param error          cause of the failure or nullptr on success.
+ */
+typedef std::function<void(
+    std::int64_t registrationId,
+    std::shared_ptr<Counter> counter,
+    std::exception_ptr error)> on_counter_registered_t;
+
+/**
+ * Function called by Aeron when the media driver has answered an add or remove of a destination.
+ *
+ * The function is called on the client conductor thread and should not make a reentrant call back into the Aeron
+ * instance.
+ *
+ * @param correlationId of the destination command.
+ * @param error         cause of the failure or nullptr on success.
+ */
+typedef std::function<void(std::int64_t correlationId, std::exception_ptr error)> on_destination_complete_t;
+
 const static long NULL_TIMEOUT = -1;
 const static long DEFAULT_MEDIA_DRIVER_TIMEOUT_MS = 10000;
 const static long DEFAULT_RESOURCE_LINGER_MS = 5000;
@@ -391,6 +469,19 @@ public:
         return *this;
     }
 
+    /**
+     * Set whether commands added together, such as with Aeron::asyncAddPublications, are sent to the media driver
+     * packed into batch messages. The media driver must support command batches.
+     *
+     * @param useCommandBatching true to pack commands added together into batches otherwise false.
+     * @return reference to this Context instance
+     */
+    inline this_t& useCommandBatching(bool useCommandBatching)
+    {
+        m_useCommandBatching = useCommandBatching;
+        return *this;
+    }
+
     static void requestDriverTermination(
         const std::string& directory, const std::uint8_t *tokenBuffer, std::size_t tokenLength);
 
@@ -465,6 +556,7 @@ private:
     bool m_useConductorAgentInvoker = false;
     bool m_isOnNewExclusivePublicationHandlerSet = false;
     bool m_preTouchMappedMemory = false;
+    bool m_useCommandBatching = false;
 };
 
 }
@@ -17,6 +17,8 @@
 #define AERON_CONTROLLEDFRAGMENTASSEMBLER_H
 
 #include <unordered_map>
+#include <type_traits>
+#include <utility>
 #include "Aeron.h"
 #include "BufferBuilder.h"
 
@@ -34,8 +36,15 @@ static const std::size_t DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 40
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate is held as its own type H and called directly, so when the assembler is passed straight to
+ * Subscription::poll or Image::poll, rather than through {@link #handler()}, the whole fragment path can be inlined.
+ * {@link ControlledFragmentAssembler} is the specialisation for {@link controlled_poll_fragment_handler_t}.
+ *
+ * @tparam H type of the delegate onto which whole messages are forwarded.
  */
-class ControlledFragmentAssembler
+template <typename H>
+class BasicControlledFragmentAssembler
 {
 public:
 
@@ -45,8 +54,8 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    ControlledFragmentAssembler(
-        const controlled_poll_fragment_handler_t& delegate,
+    BasicControlledFragmentAssembler(
+        const H& delegate,
         size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
         m_initialBufferLength(initialBufferLength),
         m_delegate(delegate)
@@ -67,6 +76,16 @@ public:
         };
     }
 
+    /**
+     * Reassemble a fragment and delegate on whole messages. Allows the assembler to be passed by reference to
+     * Subscription::poll or Image::poll in place of {@link #handler()}.
+     */
+    inline ControlledPollAction operator()(
+        AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        return this->onFragment(buffer, offset, length, header);
+    }
+
     /**
      * Free an existing session buffer to reduce memory pressure when an Image goes inactive or no more
      * large messages are expected.
@@ -80,7 +99,7 @@ public:
 
 private:
     const std::size_t m_initialBufferLength;
-    controlled_poll_fragment_handler_t m_delegate;
+    H m_delegate;
     std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
 
     ControlledPollAction onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
@@ -155,5 +174,22 @@ private:
     }
 };
 
+typedef BasicControlledFragmentAssembler<controlled_poll_fragment_handler_t> ControlledFragmentAssembler;
+
+/**
+ * Construct a BasicControlledFragmentAssembler for the type of the delegate so it can be called without indirection.
+ *
+ * @param delegate            onto which whole messages are forwarded.
+ * @param initialBufferLength to be used for each session.
+ * @return the assembler for the delegate.
+ */
+template <typename H>
+inline BasicControlledFragmentAssembler<typename std::decay<H>::type> makeControlledFragmentAssembler(
+    H&& delegate, size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH)
+{
+    return BasicControlledFragmentAssembler<typename std::decay<H>::type>(
+        std::forward<H>(delegate), initialBufferLength);
+}
+
 }
 #endif
@@ -27,6 +27,7 @@
 #include <command/SubscriptionReadyFlyweight.h>
 #include <command/CounterUpdateFlyweight.h>
 #include <command/ClientTimeoutFlyweight.h>
+#include <command/BatchMessageFlyweight.h>
 
 namespace aeron {
 
@@ -49,124 +50,164 @@ public:
         return m_broadcastReceiver.receive(
             [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
             {
-                switch (msgTypeId)
-                {
-                    case ControlProtocolEvents::ON_PUBLICATION_READY:
-                    {
-                        const PublicationBuffersReadyFlyweight publicationReady(buffer, offset);
-
-                        m_driverListener.onNewPublication(
-                            publicationReady.correlationId(),
-                            publicationReady.registrationId(),
-                            publicationReady.streamId(),
-                            publicationReady.sessionId(),
-                            publicationReady.positionLimitCounterId(),
-                            publicationReady.channelStatusIndicatorId(),
-                            publicationReady.logFileName());
-                        break;
-                    }
+                onMessage(msgTypeId, buffer, offset, length);
+            });
+    }
 
-                    case ControlProtocolEvents::ON_EXCLUSIVE_PUBLICATION_READY:
-                    {
-                        const PublicationBuffersReadyFlyweight publicationReady(buffer, offset);
-
-                        m_driverListener.onNewExclusivePublication(
-                            publicationReady.correlationId(),
-                            publicationReady.registrationId(),
-                            publicationReady.streamId(),
-                            publicationReady.sessionId(),
-                            publicationReady.positionLimitCounterId(),
-                            publicationReady.channelStatusIndicatorId(),
-                            publicationReady.logFileName());
-                        break;
-                    }
+private:
+    CopyBroadcastReceiver& m_broadcastReceiver;
+    DriverListener& m_driverListener;
 
-                    case ControlProtocolEvents::ON_SUBSCRIPTION_READY:
-                    {
-                        const SubscriptionReadyFlyweight subscriptionReady(buffer, offset);
+    void onMessage(std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        switch (msgTypeId)
+        {
+            case ControlProtocolEvents::ON_PUBLICATION_READY:
+            {
+                const PublicationBuffersReadyFlyweight publicationReady(buffer, offset);
+
+                m_driverListener.onNewPublication(
+                    publicationReady.correlationId(),
+                    publicationReady.registrationId(),
+                    publicationReady.streamId(),
+                    publicationReady.sessionId(),
+                    publicationReady.positionLimitCounterId(),
+                    publicationReady.channelStatusIndicatorId(),
+                    publicationReady.logFileName());
+                break;
+            }
+
+            case ControlProtocolEvents::ON_EXCLUSIVE_PUBLICATION_READY:
+            {
+                const PublicationBuffersReadyFlyweight publicationReady(buffer, offset);
+
+                m_driverListener.onNewExclusivePublication(
+                    publicationReady.correlationId(),
+                    publicationReady.registrationId(),
+                    publicationReady.streamId(),
+                    publicationReady.sessionId(),
+                    publicationReady.positionLimitCounterId(),
+                    publicationReady.channelStatusIndicatorId(),
+                    publicationReady.logFileName());
+                break;
+            }
+
+            case ControlProtocolEvents::ON_SUBSCRIPTION_READY:
+            {
+                const SubscriptionReadyFlyweight subscriptionReady(buffer, offset);
 
-                        m_driverListener.onSubscriptionReady(
-                            subscriptionReady.correlationId(),
-                            subscriptionReady.channelStatusIndicatorId());
-                        break;
-                    }
+                m_driverListener.onSubscriptionReady(
+                    subscriptionReady.correlationId(),
+                    subscriptionReady.channelStatusIndicatorId());
+                break;
+            }
 
-                    case ControlProtocolEvents::ON_AVAILABLE_IMAGE:
-                    {
-                        const ImageBuffersReadyFlyweight imageReady(buffer, offset);
-
-                        m_driverListener.onAvailableImage(
-                            imageReady.correlationId(),
-                            imageReady.sessionId(),
-                            imageReady.subscriberPositionId(),
-                            imageReady.subscriptionRegistrationId(),
-                            imageReady.logFileName(),
-                            imageReady.sourceIdentity());
-                        break;
-                    }
+            case ControlProtocolEvents::ON_AVAILABLE_IMAGE:
+            {
+                const ImageBuffersReadyFlyweight imageReady(buffer, offset);
+
+                m_driverListener.onAvailableImage(
+                    imageReady.correlationId(),
+                    imageReady.sessionId(),
+                    imageReady.subscriberPositionId(),
+                    imageReady.subscriptionRegistrationId(),
+                    imageReady.logFileName(),
+                    imageReady.sourceIdentity());
+                break;
+            }
+
+            case ControlProtocolEvents::ON_OPERATION_SUCCESS:
+            {
+                const OperationSucceededFlyweight operationSucceeded(buffer, offset);
 
-                    case ControlProtocolEvents::ON_OPERATION_SUCCESS:
-                    {
-                        const OperationSucceededFlyweight operationSucceeded(buffer, offset);
+                m_driverListener.onOperationSuccess(operationSucceeded.correlationId());
+                break;
+            }
 
-                        m_driverListener.onOperationSuccess(operationSucceeded.correlationId());
-                        break;
-                    }
+            case ControlProtocolEvents::ON_UNAVAILABLE_IMAGE:
+            {
+                const ImageMessageFlyweight imageMessage(buffer, offset);
 
-                    case ControlProtocolEvents::ON_UNAVAILABLE_IMAGE:
-                    {
-                        const ImageMessageFlyweight imageMessage(buffer, offset);
+                m_driverListener.onUnavailableImage(
+                    imageMessage.correlationId(),
+                    imageMessage.subscriptionRegistrationId());
+                break;
+            }
 
-                        m_driverListener.onUnavailableImage(
-                            imageMessage.correlationId(),
-                            imageMessage.subscriptionRegistrationId());
-                        break;
-                    }
+            case ControlProtocolEvents::ON_ERROR:
+            {
+                const ErrorResponseFlyweight errorResponse(buffer, offset);
 
-                    case ControlProtocolEvents::ON_ERROR:
-                    {
-                        const ErrorResponseFlyweight errorResponse(buffer, offset);
+                m_driverListener.onErrorResponse(
+                    errorResponse.offendingCommandCorrelationId(),
+                    errorResponse.errorCode(),
+                    errorResponse.errorMessage());
+                break;
+            }
 
-                        m_driverListener.onErrorResponse(
-                            errorResponse.offendingCommandCorrelationId(),
-                            errorResponse.errorCode(),
-                            errorResponse.errorMessage());
-                        break;
-                    }
+            case ControlProtocolEvents::ON_COUNTER_READY:
+            {
+                const CounterUpdateFlyweight response(buffer, offset);
 
-                    case ControlProtocolEvents::ON_COUNTER_READY:
-                    {
-                        const CounterUpdateFlyweight response(buffer, offset);
+                m_driverListener.onAvailableCounter(response.correlationId(), response.counterId());
+                break;
+            }
 
-                        m_driverListener.onAvailableCounter(response.correlationId(), response.counterId());
+            case ControlProtocolEvents::ON_UNAVAILABLE_COUNTER:
+            {
+                const CounterUpdateFlyweight response(buffer, offset);
+
+                m_driverListener.onUnavailableCounter(response.correlationId(), response.counterId());
+                break;
+            }
+
+            case ControlProtocolEvents::ON_CLIENT_TIMEOUT:
+            {
+                const ClientTimeoutFlyweight response(buffer, offset);
+
+                m_driverListener.onClientTimeout(response.clientId());
+                break;
+            }
+
+            case ControlProtocolEvents::ON_BATCH:
+            {
+                const BatchMessageFlyweight batch(buffer, offset);
+                const std::int32_t entryCount = batch.entryCount();
+                util::index_t entryOffset = BatchMessageFlyweight::firstEntryOffset();
+
+                for (std::int32_t i = 0; i < entryCount; i++)
+                {
+                    if (BatchMessageFlyweight::entryMessageOffset(entryOffset) > length)
+                    {
                         break;
                     }
 
-                    case ControlProtocolEvents::ON_UNAVAILABLE_COUNTER:
-                    {
-                        const CounterUpdateFlyweight response(buffer, offset);
+                    const std::int32_t entryMsgTypeId = batch.entryMsgTypeId(entryOffset);
+                    const util::index_t entryLength = batch.entryLength(entryOffset);
 
-                        m_driverListener.onUnavailableCounter(response.correlationId(), response.counterId());
+                    if (entryLength < 0 || BatchMessageFlyweight::entryEndOffset(entryOffset, entryLength) > length)
+                    {
                         break;
                     }
 
-                    case ControlProtocolEvents::ON_CLIENT_TIMEOUT:
+                    if (ControlProtocolEvents::ON_BATCH != entryMsgTypeId)
                     {
-                        const ClientTimeoutFlyweight response(buffer, offset);
-
-                        m_driverListener.onClientTimeout(response.clientId());
-                        break;
+                        onMessage(
+                            entryMsgTypeId,
+                            buffer,
+                            offset + BatchMessageFlyweight::entryMessageOffset(entryOffset),
+                            entryLength);
                     }
 
-                    default:
-                        break;
+                    entryOffset = BatchMessageFlyweight::nextEntryOffset(entryOffset, entryLength);
                 }
-            });
-    }
+                break;
+            }
 
-private:
-    CopyBroadcastReceiver& m_broadcastReceiver;
-    DriverListener& m_driverListener;
+            default:
+                break;
+        }
+    }
 };
 
 }
@@ -18,6 +18,8 @@
 #define AERON_DRIVER_PROXY_H
 
 #include <array>
+#include <algorithm>
+#include <vector>
 #include <concurrent/ringbuffer/ManyToOneRingBuffer.h>
 #include <command/PublicationMessageFlyweight.h>
 #include <command/RemoveMessageFlyweight.h>
@@ -25,6 +27,7 @@
 #include <command/DestinationMessageFlyweight.h>
 #include <command/CounterMessageFlyweight.h>
 #include <command/TerminateDriverFlyweight.h>
+#include <command/BatchMessageFlyweight.h>
 #include <command/ControlProtocolEvents.h>
 
 namespace aeron {
@@ -55,20 +58,21 @@ public:
         return m_clientId;
     }
 
+    inline std::int64_t nextCorrelationId()
+    {
+        return m_toDriverCommandBuffer.nextCorrelationId();
+    }
+
     std::int64_t addPublication(const std::string& channel, std::int32_t streamId)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
+        return addPublication(m_toDriverCommandBuffer.nextCorrelationId(), channel, streamId);
+    }
 
+    std::int64_t addPublication(std::int64_t correlationId, const std::string& channel, std::int32_t streamId)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
-            PublicationMessageFlyweight publicationMessage(buffer, 0);
-
-            publicationMessage.clientId(m_clientId);
-            publicationMessage.correlationId(correlationId);
-            publicationMessage.streamId(streamId);
-            publicationMessage.channel(channel);
-
-            length = publicationMessage.length();
+            length = encodePublication(buffer, correlationId, channel, streamId);
 
             return ControlProtocolEvents::ADD_PUBLICATION;
         });
@@ -78,18 +82,14 @@ public:
 
     std::int64_t addExclusivePublication(const std::string& channel, std::int32_t streamId)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
+        return addExclusivePublication(m_toDriverCommandBuffer.nextCorrelationId(), channel, streamId);
+    }
 
+    std::int64_t addExclusivePublication(std::int64_t correlationId, const std::string& channel, std::int32_t streamId)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
-            PublicationMessageFlyweight publicationMessage(buffer, 0);
-
-            publicationMessage.clientId(m_clientId);
-            publicationMessage.correlationId(correlationId);
-            publicationMessage.streamId(streamId);
-            publicationMessage.channel(channel);
-
-            length = publicationMessage.length();
+            length = encodePublication(buffer, correlationId, channel, streamId);
 
             return ControlProtocolEvents::ADD_EXCLUSIVE_PUBLICATION;
         });
@@ -119,19 +119,14 @@ public:
 
     std::int64_t addSubscription(const std::string& channel, std::int32_t streamId)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
+        return addSubscription(m_toDriverCommandBuffer.nextCorrelationId(), channel, streamId);
+    }
 
+    std::int64_t addSubscription(std::int64_t correlationId, const std::string& channel, std::int32_t streamId)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
-            SubscriptionMessageFlyweight subscriptionMessage(buffer, 0);
-
-            subscriptionMessage.clientId(m_clientId);
-            subscriptionMessage.registrationCorrelationId(-1);
-            subscriptionMessage.correlationId(correlationId);
-            subscriptionMessage.streamId(streamId);
-            subscriptionMessage.channel(channel);
-
-            length = subscriptionMessage.length();
+            length = encodeSubscription(buffer, correlationId, channel, streamId);
 
             return ControlProtocolEvents::ADD_SUBSCRIPTION;
         });
@@ -139,6 +134,78 @@ public:
         return correlationId;
     }
 
+    /**
+     * Send an add publication command for each channel and stream, packed into as few messages as the ring buffer
+     * allows.
+     *
+     * @param correlationIds for the publications, one for each channel and stream.
+     * @param channelStreams pairs of channel and stream id.
+     * @param writtenCount   set to how many of the commands, from the first, were written to the driver. This is
+     *                       short of the full count when the ring buffer fills up and an exception is thrown.
+     */
+    void addPublications(
+        const std::vector<std::int64_t>& correlationIds,
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        std::size_t& writtenCount)
+    {
+        writeCommandBatchToDriver(channelStreams.size(), writtenCount,
+            [&](std::size_t index, AtomicBuffer &buffer, util::index_t &length)
+            {
+                length = encodePublication(
+                    buffer, correlationIds[index], channelStreams[index].first, channelStreams[index].second);
+
+                return ControlProtocolEvents::ADD_PUBLICATION;
+            });
+    }
+
+    /**
+     * Send an add exclusive publication command for each channel and stream, packed into as few messages as the ring
+     * buffer allows.
+     *
+     * @param correlationIds for the publications, one for each channel and stream.
+     * @param channelStreams pairs of channel and stream id.
+     * @param writtenCount   set to how many of the commands, from the first, were written to the driver. This is
+     *                       short of the full count when the ring buffer fills up and an exception is thrown.
+     */
+    void addExclusivePublications(
+        const std::vector<std::int64_t>& correlationIds,
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        std::size_t& writtenCount)
+    {
+        writeCommandBatchToDriver(channelStreams.size(), writtenCount,
+            [&](std::size_t index, AtomicBuffer &buffer, util::index_t &length)
+            {
+                length = encodePublication(
+                    buffer, correlationIds[index], channelStreams[index].first, channelStreams[index].second);
+
+                return ControlProtocolEvents::ADD_EXCLUSIVE_PUBLICATION;
+            });
+    }
+
+    /**
+     * Send an add subscription command for each channel and stream, packed into as few messages as the ring buffer
+     * allows.
+     *
+     * @param correlationIds for the subscriptions, one for each channel and stream.
+     * @param channelStreams pairs of channel and stream id.
+     * @param writtenCount   set to how many of the commands, from the first, were written to the driver. This is
+     *                       short of the full count when the ring buffer fills up and an exception is thrown.
+     */
+    void addSubscriptions(
+        const std::vector<std::int64_t>& correlationIds,
+        const std::vector<std::pair<std::string, std::int32_t>>& channelStreams,
+        std::size_t& writtenCount)
+    {
+        writeCommandBatchToDriver(channelStreams.size(), writtenCount,
+            [&](std::size_t index, AtomicBuffer &buffer, util::index_t &length)
+            {
+                length = encodeSubscription(
+                    buffer, correlationIds[index], channelStreams[index].first, channelStreams[index].second);
+
+                return ControlProtocolEvents::ADD_SUBSCRIPTION;
+            });
+    }
+
     std::int64_t removeSubscription(std::int64_t registrationId)
     {
         std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
@@ -175,8 +242,12 @@ public:
 
     std::int64_t addDestination(std::int64_t publicationRegistrationId, const std::string& channel)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
+        return addDestination(m_toDriverCommandBuffer.nextCorrelationId(), publicationRegistrationId, channel);
+    }
 
+    std::int64_t addDestination(
+        std::int64_t correlationId, std::int64_t publicationRegistrationId, const std::string& channel)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
             DestinationMessageFlyweight addMessage(buffer, 0);
@@ -196,8 +267,12 @@ public:
 
     std::int64_t removeDestination(std::int64_t publicationRegistrationId, const std::string& channel)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
+        return removeDestination(m_toDriverCommandBuffer.nextCorrelationId(), publicationRegistrationId, channel);
+    }
 
+    std::int64_t removeDestination(
+        std::int64_t correlationId, std::int64_t publicationRegistrationId, const std::string& channel)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
             DestinationMessageFlyweight removeMessage(buffer, 0);
@@ -217,8 +292,12 @@ public:
 
     std::int64_t addRcvDestination(std::int64_t subscriptionRegistrationId, const std::string& channel)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
+        return addRcvDestination(m_toDriverCommandBuffer.nextCorrelationId(), subscriptionRegistrationId, channel);
+    }
 
+    std::int64_t addRcvDestination(
+        std::int64_t correlationId, std::int64_t subscriptionRegistrationId, const std::string& channel)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
             DestinationMessageFlyweight addMessage(buffer, 0);
@@ -238,8 +317,12 @@ public:
 
     std::int64_t removeRcvDestination(std::int64_t subscriptionRegistrationId, const std::string& channel)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
+        return removeRcvDestination(m_toDriverCommandBuffer.nextCorrelationId(), subscriptionRegistrationId, channel);
+    }
 
+    std::int64_t removeRcvDestination(
+        std::int64_t correlationId, std::int64_t subscriptionRegistrationId, const std::string& channel)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
             DestinationMessageFlyweight removeMessage(buffer, 0);
@@ -259,8 +342,16 @@ public:
 
     std::int64_t addCounter(std::int32_t typeId, const std::uint8_t *key, std::size_t keyLength, const std::string& label)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
+        return addCounter(m_toDriverCommandBuffer.nextCorrelationId(), typeId, key, keyLength, label);
+    }
 
+    std::int64_t addCounter(
+        std::int64_t correlationId,
+        std::int32_t typeId,
+        const std::uint8_t *key,
+        std::size_t keyLength,
+        const std::string& label)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
             CounterMessageFlyweight command(buffer, 0);
@@ -336,10 +427,38 @@ public:
 
 private:
     typedef std::array<std::uint8_t, 512> driver_proxy_command_buffer_t;
+    typedef std::array<std::uint8_t, 4096> driver_proxy_batch_buffer_t;
 
     ManyToOneRingBuffer& m_toDriverCommandBuffer;
     std::int64_t m_clientId;
 
+    inline util::index_t encodePublication(
+        AtomicBuffer &buffer, std::int64_t correlationId, const std::string& channel, std::int32_t streamId)
+    {
+        PublicationMessageFlyweight publicationMessage(buffer, 0);
+
+        publicationMessage.clientId(m_clientId);
+        publicationMessage.correlationId(correlationId);
+        publicationMessage.streamId(streamId);
+        publicationMessage.channel(channel);
+
+        return publicationMessage.length();
+    }
+
+    inline util::index_t encodeSubscription(
+        AtomicBuffer &buffer, std::int64_t correlationId, const std::string& channel, std::int32_t streamId)
+    {
+        SubscriptionMessageFlyweight subscriptionMessage(buffer, 0);
+
+        subscriptionMessage.clientId(m_clientId);
+        subscriptionMessage.registrationCorrelationId(-1);
+        subscriptionMessage.correlationId(correlationId);
+        subscriptionMessage.streamId(streamId);
+        subscriptionMessage.channel(channel);
+
+        return subscriptionMessage.length();
+    }
+
     template <typename Filler>
     inline void writeCommandToDriver(Filler&& filler)
     {
@@ -354,6 +473,77 @@ private:
             throw util::IllegalStateException("couldn't write command to driver", SOURCEINFO);
         }
     }
+
+    /*
+     * Commands are packed into a batch message until the next one does not fit, at which point the batch is written
+     * and a new one started. A batch holding a single command is written as that command on its own. writtenCount
+     * only counts commands in batches the ring buffer has accepted, so a caller can tell which were sent on a throw.
+     */
+    template <typename Filler>
+    inline void writeCommandBatchToDriver(std::size_t count, std::size_t& writtenCount, Filler&& filler)
+    {
+        AERON_DECL_ALIGNED(driver_proxy_command_buffer_t messageBuffer, 16);
+        AERON_DECL_ALIGNED(driver_proxy_batch_buffer_t batchBuffer, 16);
+        AtomicBuffer buffer(messageBuffer);
+        AtomicBuffer batch(batchBuffer);
+        BatchMessageFlyweight batchMessage(batch, 0);
+        const util::index_t batchCapacity = std::min(batch.capacity(), m_toDriverCommandBuffer.maxMsgLength());
+        std::int32_t entryCount = 0;
+        util::index_t entryOffset = BatchMessageFlyweight::firstEntryOffset();
+        util::index_t batchLength = entryOffset;
+        writtenCount = 0;
+
+        auto flush = [&]()
+        {
+            bool isWritten = true;
+
+            if (1 == entryCount)
+            {
+                const util::index_t firstEntryOffset = BatchMessageFlyweight::firstEntryOffset();
+
+                isWritten = m_toDriverCommandBuffer.write(
+                    batchMessage.entryMsgTypeId(firstEntryOffset),
+                    batch,
+                    BatchMessageFlyweight::entryMessageOffset(firstEntryOffset),
+                    batchMessage.entryLength(firstEntryOffset));
+            }
+            else if (entryCount > 1)
+            {
+                batchMessage.clientId(m_clientId);
+                batchMessage.correlationId(m_toDriverCommandBuffer.nextCorrelationId());
+                batchMessage.entryCount(entryCount);
+
+                isWritten = m_toDriverCommandBuffer.write(ControlProtocolEvents::COMMAND_BATCH, batch, 0, batchLength);
+            }
+
+            if (!isWritten)
+            {
+                throw util::IllegalStateException("couldn't write command batch to driver", SOURCEINFO);
+            }
+
+            writtenCount += static_cast<std::size_t>(entryCount);
+            entryCount = 0;
+            entryOffset = BatchMessageFlyweight::firstEntryOffset();
+            batchLength = entryOffset;
+        };
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            util::index_t length = buffer.capacity();
+            const std::int32_t msgTypeId = filler(i, buffer, length);
+
+            if (BatchMessageFlyweight::entryEndOffset(entryOffset, length) > batchCapacity)
+            {
+                flush();
+            }
+
+            batchLength = batchMessage.putEntry(entryOffset, msgTypeId, buffer.buffer(), length);
+            entryOffset = BatchMessageFlyweight::nextEntryOffset(entryOffset, length);
+            entryCount++;
+        }
+
+        flush();
+    }
 };
 
 }
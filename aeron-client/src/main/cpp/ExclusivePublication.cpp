@@ -82,6 +82,17 @@ void ExclusivePublication::addDestination(const std::string& endpointChannel)
     m_conductor.addDestination(m_originalRegistrationId, endpointChannel);
 }
 
+std::int64_t ExclusivePublication::addDestination(
+    const std::string& endpointChannel, const on_destination_complete_t& onComplete)
+{
+    if (isClosed())
+    {
+        throw util::IllegalStateException(std::string("Publication is closed"), SOURCEINFO);
+    }
+
+    return m_conductor.addDestination(m_originalRegistrationId, endpointChannel, onComplete);
+}
+
 void ExclusivePublication::removeDestination(const std::string& endpointChannel)
 {
     if (isClosed())
@@ -92,6 +103,17 @@ void ExclusivePublication::removeDestination(const std::string& endpointChannel)
     m_conductor.removeDestination(m_originalRegistrationId, endpointChannel);
 }
 
+std::int64_t ExclusivePublication::removeDestination(
+    const std::string& endpointChannel, const on_destination_complete_t& onComplete)
+{
+    if (isClosed())
+    {
+        throw util::IllegalStateException(std::string("Publication is closed"), SOURCEINFO);
+    }
+
+    return m_conductor.removeDestination(m_originalRegistrationId, endpointChannel, onComplete);
+}
+
 std::int64_t ExclusivePublication::channelStatus()
 {
     if (isClosed())
@@ -468,6 +468,87 @@ public:
         return offer(buffers.begin(), buffers.end(), reservedValueSupplier);
     }
 
+    /**
+     * Non-blocking publish of a batch of messages, one per buffer, with a single reservation in the log. Each message
+     * must fit within {@link #maxPayloadLength()} so it is not fragmented and the batch, including frame headers and
+     * alignment, must not exceed {@link #maxMessageLength()}. The batch is appended in full or not at all.
+     *
+     * @param startBuffer containing the first message of the batch.
+     * @param lastBuffer after the last message of the batch.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @throws IllegalArgumentException if the batch is empty, a message is greater than max payload length or the
+     * batch is greater than max message length.
+     */
+    template <class BufferIterator> std::int64_t offerBatch(
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        const util::index_t batchLength = computeBatchLength(startBuffer, lastBuffer);
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
+            const std::int64_t position = m_termBeginPosition + m_termOffset;
+
+            if (position < limit)
+            {
+                const std::int32_t result = termAppender->appendUnfragmentedBatch(
+                    m_termId,
+                    m_termOffset,
+                    m_headerWriter,
+                    startBuffer,
+                    lastBuffer,
+                    batchLength,
+                    reservedValueSupplier);
+
+                newPosition = ExclusivePublication::newPosition(result);
+            }
+            else
+            {
+                newPosition = ExclusivePublication::backPressureStatus(position, batchLength);
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Non-blocking publish of an array of buffers as a batch of messages, one per buffer.
+     *
+     * @param buffers containing the messages of the batch.
+     * @param length of the array of buffers.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    std::int64_t offerBatch(
+        const concurrent::AtomicBuffer buffers[],
+        size_t length,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        return offerBatch(buffers, buffers + length, reservedValueSupplier);
+    }
+
+    /**
+     * Non-blocking publish of an array of buffers as a batch of messages, one per buffer.
+     *
+     * @param buffers containing the messages of the batch.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template <size_t N> std::int64_t offerBatch(
+        const std::array<concurrent::AtomicBuffer, N>& buffers,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        return offerBatch(buffers.begin(), buffers.end(), reservedValueSupplier);
+    }
+
     /**
      * Try to claim a range in the publication log into which a message can be written with zero copy semantics.
      * Once the message has been written then {@link BufferClaim#commit()} should be called thus making it available.
@@ -527,6 +608,67 @@ public:
         return newPosition;
     }
 
+    /**
+     * Try to claim a range in the publication log for each of a batch of messages with a single reservation, so a
+     * burst of messages can be encoded with zero copy semantics. Each claim is then committed or aborted
+     * independently with {@link BufferClaim#commit()} or {@link BufferClaim#abort()}, or all together with
+     * {@link BufferClaim#commit(BufferClaim[], size_t)}.
+     * <p>
+     * <b>Note:</b> Each message length must be less than MTU length minus header and the batch, including frame
+     * headers and alignment, must not exceed {@link #maxMessageLength()}.
+     *
+     * @param lengths       of the ranges to claim, in bytes.
+     * @param bufferClaims  to be populated if the claim succeeds, one for each length.
+     * @param count         of ranges to claim.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @throws IllegalArgumentException if the batch is empty, a length is greater than max payload length within an
+     * MTU or the batch is greater than max message length.
+     * @see BufferClaim::commit
+     * @see BufferClaim::abort
+     */
+    inline std::int64_t tryClaimBatch(
+        const util::index_t lengths[], concurrent::logbuffer::BufferClaim bufferClaims[], size_t count)
+    {
+        const util::index_t batchLength = computeClaimBatchLength(lengths, count);
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (AERON_COND_EXPECT((!isClosed()), true))
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
+            const std::int64_t position = m_termBeginPosition + m_termOffset;
+
+            if (AERON_COND_EXPECT((position < limit), true))
+            {
+                const std::int32_t result = termAppender->claimBatch(
+                    m_termId, m_termOffset, m_headerWriter, lengths, bufferClaims, count, batchLength);
+                newPosition = ExclusivePublication::newPosition(result);
+            }
+            else
+            {
+                newPosition = ExclusivePublication::backPressureStatus(position, batchLength);
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Try to claim a range in the publication log for each of a batch of messages with a single reservation.
+     *
+     * @param lengths       of the ranges to claim, in bytes.
+     * @param bufferClaims  to be populated if the claim succeeds, one for each length.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @see #tryClaimBatch(const util::index_t[], BufferClaim[], size_t)
+     */
+    template <size_t N> std::int64_t tryClaimBatch(
+        const std::array<util::index_t, N>& lengths, std::array<concurrent::logbuffer::BufferClaim, N>& bufferClaims)
+    {
+        return tryClaimBatch(lengths.data(), bufferClaims.data(), N);
+    }
+
     /**
      * Add a destination manually to a multi-destination-cast Publication.
      *
@@ -534,6 +676,15 @@ public:
      */
     void addDestination(const std::string& endpointChannel);
 
+    /**
+     * Add a destination and be notified when the media driver has added it.
+     *
+     * @param endpointChannel for the destination to add
+     * @param onComplete      called on the client conductor thread with the outcome.
+     * @return correlation id of the command to the media driver.
+     */
+    std::int64_t addDestination(const std::string& endpointChannel, const on_destination_complete_t& onComplete);
+
     /**
      * Remove a previously added destination manually from a multi-destination-cast Publication.
      *
@@ -541,6 +692,15 @@ public:
      */
     void removeDestination(const std::string& endpointChannel);
 
+    /**
+     * Remove a destination and be notified when the media driver has removed it.
+     *
+     * @param endpointChannel for the destination to remove
+     * @param onComplete      called on the client conductor thread with the outcome.
+     * @return correlation id of the command to the media driver.
+     */
+    std::int64_t removeDestination(const std::string& endpointChannel, const on_destination_complete_t& onComplete);
+
     /**
      * Get the status for the channel of this {@link ExclusivePublication}
      *
@@ -648,6 +808,56 @@ private:
                 ", length=" + std::to_string(length), SOURCEINFO);
         }
     }
+    template <class BufferIterator> inline util::index_t computeBatchLength(
+        BufferIterator startBuffer, BufferIterator lastBuffer) const
+    {
+        checkBatchNotEmpty(startBuffer == lastBuffer);
+
+        util::index_t batchLength = 0;
+        for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+        {
+            batchLength = addToBatchLength(batchLength, it->capacity());
+        }
+
+        return batchLength;
+    }
+
+    inline util::index_t computeClaimBatchLength(const util::index_t lengths[], size_t count) const
+    {
+        checkBatchNotEmpty(0 == count);
+
+        util::index_t batchLength = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            batchLength = addToBatchLength(batchLength, lengths[i]);
+        }
+
+        return batchLength;
+    }
+
+    inline static void checkBatchNotEmpty(const bool isEmpty)
+    {
+        if (AERON_COND_EXPECT(isEmpty, false))
+        {
+            throw util::IllegalArgumentException("batch must contain at least one message", SOURCEINFO);
+        }
+    }
+
+    inline util::index_t addToBatchLength(const util::index_t batchLength, const util::index_t length) const
+    {
+        checkPayloadLength(length);
+        const util::index_t newBatchLength =
+            batchLength + util::BitUtil::align(length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+
+        if (AERON_COND_EXPECT((newBatchLength > m_maxMessageLength), false))
+        {
+            throw util::IllegalArgumentException(
+                "batch exceeds maxMessageLength of " + std::to_string(m_maxMessageLength) +
+                ", length=" + std::to_string(newBatchLength), SOURCEINFO);
+        }
+
+        return newBatchLength;
+    }
 };
 
 }
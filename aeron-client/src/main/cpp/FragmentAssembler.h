@@ -18,6 +18,8 @@
 #define AERON_FRAGMENT_ASSEMBLY_H
 
 #include <unordered_map>
+#include <type_traits>
+#include <utility>
 #include "Aeron.h"
 #include "BufferBuilder.h"
 
@@ -35,8 +37,15 @@ static const std::size_t DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 4096;
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate is held as its own type H and called directly, so when the assembler is passed straight to
+ * Subscription::poll or Image::poll, rather than through {@link #handler()}, the whole fragment path can be inlined.
+ * {@link FragmentAssembler} is the specialisation for {@link fragment_handler_t}.
+ *
+ * @tparam H type of the delegate onto which whole messages are forwarded.
  */
-class FragmentAssembler
+template <typename H>
+class BasicFragmentAssembler
 {
 public:
 
@@ -46,8 +55,8 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    FragmentAssembler(
-        const fragment_handler_t& delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+    BasicFragmentAssembler(
+        const H& delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
         m_initialBufferLength(initialBufferLength), m_delegate(delegate)
     {
     }
@@ -66,6 +75,15 @@ public:
         };
     }
 
+    /**
+     * Reassemble a fragment and delegate on whole messages. Allows the assembler to be passed by reference to
+     * Subscription::poll or Image::poll in place of {@link #handler()}.
+     */
+    inline void operator()(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        this->onFragment(buffer, offset, length, header);
+    }
+
     /**
      * Free an existing session buffer to reduce memory pressure when an Image goes inactive or no more
      * large messages are expected.
@@ -79,7 +97,7 @@ public:
 
 private:
     const std::size_t m_initialBufferLength;
-    fragment_handler_t m_delegate;
+    H m_delegate;
     std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
 
     inline void onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
@@ -130,6 +148,22 @@ private:
     }
 };
 
+typedef BasicFragmentAssembler<fragment_handler_t> FragmentAssembler;
+
+/**
+ * Construct a BasicFragmentAssembler for the type of the delegate so it can be called without indirection.
+ *
+ * @param delegate            onto which whole messages are forwarded.
+ * @param initialBufferLength to be used for each session.
+ * @return the assembler for the delegate.
+ */
+template <typename H>
+inline BasicFragmentAssembler<typename std::decay<H>::type> makeFragmentAssembler(
+    H&& delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH)
+{
+    return BasicFragmentAssembler<typename std::decay<H>::type>(std::forward<H>(delegate), initialBufferLength);
+}
+
 }
 
 #endif
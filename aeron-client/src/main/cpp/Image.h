@@ -364,6 +364,53 @@ public:
                 LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX));
     }
 
+    /**
+     * The position up to which data has been made available in the log for this Image, taken from the term tail
+     * counters. For a network Image this is the highest position received by the driver which may be ahead of
+     * gaps still to be filled. Where the tails are not maintained this is the consumed {@link #position()}. Tails
+     * for terms outside the window of partitions around the consumed position, such as zeroed tails not yet
+     * initialised, are ignored.
+     *
+     * @return the position up to which data is available, and no less than {@link #position()}.
+     */
+    inline std::int64_t availablePosition()
+    {
+        const std::int64_t position = this->position();
+
+        if (isClosed())
+        {
+            return position;
+        }
+
+        AtomicBuffer& logMetaDataBuffer = m_logBuffers->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX);
+        const std::int64_t termLength = m_termLengthMask + 1;
+        const std::int64_t termBeginPosition = position - (position & m_termLengthMask);
+        const std::uint32_t positionTermId =
+            static_cast<std::uint32_t>(initialTermId()) + static_cast<std::uint32_t>(position >> m_positionBitsToShift);
+        std::int64_t availablePosition = position;
+
+        for (int i = 0; i < LogBufferDescriptor::PARTITION_COUNT; i++)
+        {
+            const std::int64_t rawTail = logMetaDataBuffer.getInt64Volatile(
+                LogBufferDescriptor::TERM_TAIL_COUNTER_OFFSET + (i * sizeof(std::int64_t)));
+            const std::int32_t termsAhead = static_cast<std::int32_t>(
+                static_cast<std::uint32_t>(LogBufferDescriptor::termId(rawTail)) - positionTermId);
+
+            if (termsAhead <= -LogBufferDescriptor::PARTITION_COUNT || termsAhead > 1)
+            {
+                continue;
+            }
+
+            const std::int64_t tailPosition = termBeginPosition +
+                (static_cast<std::int64_t>(termsAhead) << m_positionBitsToShift) +
+                LogBufferDescriptor::termOffset(rawTail, termLength);
+
+            availablePosition = std::max(availablePosition, tailPosition);
+        }
+
+        return availablePosition;
+    }
+
     /**
      * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
      * will be delivered via the fragment_handler_t up to a limited number of fragments as specified.
@@ -403,6 +450,77 @@ public:
         return result;
     }
 
+    /**
+     * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
+     * will be delivered via the fragment_handler_t up to a limited number of fragments as specified or the
+     * maximum position specified. A fragment which begins before the maximum position is delivered whole.
+     *
+     * @param fragmentHandler to which messages are delivered.
+     * @param maxPosition     to consume messages up to.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F>
+    inline int boundedPoll(F&& fragmentHandler, std::int64_t maxPosition, int fragmentLimit)
+    {
+        int result = 0;
+
+        if (!isClosed())
+        {
+            const std::int64_t position = m_subscriberPosition.get();
+            const std::int32_t termOffset = static_cast<std::int32_t>(position & m_termLengthMask);
+            const int index = LogBufferDescriptor::indexByPosition(position, m_positionBitsToShift);
+            assert(index >= 0 && index < LogBufferDescriptor::PARTITION_COUNT);
+            AtomicBuffer &termBuffer = m_termBuffers[index];
+            const std::int64_t capacity = termBuffer.capacity();
+            const std::int32_t limitOffset =
+                static_cast<std::int32_t>(std::min(capacity, (maxPosition - position) + termOffset));
+            std::int32_t offset = termOffset;
+
+            m_header.buffer(termBuffer);
+
+            try
+            {
+                while (result < fragmentLimit && offset < limitOffset)
+                {
+                    const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+                    if (length <= 0)
+                    {
+                        break;
+                    }
+
+                    const std::int32_t frameOffset = offset;
+                    offset += util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+
+                    if (!FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
+                    {
+                        m_header.offset(frameOffset);
+                        fragmentHandler(
+                            termBuffer,
+                            frameOffset + DataFrameHeader::LENGTH,
+                            length - DataFrameHeader::LENGTH,
+                            m_header);
+
+                        ++result;
+                    }
+                }
+            }
+            catch (const std::exception& ex)
+            {
+                m_exceptionHandler(ex);
+            }
+
+            if (offset > termOffset)
+            {
+                m_subscriberPosition.setOrdered(position + (offset - termOffset));
+            }
+        }
+
+        return result;
+    }
+
     /**
      * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
      * will be delivered to the controlled_poll_fragment_handler_t up to a limited number of fragments as specified.
@@ -738,6 +856,58 @@ public:
         return result;
     }
 
+    /**
+     * Poll for new messages in a stream as a block in the same way as blockPoll(F&&, int) while also delivering an
+     * index of the offset, length, type and flags of each frame in the block. The index is built by the same header
+     * scan that finds the end of the block so the handler can walk or copy the frames without scanning them again.
+     *
+     * A block is limited to the capacity of the frame index as well as to the blockLengthLimit.
+     *
+     * @param blockHandler     to which block and its frame index is delivered.
+     * @param blockLengthLimit up to which a block may be in length.
+     * @param frameIndex       to be filled with the frames of the block, reused between polls.
+     * @return the number of bytes that have been consumed.
+     *
+     * @see indexed_block_handler_t
+     */
+    template <typename F>
+    inline int blockPoll(F&& blockHandler, int blockLengthLimit, TermBlockFrameIndex& frameIndex)
+    {
+        int result = 0;
+
+        if (!isClosed())
+        {
+            const std::int64_t position = m_subscriberPosition.get();
+            const std::int32_t termOffset = static_cast<std::int32_t>(position & m_termLengthMask);
+            const int index = LogBufferDescriptor::indexByPosition(position, m_positionBitsToShift);
+            assert(index >= 0 && index < LogBufferDescriptor::PARTITION_COUNT);
+            AtomicBuffer &termBuffer = m_termBuffers[index];
+            const std::int32_t limitOffset = std::min(termOffset + blockLengthLimit, termBuffer.capacity());
+            const std::int32_t resultingOffset =
+                TermBlockScanner::scan(termBuffer, termOffset, limitOffset, frameIndex);
+            const std::int32_t length = resultingOffset - termOffset;
+
+            if (resultingOffset > termOffset)
+            {
+                try
+                {
+                    const std::int32_t termId = termBuffer.getInt32(termOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET);
+                    blockHandler(termBuffer, termOffset, length, m_sessionId, termId, frameIndex);
+                }
+                catch (const std::exception& ex)
+                {
+                    m_exceptionHandler(ex);
+                }
+
+                m_subscriberPosition.setOrdered(position + length);
+            }
+
+            result = length;
+        }
+
+        return result;
+    }
+
     std::shared_ptr<LogBuffers> logBuffers()
     {
         return m_logBuffers;
@@ -41,6 +41,12 @@ LogBuffers::LogBuffers(const char *filename, bool preTouch)
     LogBufferDescriptor::checkTermLength(termLength);
     LogBufferDescriptor::checkPageSize(pageSize);
 
+    // a page size above the OS page size means the driver laid the log out for huge pages
+    if (static_cast<std::size_t>(pageSize) > MemoryMappedFile::getPageSize())
+    {
+        m_memoryMappedFiles->adviseHugePages();
+    }
+
     for (int i = 0; i < LogBufferDescriptor::PARTITION_COUNT; i++)
     {
         m_buffers[i].wrap(basePtr + (i * termLength), static_cast<size_t>(termLength));
@@ -75,6 +75,17 @@ void Publication::addDestination(const std::string& endpointChannel)
     m_conductor.addDestination(m_originalRegistrationId, endpointChannel);
 }
 
+std::int64_t Publication::addDestination(
+    const std::string& endpointChannel, const on_destination_complete_t& onComplete)
+{
+    if (isClosed())
+    {
+        throw util::IllegalStateException(std::string("Publication is closed"), SOURCEINFO);
+    }
+
+    return m_conductor.addDestination(m_originalRegistrationId, endpointChannel, onComplete);
+}
+
 void Publication::removeDestination(const std::string& endpointChannel)
 {
     if (isClosed())
@@ -85,6 +96,17 @@ void Publication::removeDestination(const std::string& endpointChannel)
     m_conductor.removeDestination(m_originalRegistrationId, endpointChannel);
 }
 
+std::int64_t Publication::removeDestination(
+    const std::string& endpointChannel, const on_destination_complete_t& onComplete)
+{
+    if (isClosed())
+    {
+        throw util::IllegalStateException(std::string("Publication is closed"), SOURCEINFO);
+    }
+
+    return m_conductor.removeDestination(m_originalRegistrationId, endpointChannel, onComplete);
+}
+
 std::int64_t Publication::channelStatus()
 {
     if (isClosed())
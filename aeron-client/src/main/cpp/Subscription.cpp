@@ -52,6 +52,17 @@ void Subscription::addDestination(const std::string& endpointChannel)
     m_conductor.addRcvDestination(m_registrationId, endpointChannel);
 }
 
+std::int64_t Subscription::addDestination(
+    const std::string& endpointChannel, const on_destination_complete_t& onComplete)
+{
+    if (isClosed())
+    {
+        throw util::IllegalStateException(std::string("Subscription is closed"), SOURCEINFO);
+    }
+
+    return m_conductor.addRcvDestination(m_registrationId, endpointChannel, onComplete);
+}
+
 void Subscription::removeDestination(const std::string& endpointChannel)
 {
     if (isClosed())
@@ -62,6 +73,17 @@ void Subscription::removeDestination(const std::string& endpointChannel)
     m_conductor.removeRcvDestination(m_registrationId, endpointChannel);
 }
 
+std::int64_t Subscription::removeDestination(
+    const std::string& endpointChannel, const on_destination_complete_t& onComplete)
+{
+    if (isClosed())
+    {
+        throw util::IllegalStateException(std::string("Subscription is closed"), SOURCEINFO);
+    }
+
+    return m_conductor.removeRcvDestination(m_registrationId, endpointChannel, onComplete);
+}
+
 std::int64_t Subscription::channelStatus() const
 {
     if (isClosed())
@@ -22,10 +22,14 @@
 #include <atomic>
 #include <memory>
 #include <iterator>
+#include <vector>
+#include <algorithm>
+#include <limits>
 #include "concurrent/logbuffer/TermReader.h"
 #include "concurrent/status/StatusIndicatorReader.h"
 #include "concurrent/AtomicArrayUpdater.h"
 #include "Image.h"
+#include "Context.h"
 
 namespace aeron {
 
@@ -108,6 +112,15 @@ public:
      */
     void addDestination(const std::string& endpointChannel);
 
+    /**
+     * Add a destination and be notified when the media driver has added it.
+     *
+     * @param endpointChannel for the destination to add
+     * @param onComplete      called on the client conductor thread with the outcome.
+     * @return correlation id of the command to the media driver.
+     */
+    std::int64_t addDestination(const std::string& endpointChannel, const on_destination_complete_t& onComplete);
+
     /**
      * Remove a previously added destination from a multi-destination Subscription.
      *
@@ -115,6 +128,15 @@ public:
      */
     void removeDestination(const std::string& endpointChannel);
 
+    /**
+     * Remove a destination and be notified when the media driver has removed it.
+     *
+     * @param endpointChannel for the destination to remove
+     * @param onComplete      called on the client conductor thread with the outcome.
+     * @return correlation id of the command to the media driver.
+     */
+    std::int64_t removeDestination(const std::string& endpointChannel, const on_destination_complete_t& onComplete);
+
     /**
      * Poll the {@link Image}s under the subscription for available message fragments.
      * <p>
@@ -219,6 +241,150 @@ public:
         return bytesConsumed;
     }
 
+    /**
+     * Poll the Image s under the subscription for available message fragments in blocks, delivering with each block
+     * an index of its frames.
+     *
+     * @param blockHandler     to receive a block of fragments and its frame index from each Image.
+     * @param blockLengthLimit for each individual block.
+     * @param frameIndex       reused for the block from each Image in turn.
+     * @return the number of bytes consumed.
+     *
+     * @see indexed_block_handler_t
+     */
+    template <typename F>
+    inline long blockPoll(F&& blockHandler, int blockLengthLimit, TermBlockFrameIndex& frameIndex)
+    {
+        auto imageArrayPair = m_imageArray.load();
+        auto imageArray = imageArrayPair.first;
+        const std::size_t length = imageArrayPair.second;
+        long bytesConsumed = 0;
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            bytesConsumed += imageArray[i]->blockPoll(blockHandler, blockLengthLimit, frameIndex);
+        }
+
+        return bytesConsumed;
+    }
+
+    /**
+     * Poll the Image s under the subscription for available message fragments up to a byte budget shared fairly
+     * between them by backlog.
+     * <p>
+     * Each Image is first given a share of the budget in proportion to its backlog, the distance from its
+     * {@link Image#position()} to its {@link Image#availablePosition()}, visiting the largest backlog first. Any
+     * budget left over is then spread evenly over all Images in round-robin order, which also serves Images with
+     * no tracked backlog. A fragment which begins within a share is delivered whole so the budget may be exceeded by
+     * up to one fragment per Image.
+     *
+     * @param fragmentHandler     callback for handling each message fragment as it is read.
+     * @param byteLimit           budget in bytes of fragments, including headers, to consume across the Image s.
+     * @param consumptionHandler  called as (Image&, long bytesConsumed) for each Image consumed from.
+     * @return the number of bytes consumed.
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F, typename C>
+    inline long fairPoll(F&& fragmentHandler, long byteLimit, C&& consumptionHandler)
+    {
+        auto imageArrayPair = m_imageArray.load();
+        auto imageArray = imageArrayPair.first;
+        const std::size_t length = imageArrayPair.second;
+
+        if (0 == length || byteLimit <= 0)
+        {
+            return 0;
+        }
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        m_fairPollImages.clear();
+        std::int64_t totalBacklog = 0;
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            Image *image = imageArray[(startingIndex + i) % length].get();
+            const std::int64_t backlog = image->availablePosition() - image->position();
+
+            m_fairPollImages.push_back({ image, backlog, 0, i });
+            totalBacklog += backlog;
+        }
+
+        std::stable_sort(
+            m_fairPollImages.begin(),
+            m_fairPollImages.end(),
+            [](const FairPollImage& a, const FairPollImage& b)
+            {
+                return a.backlog > b.backlog;
+            });
+
+        long bytesRemaining = byteLimit;
+
+        for (std::size_t i = 0; i < length && totalBacklog > 0 && bytesRemaining > 0; i++)
+        {
+            FairPollImage& entry = m_fairPollImages[i];
+            if (entry.backlog <= 0)
+            {
+                break;
+            }
+
+            const double share = static_cast<double>(byteLimit) * entry.backlog / totalBacklog;
+            const std::int64_t bytes = std::max<std::int64_t>(
+                1, std::min<std::int64_t>(std::min<std::int64_t>(static_cast<std::int64_t>(share), entry.backlog),
+                bytesRemaining));
+
+            bytesRemaining -= fairPollImage(entry, fragmentHandler, bytes);
+        }
+
+        std::sort(
+            m_fairPollImages.begin(),
+            m_fairPollImages.end(),
+            [](const FairPollImage& a, const FairPollImage& b)
+            {
+                return a.order < b.order;
+            });
+
+        for (std::size_t i = 0; i < length && bytesRemaining > 0; i++)
+        {
+            const std::int64_t bytes = std::max<std::int64_t>(1, bytesRemaining / static_cast<long>(length - i));
+
+            bytesRemaining -= fairPollImage(m_fairPollImages[i], fragmentHandler, bytes);
+        }
+
+        long bytesConsumed = 0;
+        for (std::size_t i = 0; i < length; i++)
+        {
+            const FairPollImage& entry = m_fairPollImages[i];
+            if (entry.bytesConsumed > 0)
+            {
+                consumptionHandler(*entry.image, entry.bytesConsumed);
+                bytesConsumed += entry.bytesConsumed;
+            }
+        }
+
+        return bytesConsumed;
+    }
+
+    /**
+     * Poll the Image s under the subscription for available message fragments up to a byte budget shared fairly
+     * between them by backlog.
+     *
+     * @param fragmentHandler callback for handling each message fragment as it is read.
+     * @param byteLimit       budget in bytes of fragments, including headers, to consume across the Image s.
+     * @return the number of bytes consumed.
+     * @see #fairPoll(F&&, long, C&&)
+     */
+    template <typename F>
+    inline long fairPoll(F&& fragmentHandler, long byteLimit)
+    {
+        return fairPoll(fragmentHandler, byteLimit, [](Image&, long) {});
+    }
+
     /**
      * Is the subscription connected by having at least one open image available.
      *
@@ -454,6 +620,14 @@ public:
     std::int64_t channelStatus() const;
 
 private:
+    struct FairPollImage
+    {
+        Image *image;
+        std::int64_t backlog;
+        long bytesConsumed;
+        std::size_t order;
+    };
+
     ClientConductor& m_conductor;
     const std::string m_channel;
     std::int32_t m_channelStatusId;
@@ -463,6 +637,20 @@ private:
 
     AtomicArrayUpdater<std::shared_ptr<Image>> m_imageArray;
     std::atomic<bool> m_isClosed;
+    std::vector<FairPollImage> m_fairPollImages;
+
+    template <typename F>
+    inline static long fairPollImage(FairPollImage& entry, F& fragmentHandler, std::int64_t byteLimit)
+    {
+        const std::int64_t initialPosition = entry.image->position();
+
+        entry.image->boundedPoll(fragmentHandler, initialPosition + byteLimit, std::numeric_limits<int>::max());
+
+        const long bytesConsumed = static_cast<long>(entry.image->position() - initialPosition);
+        entry.bytesConsumed += bytesConsumed;
+
+        return bytesConsumed;
+    }
 };
 
 }
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AERON_BATCH_MESSAGE_FLYWEIGHT_H
+#define AERON_BATCH_MESSAGE_FLYWEIGHT_H
+
+#include <cstdint>
+#include <stddef.h>
+#include <util/BitUtil.h>
+#include "CorrelatedMessageFlyweight.h"
+
+namespace aeron { namespace command {
+
+/**
+ * Many commands to the driver, or many responses from it, packed into one message. Each entry is the message that
+ * would otherwise have been sent on its own, preceded by its type and length and aligned to BATCH_ENTRY_ALIGNMENT.
+ *
+ *   0                   1                   2                   3
+ *   0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  |                            Client ID                          |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                         Correlation ID                        |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                          Entry Count                          |
+ *  +---------------------------------------------------------------+
+ *  |                            Reserved                           |
+ *  +---------------------------------------------------------------+
+ *  |                       Entry Message Type                      |
+ *  +---------------------------------------------------------------+
+ *  |                          Entry Length                         |
+ *  +---------------------------------------------------------------+
+ *  |                          Entry Message                       ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ */
+#pragma pack(push)
+#pragma pack(4)
+struct BatchMessageDefn
+{
+    CorrelatedMessageDefn correlatedMessage;
+    std::int32_t entryCount;
+    std::int32_t reserved;
+};
+
+struct BatchEntryDefn
+{
+    std::int32_t msgTypeId;
+    std::int32_t length;
+};
+#pragma pack(pop)
+
+static const util::index_t BATCH_ENTRY_ALIGNMENT = 8;
+
+class BatchMessageFlyweight : public CorrelatedMessageFlyweight
+{
+public:
+    typedef BatchMessageFlyweight this_t;
+
+    inline BatchMessageFlyweight(concurrent::AtomicBuffer& buffer, util::index_t offset) :
+        CorrelatedMessageFlyweight(buffer, offset), m_struct(overlayStruct<BatchMessageDefn>(0))
+    {
+    }
+
+    inline std::int32_t entryCount() const
+    {
+        return m_struct.entryCount;
+    }
+
+    inline this_t& entryCount(std::int32_t value)
+    {
+        m_struct.entryCount = value;
+        m_struct.reserved = 0;
+        return *this;
+    }
+
+    inline static util::index_t firstEntryOffset()
+    {
+        return sizeof(BatchMessageDefn);
+    }
+
+    /**
+     * Offset of the entry following one of the given length.
+     */
+    inline static util::index_t nextEntryOffset(util::index_t entryOffset, util::index_t entryLength)
+    {
+        return util::BitUtil::align(entryEndOffset(entryOffset, entryLength), BATCH_ENTRY_ALIGNMENT);
+    }
+
+    /**
+     * Offset just past an entry of the given length, which is the length of the message when it is the last entry.
+     */
+    inline static util::index_t entryEndOffset(util::index_t entryOffset, util::index_t entryLength)
+    {
+        return entryOffset + static_cast<util::index_t>(sizeof(BatchEntryDefn)) + entryLength;
+    }
+
+    inline static util::index_t entryMessageOffset(util::index_t entryOffset)
+    {
+        return entryOffset + static_cast<util::index_t>(sizeof(BatchEntryDefn));
+    }
+
+    inline std::int32_t entryMsgTypeId(util::index_t entryOffset) const
+    {
+        return overlayStruct<BatchEntryDefn>(entryOffset).msgTypeId;
+    }
+
+    inline std::int32_t entryLength(util::index_t entryOffset) const
+    {
+        return overlayStruct<BatchEntryDefn>(entryOffset).length;
+    }
+
+    /**
+     * Copy a message in as the entry at the given offset.
+     *
+     * @return offset just past the entry.
+     */
+    inline util::index_t putEntry(
+        util::index_t entryOffset, std::int32_t msgTypeId, const std::uint8_t *message, util::index_t length)
+    {
+        BatchEntryDefn& entry = overlayStruct<BatchEntryDefn>(entryOffset);
+        entry.msgTypeId = msgTypeId;
+        entry.length = length;
+
+        putBytes(entryMessageOffset(entryOffset), message, length);
+
+        return entryEndOffset(entryOffset, length);
+    }
+
+private:
+    BatchMessageDefn& m_struct;
+};
+
+}}
+#endif
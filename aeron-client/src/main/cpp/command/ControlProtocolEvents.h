@@ -57,6 +57,8 @@ struct ControlProtocolEvents
     static const std::int32_t REMOVE_RCV_DESTINATION = 0x0D;
     /** Request driver run termination hook */
     static const std::int32_t TERMINATE_DRIVER = 0x0E;
+    /** Many commands packed into one message */
+    static const std::int32_t COMMAND_BATCH = 0x0F;
 
     // Media Driver to Clients
 
@@ -80,6 +82,8 @@ struct ControlProtocolEvents
     static const std::int32_t ON_UNAVAILABLE_COUNTER = 0x0F09;
     /** inform clients of client timeout */
     static const std::int32_t ON_CLIENT_TIMEOUT = 0x0F0A;
+    /** Many responses packed into one message */
+    static const std::int32_t ON_BATCH = 0x0F0B;
 };
 
 }}
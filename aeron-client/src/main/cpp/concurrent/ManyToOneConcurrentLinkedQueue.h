@@ -0,0 +1,136 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_MANY_TO_ONE_CONCURRENT_LINKED_QUEUE_H
+#define AERON_MANY_TO_ONE_CONCURRENT_LINKED_QUEUE_H
+
+#include <cstdint>
+#include <atomic>
+#include <utility>
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Unbounded linked queue for many producer threads and a single consumer thread.
+ *
+ * Producers link a new node with a single atomic exchange on the tail so an offer never waits on another thread.
+ * The consumer keeps a stub node at the head and moves each value out of the node following it.
+ *
+ * @tparam T type of the element, which must be default constructible and movable.
+ */
+template<typename T>
+class ManyToOneConcurrentLinkedQueue
+{
+public:
+    ManyToOneConcurrentLinkedQueue() :
+        m_head(new Node()),
+        m_tail(m_head)
+    {
+    }
+
+    ~ManyToOneConcurrentLinkedQueue()
+    {
+        Node *node = m_head;
+        while (nullptr != node)
+        {
+            Node *next = node->m_next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    ManyToOneConcurrentLinkedQueue(const ManyToOneConcurrentLinkedQueue&) = delete;
+    ManyToOneConcurrentLinkedQueue& operator=(const ManyToOneConcurrentLinkedQueue&) = delete;
+
+    /**
+     * Add an element to the tail of the queue. Safe to call from any thread.
+     *
+     * @param value to be added.
+     */
+    void offer(T value)
+    {
+        Node *node = new Node(std::move(value));
+        Node *prev = m_tail.exchange(node, std::memory_order_acq_rel);
+        prev->m_next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * Remove elements from the head of the queue and pass each to a handler. Only the consumer thread may call this.
+     *
+     * An element whose producer has exchanged the tail but not yet linked its node is left for the next drain.
+     *
+     * @param handler to be called for each element.
+     * @param limit   maximum number of elements to drain.
+     * @return the number of elements drained.
+     */
+    template<typename F>
+    int drain(F&& handler, int limit = INT32_MAX)
+    {
+        int count = 0;
+
+        while (count < limit)
+        {
+            Node *next = m_head->m_next.load(std::memory_order_acquire);
+            if (nullptr == next)
+            {
+                break;
+            }
+
+            T value = std::move(next->m_value);
+            next->m_value = T();
+
+            delete m_head;
+            m_head = next;
+            ++count;
+
+            handler(value);
+        }
+
+        return count;
+    }
+
+    /**
+     * Has the queue no linked elements. Only meaningful on the consumer thread.
+     *
+     * @return true if there is nothing to drain.
+     */
+    inline bool isEmpty() const
+    {
+        return nullptr == m_head->m_next.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Node
+    {
+        T m_value;
+        std::atomic<Node*> m_next;
+
+        Node() : m_value(), m_next(nullptr)
+        {
+        }
+
+        explicit Node(T value) : m_value(std::move(value)), m_next(nullptr)
+        {
+        }
+    };
+
+    Node *m_head;
+    std::atomic<Node*> m_tail;
+};
+
+}}
+
+#endif
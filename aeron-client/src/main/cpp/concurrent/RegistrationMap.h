@@ -0,0 +1,338 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_REGISTRATION_MAP_H
+#define AERON_REGISTRATION_MAP_H
+
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "util/BitUtil.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Hash map from registration id to value in which insert, lookup and removal are lock-free from any thread.
+ *
+ * Each bucket is a singly linked list. Inserts push onto the bucket head with a CAS. Removal only marks an entry,
+ * so a reader that already holds a pointer to a value may keep using it. An owner thread later unlinks marked
+ * entries with reclaim() and frees them once they have lingered longer than the given timeout, in the same way the
+ * client conductor lingers image arrays. Only reclaim() writes links other than the bucket heads.
+ *
+ * Registration ids are unique, so the map does not check for duplicate keys.
+ *
+ * @tparam T type of the value, constructed in place and never moved.
+ */
+template<typename T>
+class RegistrationMap
+{
+public:
+    static const std::size_t DEFAULT_BUCKET_COUNT = 1024;
+
+    explicit RegistrationMap(std::size_t bucketCount = DEFAULT_BUCKET_COUNT) :
+        m_bucketCount(static_cast<std::size_t>(
+            util::BitUtil::findNextPowerOfTwo(static_cast<std::int32_t>(bucketCount)))),
+        m_mask(m_bucketCount - 1),
+        m_buckets(new std::atomic<Node*>[m_bucketCount])
+    {
+        for (std::size_t i = 0; i < m_bucketCount; i++)
+        {
+            m_buckets[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~RegistrationMap()
+    {
+        for (std::size_t i = 0; i < m_bucketCount; i++)
+        {
+            Node *node = m_buckets[i].load(std::memory_order_relaxed);
+            while (nullptr != node)
+            {
+                Node *next = node->m_next.load(std::memory_order_relaxed);
+                delete node;
+                node = next;
+            }
+        }
+
+        freeLingering([](Node *) { return true; });
+    }
+
+    RegistrationMap(const RegistrationMap&) = delete;
+    RegistrationMap& operator=(const RegistrationMap&) = delete;
+
+    /**
+     * Insert a value constructed from the given arguments. Safe to call from any thread.
+     *
+     * @param key  registration id of the value.
+     * @param args to construct the value with.
+     * @return reference to the value, which stays valid until it is removed and has lingered.
+     */
+    template<typename... Args>
+    T& emplace(std::int64_t key, Args&&... args)
+    {
+        Node *node = new Node(key, std::forward<Args>(args)...);
+        std::atomic<Node*> &bucket = m_buckets[index(key)];
+        Node *head = bucket.load(std::memory_order_acquire);
+
+        do
+        {
+            node->m_next.store(head, std::memory_order_relaxed);
+        }
+        while (!bucket.compare_exchange_weak(head, node, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        return node->m_value;
+    }
+
+    /**
+     * Find a value that has not been removed. Safe to call from any thread.
+     *
+     * @param key registration id of the value.
+     * @return pointer to the value or nullptr if not present.
+     */
+    T* find(std::int64_t key) const
+    {
+        Node *node = m_buckets[index(key)].load(std::memory_order_acquire);
+
+        while (nullptr != node)
+        {
+            if (key == node->m_key && !node->m_isRemoved.load(std::memory_order_acquire))
+            {
+                return &node->m_value;
+            }
+
+            node = node->m_next.load(std::memory_order_acquire);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Mark a value as removed. Safe to call from any thread. Exactly one caller wins the removal of a given value.
+     *
+     * @param key registration id of the value.
+     * @return pointer to the value if this call removed it, otherwise nullptr.
+     */
+    T* remove(std::int64_t key)
+    {
+        Node *node = m_buckets[index(key)].load(std::memory_order_acquire);
+
+        while (nullptr != node)
+        {
+            if (key == node->m_key && markRemoved(node))
+            {
+                return &node->m_value;
+            }
+
+            node = node->m_next.load(std::memory_order_acquire);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Call a function for each value that has not been removed.
+     *
+     * @param func taking the registration id and a reference to the value.
+     */
+    template<typename F>
+    void forEach(F&& func)
+    {
+        for (std::size_t i = 0; i < m_bucketCount; i++)
+        {
+            Node *node = m_buckets[i].load(std::memory_order_acquire);
+
+            while (nullptr != node)
+            {
+                if (!node->m_isRemoved.load(std::memory_order_acquire))
+                {
+                    func(node->m_key, node->m_value);
+                }
+
+                node = node->m_next.load(std::memory_order_acquire);
+            }
+        }
+    }
+
+    /**
+     * Remove every value, calling a function for each value this call removed.
+     *
+     * @param func taking the registration id and a reference to the value.
+     */
+    template<typename F>
+    void removeAll(F&& func)
+    {
+        for (std::size_t i = 0; i < m_bucketCount; i++)
+        {
+            Node *node = m_buckets[i].load(std::memory_order_acquire);
+
+            while (nullptr != node)
+            {
+                if (markRemoved(node))
+                {
+                    func(node->m_key, node->m_value);
+                }
+
+                node = node->m_next.load(std::memory_order_acquire);
+            }
+        }
+    }
+
+    /**
+     * Unlink removed values and free those that have lingered for longer than the timeout. Only one thread, the
+     * owner, may call this.
+     *
+     * @param nowMs           current time.
+     * @param lingerTimeoutMs time a removed value is kept after being unlinked.
+     */
+    void reclaim(long long nowMs, long long lingerTimeoutMs)
+    {
+        if (m_removedCount.load(std::memory_order_acquire) > 0)
+        {
+            std::int64_t unlinkedCount = 0;
+
+            for (std::size_t i = 0; i < m_bucketCount; i++)
+            {
+                unlinkedCount += unlinkRemoved(m_buckets[i], nowMs);
+            }
+
+            m_removedCount.fetch_sub(unlinkedCount, std::memory_order_acq_rel);
+        }
+
+        if (nullptr != m_lingeringHead)
+        {
+            freeLingering([&](Node *node)
+            {
+                return (nowMs - lingerTimeoutMs) > node->m_timeOfUnlinkMs;
+            });
+        }
+    }
+
+private:
+    struct Node
+    {
+        const std::int64_t m_key;
+        T m_value;
+        std::atomic<Node*> m_next;
+        std::atomic<bool> m_isRemoved;
+        long long m_timeOfUnlinkMs = 0;
+        Node *m_lingeringNext = nullptr;
+
+        template<typename... Args>
+        explicit Node(std::int64_t key, Args&&... args) :
+            m_key(key),
+            m_value(std::forward<Args>(args)...),
+            m_next(nullptr),
+            m_isRemoved(false)
+        {
+        }
+    };
+
+    const std::size_t m_bucketCount;
+    const std::size_t m_mask;
+    std::unique_ptr<std::atomic<Node*>[]> m_buckets;
+    std::atomic<std::int64_t> m_removedCount = { 0 };
+    Node *m_lingeringHead = nullptr;
+
+    inline std::size_t index(std::int64_t key) const
+    {
+        std::uint64_t hash = static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ULL;
+
+        return static_cast<std::size_t>(hash >> 32) & m_mask;
+    }
+
+    inline bool markRemoved(Node *node)
+    {
+        bool expected = false;
+        if (node->m_isRemoved.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            m_removedCount.fetch_add(1, std::memory_order_acq_rel);
+            return true;
+        }
+
+        return false;
+    }
+
+    std::int64_t unlinkRemoved(std::atomic<Node*> &bucket, long long nowMs)
+    {
+        std::int64_t unlinkedCount = 0;
+        Node *prev = nullptr;
+        Node *node = bucket.load(std::memory_order_acquire);
+
+        while (nullptr != node)
+        {
+            Node *next = node->m_next.load(std::memory_order_acquire);
+
+            if (node->m_isRemoved.load(std::memory_order_acquire))
+            {
+                Node *expected = node;
+                if (nullptr != prev)
+                {
+                    prev->m_next.store(next, std::memory_order_release);
+                }
+                else if (!bucket.compare_exchange_strong(expected, next, std::memory_order_acq_rel))
+                {
+                    // inserts have been pushed in front of node since it was read, find its new predecessor
+                    prev = expected;
+                    while (prev->m_next.load(std::memory_order_acquire) != node)
+                    {
+                        prev = prev->m_next.load(std::memory_order_acquire);
+                    }
+
+                    prev->m_next.store(next, std::memory_order_release);
+                }
+
+                node->m_timeOfUnlinkMs = nowMs;
+                node->m_lingeringNext = m_lingeringHead;
+                m_lingeringHead = node;
+                ++unlinkedCount;
+            }
+            else
+            {
+                prev = node;
+            }
+
+            node = next;
+        }
+
+        return unlinkedCount;
+    }
+
+    template<typename F>
+    void freeLingering(F&& isExpired)
+    {
+        Node **link = &m_lingeringHead;
+
+        while (nullptr != *link)
+        {
+            Node *node = *link;
+            if (isExpired(node))
+            {
+                *link = node->m_lingeringNext;
+                delete node;
+            }
+            else
+            {
+                link = &node->m_lingeringNext;
+            }
+        }
+    }
+};
+
+}}
+
+#endif
@@ -166,6 +166,34 @@ public:
         m_buffer.putInt32Ordered(0, m_buffer.capacity());
     }
 
+    /**
+     * Commit a batch of claimed messages to the log buffer in order so that they are available to subscribers.
+     *
+     * @param bufferClaims to be committed.
+     * @param count        of claims to commit.
+     */
+    inline static void commit(BufferClaim bufferClaims[], size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            bufferClaims[i].commit();
+        }
+    }
+
+    /**
+     * Abort a batch of claimed messages so that log can progress ignoring these claims.
+     *
+     * @param bufferClaims to be aborted.
+     * @param count        of claims to abort.
+     */
+    inline static void abort(BufferClaim bufferClaims[], size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            bufferClaims[i].abort();
+        }
+    }
+
 protected:
     AtomicBuffer m_buffer;
 };
@@ -81,6 +81,45 @@ public:
         return resultingOffset;
     }
 
+    /*
+     * Claims one frame per length after a single reservation of batchLength, the sum of the aligned frame lengths.
+     * Each claim is committed or aborted independently.
+     */
+    inline std::int32_t claimBatch(
+        std::int32_t termId,
+        std::int32_t termOffset,
+        const HeaderWriter& header,
+        const util::index_t lengths[],
+        BufferClaim bufferClaims[],
+        size_t count,
+        util::index_t batchLength)
+    {
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        std::int32_t resultingOffset = termOffset + batchLength;
+        putRawTailOrdered(termId, resultingOffset);
+
+        if (AERON_COND_EXPECT((resultingOffset > termLength), false))
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termId, termOffset, header, termLength);
+        }
+        else
+        {
+            std::int32_t frameOffset = termOffset;
+            for (size_t i = 0; i < count; i++)
+            {
+                const util::index_t frameLength = lengths[i] + DataFrameHeader::LENGTH;
+
+                header.write(m_termBuffer, frameOffset, frameLength, termId);
+                bufferClaims[i].wrap(m_termBuffer, frameOffset, frameLength);
+
+                frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+        }
+
+        return resultingOffset;
+    }
+
     inline std::int32_t appendUnfragmentedMessage(
         std::int32_t termId,
         std::int32_t termOffset,
@@ -158,6 +197,57 @@ public:
         return resultingOffset;
     }
 
+    /*
+     * Appends one unfragmented frame per buffer after a single reservation of batchLength, the sum of the aligned
+     * frame lengths. All frames are written before their lengths are published in order.
+     */
+    template <class BufferIterator> inline std::int32_t appendUnfragmentedBatch(
+        std::int32_t termId,
+        std::int32_t termOffset,
+        const HeaderWriter& header,
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        util::index_t batchLength,
+        const on_reserved_value_supplier_t& reservedValueSupplier)
+    {
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        std::int32_t resultingOffset = termOffset + batchLength;
+        putRawTailOrdered(termId, resultingOffset);
+
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termId, termOffset, header, termLength);
+        }
+        else
+        {
+            std::int32_t frameOffset = termOffset;
+            for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+            {
+                const util::index_t frameLength = it->capacity() + DataFrameHeader::LENGTH;
+
+                header.write(m_termBuffer, frameOffset, frameLength, termId);
+                m_termBuffer.putBytes(frameOffset + DataFrameHeader::LENGTH, *it, 0, it->capacity());
+
+                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, frameOffset, frameLength);
+                m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+                frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+
+            frameOffset = termOffset;
+            for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+            {
+                const util::index_t frameLength = it->capacity() + DataFrameHeader::LENGTH;
+
+                FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
+                frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+        }
+
+        return resultingOffset;
+    }
+
     std::int32_t appendFragmentedMessage(
         std::int32_t termId,
         std::int32_t termOffset,
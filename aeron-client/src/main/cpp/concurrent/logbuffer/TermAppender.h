@@ -105,6 +105,48 @@ public:
         return static_cast<std::int32_t>(resultingOffset);
     }
 
+    /*
+     * Claims one frame per length after a single reservation of batchLength, the sum of the aligned frame lengths.
+     * Each claim is committed or aborted independently.
+     */
+    inline std::int32_t claimBatch(
+        const HeaderWriter& header,
+        const util::index_t lengths[],
+        BufferClaim bufferClaims[],
+        size_t count,
+        util::index_t batchLength,
+        std::int32_t activeTermId)
+    {
+        const std::int64_t rawTail = getAndAddRawTail(batchLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+        const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        checkTerm(activeTermId, termId);
+
+        std::int64_t resultingOffset = termOffset + batchLength;
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termOffset, header, termLength, termId);
+        }
+        else
+        {
+            std::int32_t frameOffset = static_cast<std::int32_t>(termOffset);
+            for (size_t i = 0; i < count; i++)
+            {
+                const util::index_t frameLength = lengths[i] + DataFrameHeader::LENGTH;
+
+                header.write(m_termBuffer, frameOffset, frameLength, termId);
+                bufferClaims[i].wrap(m_termBuffer, frameOffset, frameLength);
+
+                frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+        }
+
+        return static_cast<std::int32_t>(resultingOffset);
+    }
+
     inline std::int32_t appendUnfragmentedMessage(
         const HeaderWriter& header,
         const AtomicBuffer& srcBuffer,
@@ -188,6 +230,60 @@ public:
         return static_cast<std::int32_t>(resultingOffset);
     }
 
+    /*
+     * Appends one unfragmented frame per buffer after a single reservation of batchLength, the sum of the aligned
+     * frame lengths. All frames are written before their lengths are published in order.
+     */
+    template <class BufferIterator> std::int32_t appendUnfragmentedBatch(
+        const HeaderWriter& header,
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        util::index_t batchLength,
+        const on_reserved_value_supplier_t& reservedValueSupplier,
+        std::int32_t activeTermId)
+    {
+        const std::int64_t rawTail = getAndAddRawTail(batchLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+        const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        checkTerm(activeTermId, termId);
+
+        std::int64_t resultingOffset = termOffset + batchLength;
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termOffset, header, termLength, termId);
+        }
+        else
+        {
+            std::int32_t frameOffset = static_cast<std::int32_t>(termOffset);
+            for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+            {
+                const util::index_t frameLength = it->capacity() + DataFrameHeader::LENGTH;
+
+                header.write(m_termBuffer, frameOffset, frameLength, termId);
+                m_termBuffer.putBytes(frameOffset + DataFrameHeader::LENGTH, *it, 0, it->capacity());
+
+                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, frameOffset, frameLength);
+                m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+                frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+
+            frameOffset = static_cast<std::int32_t>(termOffset);
+            for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+            {
+                const util::index_t frameLength = it->capacity() + DataFrameHeader::LENGTH;
+
+                FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
+                frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+        }
+
+        return static_cast<std::int32_t>(resultingOffset);
+    }
+
     std::int32_t appendFragmentedMessage(
         const HeaderWriter& header,
         const AtomicBuffer& srcBuffer,
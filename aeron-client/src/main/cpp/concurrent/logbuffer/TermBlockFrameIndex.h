@@ -0,0 +1,149 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_CONCURRENT_TERM_BLOCK_FRAME_INDEX_H
+#define AERON_CONCURRENT_TERM_BLOCK_FRAME_INDEX_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <util/Index.h>
+#include <util/Exceptions.h>
+
+namespace aeron { namespace concurrent { namespace logbuffer {
+
+/**
+ * Index of the frames within a block of a term, filled in by the same header scan which finds the end of the block.
+ *
+ * Offsets, lengths, types and flags are held in separate arrays so a consumer can walk one field for all frames
+ * without touching the term again. Offsets are term offsets, lengths are the unaligned frame lengths from the
+ * headers. The index is reused from poll to poll and never grows, so a block holds at most capacity() frames.
+ */
+class TermBlockFrameIndex
+{
+public:
+    static const std::int32_t DEFAULT_CAPACITY = 1024;
+
+    explicit TermBlockFrameIndex(std::int32_t capacity = DEFAULT_CAPACITY) :
+        m_capacity(capacity)
+    {
+        if (capacity <= 0)
+        {
+            throw util::IllegalArgumentException(
+                "capacity must be positive: " + std::to_string(capacity), SOURCEINFO);
+        }
+
+        m_offsets.resize(static_cast<std::size_t>(capacity));
+        m_lengths.resize(static_cast<std::size_t>(capacity));
+        m_types.resize(static_cast<std::size_t>(capacity));
+        m_flags.resize(static_cast<std::size_t>(capacity));
+    }
+
+    TermBlockFrameIndex(const TermBlockFrameIndex&) = delete;
+    TermBlockFrameIndex& operator=(const TermBlockFrameIndex&) = delete;
+
+    /**
+     * The number of frames in the index.
+     *
+     * @return number of frames in the index.
+     */
+    inline std::int32_t size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * The maximum number of frames the index can hold.
+     *
+     * @return maximum number of frames the index can hold.
+     */
+    inline std::int32_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    inline bool isFull() const
+    {
+        return m_size >= m_capacity;
+    }
+
+    inline util::index_t offset(std::int32_t i) const
+    {
+        return m_offsets[i];
+    }
+
+    inline util::index_t length(std::int32_t i) const
+    {
+        return m_lengths[i];
+    }
+
+    inline std::uint16_t type(std::int32_t i) const
+    {
+        return m_types[i];
+    }
+
+    inline std::uint8_t flags(std::int32_t i) const
+    {
+        return m_flags[i];
+    }
+
+    inline const util::index_t *offsets() const
+    {
+        return m_offsets.data();
+    }
+
+    inline const util::index_t *lengths() const
+    {
+        return m_lengths.data();
+    }
+
+    inline const std::uint16_t *types() const
+    {
+        return m_types.data();
+    }
+
+    inline const std::uint8_t *flags() const
+    {
+        return m_flags.data();
+    }
+
+    inline void clear()
+    {
+        m_size = 0;
+    }
+
+    inline void add(util::index_t offset, util::index_t length, std::uint16_t type, std::uint8_t flags)
+    {
+        const std::size_t i = static_cast<std::size_t>(m_size++);
+
+        m_offsets[i] = offset;
+        m_lengths[i] = length;
+        m_types[i] = type;
+        m_flags[i] = flags;
+    }
+
+private:
+    std::vector<util::index_t> m_offsets;
+    std::vector<util::index_t> m_lengths;
+    std::vector<std::uint16_t> m_types;
+    std::vector<std::uint8_t> m_flags;
+    const std::int32_t m_capacity;
+    std::int32_t m_size = 0;
+};
+
+}}}
+
+#endif
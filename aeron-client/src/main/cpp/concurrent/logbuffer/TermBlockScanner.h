@@ -22,6 +22,7 @@
 #include <concurrent/AtomicBuffer.h>
 #include "LogBufferDescriptor.h"
 #include "Header.h"
+#include "TermBlockFrameIndex.h"
 
 namespace aeron { namespace concurrent { namespace logbuffer {
 
@@ -41,6 +42,24 @@ typedef std::function<void(
     std::int32_t sessionId,
     std::int32_t termId)> block_handler_t;
 
+/**
+ * Callback for handling a block of messages being read from a log along with an index of the frames in the block.
+ *
+ * @param buffer     containing the block of message fragments.
+ * @param offset     at which the block begins.
+ * @param length     of the block in bytes.
+ * @param sessionId  of the stream containing this block of message fragments.
+ * @param termId     of the stream containing this block of message fragments.
+ * @param frameIndex of the frames in the block, valid only for the duration of the callback.
+ */
+typedef std::function<void(
+    concurrent::AtomicBuffer& buffer,
+    util::index_t offset,
+    util::index_t length,
+    std::int32_t sessionId,
+    std::int32_t termId,
+    const TermBlockFrameIndex& frameIndex)> indexed_block_handler_t;
+
 namespace TermBlockScanner {
 
 inline std::int32_t scan(const AtomicBuffer& termBuffer, const std::int32_t termOffset, const std::int32_t limitOffset)
@@ -78,6 +97,60 @@ inline std::int32_t scan(const AtomicBuffer& termBuffer, const std::int32_t term
     return offset;
 }
 
+/**
+ * Scan a term for a block of frames in the same way as scan(const AtomicBuffer&, std::int32_t, std::int32_t) while
+ * recording the offset, length, type and flags of each frame in the block. The scan also stops when the index is full.
+ *
+ * @param termBuffer  to scan.
+ * @param termOffset  at which the scan begins.
+ * @param limitOffset up to which the scan may go.
+ * @param frameIndex  cleared then filled with the frames of the block.
+ * @return the offset at which the block ends.
+ */
+inline std::int32_t scan(
+    const AtomicBuffer& termBuffer,
+    const std::int32_t termOffset,
+    const std::int32_t limitOffset,
+    TermBlockFrameIndex& frameIndex)
+{
+    std::int32_t offset = termOffset;
+    frameIndex.clear();
+
+    while (offset < limitOffset && !frameIndex.isFull())
+    {
+        const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+        if (frameLength <= 0)
+        {
+            break;
+        }
+
+        const std::int32_t alignedFrameLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        const std::uint16_t frameType = termBuffer.getUInt16(FrameDescriptor::typeOffset(offset));
+
+        if (DataFrameHeader::HDR_TYPE_PAD == frameType)
+        {
+            if (termOffset == offset)
+            {
+                frameIndex.add(
+                    offset, frameLength, frameType, termBuffer.getUInt8(FrameDescriptor::flagsOffset(offset)));
+                offset += alignedFrameLength;
+            }
+
+            break;
+        }
+
+        if (offset + alignedFrameLength > limitOffset)
+        {
+            break;
+        }
+
+        frameIndex.add(offset, frameLength, frameType, termBuffer.getUInt8(FrameDescriptor::flagsOffset(offset)));
+        offset += alignedFrameLength;
+    }
+
+    return offset;
+}
+
 }
 
 }}}
@@ -241,6 +241,11 @@ uint8_t* MemoryMappedFile::doMapping(size_t size, FileHandle fd, size_t offset,
     return static_cast<uint8_t*>(memory);
 }
 
+bool MemoryMappedFile::adviseHugePages() noexcept
+{
+    return true;
+}
+
 size_t MemoryMappedFile::getPageSize() noexcept
 {
     SYSTEM_INFO sinfo;
@@ -301,6 +306,18 @@ uint8_t* MemoryMappedFile::doMapping(size_t length, FileHandle fd, size_t offset
     return static_cast<uint8_t*>(memory);
 }
 
+bool MemoryMappedFile::adviseHugePages() noexcept
+{
+#ifdef MADV_HUGEPAGE
+    if (m_memory && m_memorySize)
+    {
+        return 0 == ::madvise(m_memory, m_memorySize, MADV_HUGEPAGE);
+    }
+#endif
+
+    return true;
+}
+
 size_t MemoryMappedFile::getPageSize() noexcept
 {
     return static_cast<size_t>(::getpagesize());
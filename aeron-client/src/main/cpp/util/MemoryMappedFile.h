@@ -56,6 +56,13 @@ public:
     uint8_t* getMemoryPtr() const;
     size_t getMemorySize() const;
 
+    /**
+     * Hint that the mapping should be backed by transparent huge pages where the platform supports it.
+     *
+     * @return true if the hint was taken or the platform has no such hint, false if the platform rejected it.
+     */
+    bool adviseHugePages() noexcept;
+
     MemoryMappedFile(MemoryMappedFile const&) = delete;
     MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
 
@@ -14,8 +14,12 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <gtest/gtest.h>
 
+#include <concurrent/broadcast/BroadcastTransmitter.h>
+#include <command/SubscriptionReadyFlyweight.h>
+
 #include "ClientConductorFixture.h"
 #include "util/TestUtils.h"
 
@@ -82,8 +86,71 @@ public:
 protected:
     std::string m_logFileName;
     std::string m_logFileName2;
+
+    std::unique_ptr<ClientConductor> newBatchingConductor()
+    {
+        return std::unique_ptr<ClientConductor>(new ClientConductor(
+            [&]() { return m_currentTime; },
+            m_driverProxy,
+            m_copyBroadcastReceiver,
+            m_counterMetadataBuffer,
+            m_counterValuesBuffer,
+            [](const std::string&, std::int32_t, std::int32_t, std::int64_t) {},
+            [](const std::string&, std::int32_t, std::int32_t, std::int64_t) {},
+            [](const std::string&, std::int32_t, std::int64_t) {},
+            [&](const std::exception& exception) { m_errorHandler(exception); },
+            [](CountersReader&, std::int64_t, std::int32_t) {},
+            [](CountersReader&, std::int64_t, std::int32_t) {},
+            DRIVER_TIMEOUT_MS,
+            RESOURCE_LINGER_TIMEOUT_MS,
+            INTER_SERVICE_TIMEOUT_NS,
+            PRE_TOUCH_MAPPED_MEMORY,
+            true));
+    }
+
+    std::vector<std::int64_t> readAddPublicationIds()
+    {
+        std::vector<std::int64_t> ids;
+
+        m_manyToOneRingBuffer.read(
+            [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+            {
+                if (ControlProtocolEvents::ADD_PUBLICATION == msgTypeId)
+                {
+                    ids.push_back(PublicationMessageFlyweight(buffer, offset).correlationId());
+                }
+                else if (ControlProtocolEvents::COMMAND_BATCH == msgTypeId)
+                {
+                    const BatchMessageFlyweight batch(buffer, offset);
+                    util::index_t entryOffset = BatchMessageFlyweight::firstEntryOffset();
+
+                    for (std::int32_t i = 0; i < batch.entryCount(); i++)
+                    {
+                        const PublicationMessageFlyweight message(
+                            buffer, offset + BatchMessageFlyweight::entryMessageOffset(entryOffset));
+                        ids.push_back(message.correlationId());
+                        entryOffset = BatchMessageFlyweight::nextEntryOffset(
+                            entryOffset, batch.entryLength(entryOffset));
+                    }
+                }
+            });
+
+        return ids;
+    }
 };
 
+static std::vector<std::pair<std::string, std::int32_t>> moreIpcPublicationsThanFit()
+{
+    std::vector<std::pair<std::string, std::int32_t>> channelStreams;
+
+    for (std::int32_t i = 0; i < 64; i++)
+    {
+        channelStreams.emplace_back("aeron:ipc", STREAM_ID + i);
+    }
+
+    return channelStreams;
+}
+
 TEST_F(ClientConductorTest, shouldReturnNullForUnknownPublication)
 {
     std::shared_ptr<Publication> pub = m_conductor.findPublication(100);
@@ -228,6 +295,398 @@ TEST_F(ClientConductorTest, shouldExceptionOnFindWhenReceivingErrorResponseOnAdd
         util::RegistrationException);
 }
 
+TEST_F(ClientConductorTest, shouldCompleteAsyncAddPublicationWithPublication)
+{
+    std::int64_t completedId = -1;
+    std::shared_ptr<Publication> completedPub;
+    std::exception_ptr completedError;
+
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID,
+        [&](std::int64_t registrationId, std::shared_ptr<Publication> pub, std::exception_ptr error)
+        {
+            completedId = registrationId;
+            completedPub = pub;
+            completedError = error;
+        });
+
+    EXPECT_EQ(completedId, -1);
+
+    m_conductor.onNewPublication(
+        id, id, STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName);
+
+    EXPECT_EQ(completedId, id);
+    EXPECT_TRUE(completedError == nullptr);
+    ASSERT_TRUE(completedPub != nullptr);
+    EXPECT_EQ(completedPub->registrationId(), id);
+    EXPECT_EQ(completedPub->streamId(), STREAM_ID);
+}
+
+TEST_F(ClientConductorTest, shouldCompleteAsyncAddPublicationWithErrorResponse)
+{
+    int completedCount = 0;
+    std::exception_ptr completedError;
+
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID,
+        [&](std::int64_t, std::shared_ptr<Publication> pub, std::exception_ptr error)
+        {
+            completedCount++;
+            completedError = error;
+            EXPECT_TRUE(pub == nullptr);
+        });
+
+    m_conductor.onErrorResponse(id, ERROR_CODE_INVALID_CHANNEL, "invalid channel");
+
+    EXPECT_EQ(completedCount, 1);
+    ASSERT_TRUE(completedError != nullptr);
+    EXPECT_THROW(std::rethrow_exception(completedError), util::RegistrationException);
+}
+
+TEST_F(ClientConductorTest, shouldCompleteAsyncAddPublicationsWithTimeoutFromDutyCycle)
+{
+    std::vector<std::int64_t> timedOutIds;
+
+    std::vector<std::int64_t> ids = m_conductor.addPublications(
+        { { CHANNEL, STREAM_ID }, { CHANNEL, STREAM_ID + 1 } },
+        [&](std::int64_t registrationId, std::shared_ptr<Publication> pub, std::exception_ptr error)
+        {
+            EXPECT_TRUE(pub == nullptr);
+            EXPECT_THROW(std::rethrow_exception(error), util::DriverTimeoutException);
+            timedOutIds.push_back(registrationId);
+        });
+
+    ASSERT_EQ(ids.size(), 2u);
+
+    const long long endTime = m_currentTime + DRIVER_TIMEOUT_MS + 2000;
+    while (m_currentTime < endTime)
+    {
+        m_currentTime += 1000;
+        m_manyToOneRingBuffer.consumerHeartbeatTime(m_currentTime);
+        m_conductor.doWork();
+    }
+
+    std::sort(timedOutIds.begin(), timedOutIds.end());
+    EXPECT_EQ(timedOutIds, ids);
+}
+
+TEST_F(ClientConductorTest, shouldRemovePublicationWhenDriverRespondsAfterAsyncTimeout)
+{
+    static std::int32_t REMOVE_PUBLICATION = ControlProtocolEvents::REMOVE_PUBLICATION;
+    bool timedOut = false;
+
+    std::int64_t id = m_conductor.addPublication(
+        CHANNEL,
+        STREAM_ID,
+        [&](std::int64_t registrationId, std::shared_ptr<Publication> pub, std::exception_ptr error)
+        {
+            timedOut = true;
+        });
+
+    const long long endTime = m_currentTime + DRIVER_TIMEOUT_MS + 2000;
+    while (m_currentTime < endTime)
+    {
+        m_currentTime += 1000;
+        m_manyToOneRingBuffer.consumerHeartbeatTime(m_currentTime);
+        m_conductor.doWork();
+    }
+
+    ASSERT_TRUE(timedOut);
+    m_manyToOneRingBuffer.read(
+        [](std::int32_t, concurrent::AtomicBuffer&, util::index_t, util::index_t) {});
+
+    m_conductor.onNewPublication(
+        id, id, STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName);
+    m_conductor.onNewPublication(
+        id, id, STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName);
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            const RemoveMessageFlyweight message(buffer, offset);
+
+            EXPECT_EQ(msgTypeId, REMOVE_PUBLICATION);
+            EXPECT_EQ(message.registrationId(), id);
+        });
+
+    EXPECT_EQ(count, 1);
+    EXPECT_TRUE(m_conductor.findPublication(id) == nullptr);
+}
+
+TEST_F(ClientConductorTest, shouldFailPendingAsyncCounterOnClose)
+{
+    int calls = 0;
+    bool failed = false;
+
+    std::int64_t id = m_conductor.addCounter(
+        COUNTER_TYPE_ID,
+        nullptr,
+        0,
+        COUNTER_LABEL,
+        [&](std::int64_t registrationId, std::shared_ptr<Counter> counter, std::exception_ptr error)
+        {
+            calls++;
+            failed = nullptr == counter && nullptr != error;
+        });
+
+    m_conductor.closeAllResources(m_currentTime);
+    m_conductor.onAvailableCounter(id, COUNTER_ID);
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(failed);
+}
+
+TEST_F(ClientConductorTest, shouldRemoveCounterWhenDriverRespondsAfterAsyncTimeout)
+{
+    static std::int32_t REMOVE_COUNTER = ControlProtocolEvents::REMOVE_COUNTER;
+    bool timedOut = false;
+
+    std::int64_t id = m_conductor.addCounter(
+        COUNTER_TYPE_ID,
+        nullptr,
+        0,
+        COUNTER_LABEL,
+        [&](std::int64_t registrationId, std::shared_ptr<Counter> counter, std::exception_ptr error)
+        {
+            timedOut = true;
+        });
+
+    const long long endTime = m_currentTime + DRIVER_TIMEOUT_MS + 2000;
+    while (m_currentTime < endTime)
+    {
+        m_currentTime += 1000;
+        m_manyToOneRingBuffer.consumerHeartbeatTime(m_currentTime);
+        m_conductor.doWork();
+    }
+
+    ASSERT_TRUE(timedOut);
+    m_manyToOneRingBuffer.read(
+        [](std::int32_t, concurrent::AtomicBuffer&, util::index_t, util::index_t) {});
+
+    m_conductor.onAvailableCounter(id, COUNTER_ID);
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            const RemoveMessageFlyweight message(buffer, offset);
+
+            EXPECT_EQ(msgTypeId, REMOVE_COUNTER);
+            EXPECT_EQ(message.registrationId(), id);
+        });
+
+    EXPECT_EQ(count, 1);
+}
+
+TEST_F(ClientConductorTest, shouldCompleteAsyncAddDestinationOnOperationSuccess)
+{
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
+    m_conductor.onNewPublication(
+        id, id, STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName);
+
+    int completedCount = 0;
+    std::int64_t completedId = -1;
+
+    std::int64_t correlationId = m_conductor.addDestination(id, CHANNEL,
+        [&](std::int64_t destinationCorrelationId, std::exception_ptr error)
+        {
+            completedCount++;
+            completedId = destinationCorrelationId;
+            EXPECT_TRUE(error == nullptr);
+        });
+
+    m_conductor.onOperationSuccess(correlationId);
+    m_conductor.onOperationSuccess(correlationId);
+
+    EXPECT_EQ(completedCount, 1);
+    EXPECT_EQ(completedId, correlationId);
+}
+
+TEST_F(ClientConductorTest, shouldPackAddPublicationsIntoOneCommandBatch)
+{
+    const std::string ipcChannel = "aeron:ipc";
+    static std::int32_t COMMAND_BATCH = ControlProtocolEvents::COMMAND_BATCH;
+    static std::int32_t ADD_PUBLICATION = ControlProtocolEvents::ADD_PUBLICATION;
+    std::vector<std::int64_t> ids = { m_driverProxy.nextCorrelationId(), m_driverProxy.nextCorrelationId() };
+    std::size_t writtenCount = 0;
+
+    m_driverProxy.addPublications(ids, { { ipcChannel, STREAM_ID }, { ipcChannel, STREAM_ID + 1 } }, writtenCount);
+    EXPECT_EQ(writtenCount, 2u);
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            ASSERT_EQ(msgTypeId, COMMAND_BATCH);
+
+            const BatchMessageFlyweight batch(buffer, offset);
+            ASSERT_EQ(batch.entryCount(), 2);
+
+            util::index_t entryOffset = BatchMessageFlyweight::firstEntryOffset();
+            for (std::int32_t i = 0; i < batch.entryCount(); i++)
+            {
+                EXPECT_EQ(batch.entryMsgTypeId(entryOffset), ADD_PUBLICATION);
+
+                const PublicationMessageFlyweight message(
+                    buffer, offset + BatchMessageFlyweight::entryMessageOffset(entryOffset));
+                EXPECT_EQ(message.correlationId(), ids[i]);
+                EXPECT_EQ(message.streamId(), STREAM_ID + i);
+                EXPECT_EQ(message.channel(), ipcChannel);
+
+                entryOffset = BatchMessageFlyweight::nextEntryOffset(entryOffset, batch.entryLength(entryOffset));
+            }
+        });
+
+    EXPECT_EQ(count, 1);
+}
+
+TEST_F(ClientConductorTest, shouldWriteSingleCommandWithoutBatch)
+{
+    std::vector<std::int64_t> ids = { m_driverProxy.nextCorrelationId() };
+    static std::int32_t ADD_SUBSCRIPTION = ControlProtocolEvents::ADD_SUBSCRIPTION;
+
+    std::size_t writtenCount = 0;
+
+    m_driverProxy.addSubscriptions(ids, { { CHANNEL, STREAM_ID } }, writtenCount);
+    EXPECT_EQ(writtenCount, 1u);
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            const SubscriptionMessageFlyweight message(buffer, offset);
+
+            EXPECT_EQ(msgTypeId, ADD_SUBSCRIPTION);
+            EXPECT_EQ(message.correlationId(), ids[0]);
+            EXPECT_EQ(message.channel(), CHANNEL);
+        });
+
+    EXPECT_EQ(count, 1);
+}
+
+TEST_F(ClientConductorTest, shouldReportCommandsWrittenBeforeRingBufferFills)
+{
+    const std::vector<std::pair<std::string, std::int32_t>> channelStreams = moreIpcPublicationsThanFit();
+    std::vector<std::int64_t> ids;
+    std::size_t writtenCount = 0;
+
+    for (std::size_t i = 0; i < channelStreams.size(); i++)
+    {
+        ids.push_back(m_driverProxy.nextCorrelationId());
+    }
+
+    EXPECT_THROW(m_driverProxy.addPublications(ids, channelStreams, writtenCount), util::IllegalStateException);
+
+    const std::vector<std::int64_t> writtenIds = readAddPublicationIds();
+    ASSERT_GT(writtenCount, 0u);
+    ASSERT_LT(writtenCount, ids.size());
+    EXPECT_EQ(writtenIds, std::vector<std::int64_t>(ids.begin(), ids.begin() + writtenCount));
+}
+
+TEST_F(ClientConductorTest, shouldOnlyRollBackUnsentPublicationsOfFailedAsyncBatch)
+{
+    std::unique_ptr<ClientConductor> conductor = newBatchingConductor();
+    std::vector<std::int64_t> completedIds;
+
+    EXPECT_THROW(
+        conductor->addPublications(
+            moreIpcPublicationsThanFit(),
+            [&](std::int64_t registrationId, std::shared_ptr<Publication> pub, std::exception_ptr error)
+            {
+                EXPECT_TRUE(error == nullptr);
+                completedIds.push_back(registrationId);
+            }),
+        util::IllegalStateException);
+
+    const std::vector<std::int64_t> writtenIds = readAddPublicationIds();
+    ASSERT_FALSE(writtenIds.empty());
+    const std::int64_t writtenId = writtenIds.back();
+    const std::int64_t unsentId = writtenId + 1;
+
+    conductor->onNewPublication(
+        writtenId, writtenId, STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID,
+        m_logFileName);
+    conductor->onNewPublication(
+        unsentId, unsentId, STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID,
+        m_logFileName);
+
+    EXPECT_EQ(completedIds, std::vector<std::int64_t>({ writtenId }));
+    EXPECT_TRUE(conductor->findPublication(unsentId) == nullptr);
+}
+
+TEST_F(ClientConductorTest, shouldRemoveSentPublicationsOfFailedBatchWhenDriverResponds)
+{
+    static std::int32_t REMOVE_PUBLICATION = ControlProtocolEvents::REMOVE_PUBLICATION;
+    std::unique_ptr<ClientConductor> conductor = newBatchingConductor();
+
+    EXPECT_THROW(conductor->addPublications(moreIpcPublicationsThanFit(), nullptr), util::IllegalStateException);
+
+    const std::vector<std::int64_t> writtenIds = readAddPublicationIds();
+    ASSERT_FALSE(writtenIds.empty());
+    const std::int64_t writtenId = writtenIds.front();
+
+    conductor->doWork();
+    conductor->onNewPublication(
+        writtenId, writtenId, STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID,
+        m_logFileName);
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            const RemoveMessageFlyweight message(buffer, offset);
+
+            EXPECT_EQ(msgTypeId, REMOVE_PUBLICATION);
+            EXPECT_EQ(message.registrationId(), writtenId);
+        });
+
+    EXPECT_EQ(count, 1);
+    EXPECT_TRUE(conductor->findPublication(writtenId) == nullptr);
+}
+
+TEST_F(ClientConductorTest, shouldDispatchEachResponseInResponseBatch)
+{
+    std::vector<std::int64_t> completedIds;
+    auto onRegistered = [&](std::int64_t registrationId, std::shared_ptr<Subscription> sub, std::exception_ptr error)
+    {
+        EXPECT_TRUE(error == nullptr);
+        ASSERT_TRUE(sub != nullptr);
+        EXPECT_EQ(sub->registrationId(), registrationId);
+        completedIds.push_back(registrationId);
+    };
+
+    std::vector<std::int64_t> ids = m_conductor.addSubscriptions(
+        { { CHANNEL, STREAM_ID }, { CHANNEL, STREAM_ID + 1 } },
+        m_onAvailableImageHandler,
+        m_onUnavailableImageHandler,
+        onRegistered);
+
+    typedef std::array<std::uint8_t, 128> batch_buffer_t;
+    typedef std::array<std::uint8_t, SUBSCRIPTION_READY_LENGTH> response_buffer_t;
+
+    AERON_DECL_ALIGNED(batch_buffer_t batchBuffer, 16);
+    AtomicBuffer batch(batchBuffer);
+    BatchMessageFlyweight batchMessage(batch, 0);
+    util::index_t entryOffset = BatchMessageFlyweight::firstEntryOffset();
+    util::index_t length = 0;
+
+    for (std::int64_t id : ids)
+    {
+        AERON_DECL_ALIGNED(response_buffer_t responseBuffer, 16);
+        AtomicBuffer response(responseBuffer);
+        SubscriptionReadyFlyweight subscriptionReady(response, 0);
+
+        subscriptionReady.correlationId(id).channelStatusIndicatorId(CHANNEL_STATUS_INDICATOR_ID);
+        length = batchMessage.putEntry(
+            entryOffset, ControlProtocolEvents::ON_SUBSCRIPTION_READY, response.buffer(), SUBSCRIPTION_READY_LENGTH);
+        entryOffset = BatchMessageFlyweight::nextEntryOffset(entryOffset, SUBSCRIPTION_READY_LENGTH);
+    }
+
+    batchMessage.clientId(m_driverProxy.clientId()).correlationId(0);
+    batchMessage.entryCount(static_cast<std::int32_t>(ids.size()));
+
+    BroadcastTransmitter transmitter(m_toClientsBuffer);
+    transmitter.transmit(ControlProtocolEvents::ON_BATCH, batch, 0, length);
+
+    m_conductor.doWork();
+
+    EXPECT_EQ(completedIds, ids);
+}
+
 TEST_F(ClientConductorTest, shouldReturnNullForUnknownExclusivePublication)
 {
     std::shared_ptr<ExclusivePublication> pub = m_conductor.findExclusivePublication(100);
@@ -858,6 +1317,21 @@ TEST_F(ClientConductorTest, shouldCloseSubscriptionOnInterServiceTimeout)
     EXPECT_TRUE(sub->isClosed());
 }
 
+TEST_F(ClientConductorTest, shouldCloseCounterOnInterServiceTimeout)
+{
+    std::int64_t id = m_conductor.addCounter(COUNTER_TYPE_ID, nullptr, 0, COUNTER_LABEL);
+
+    m_conductor.onAvailableCounter(id, COUNTER_ID);
+
+    std::shared_ptr<Counter> counter = m_conductor.findCounter(id);
+
+    ASSERT_TRUE(counter != nullptr);
+
+    m_conductor.closeAllResources(m_currentTime);
+
+    EXPECT_TRUE(counter->isClosed());
+}
+
 TEST_F(ClientConductorTest, shouldCloseAllPublicationsAndSubscriptionsOnInterServiceTimeout)
 {
     std::int64_t pubId = m_conductor.addPublication(CHANNEL, STREAM_ID);
@@ -1090,6 +1564,53 @@ TEST_F(ClientConductorTest, shouldCallOnUnavailableCounter)
     m_conductor.onUnavailableCounter(id, COUNTER_ID);
 }
 
+static int countingCounterHandlerCalls = 0;
+
+static void countingCounterHandler(CountersReader& countersReader, std::int64_t registrationId, std::int32_t counterId)
+{
+    countingCounterHandlerCalls++;
+}
+
+TEST_F(ClientConductorTest, shouldNotCallCounterHandlersOnceRemoved)
+{
+    std::int64_t id = 101;
+    countingCounterHandlerCalls = 0;
+
+    m_conductor.addAvailableCounterHandler(countingCounterHandler);
+    m_conductor.addUnavailableCounterHandler(countingCounterHandler);
+    m_conductor.onAvailableCounter(id, COUNTER_ID);
+    m_conductor.onUnavailableCounter(id, COUNTER_ID);
+    EXPECT_EQ(countingCounterHandlerCalls, 2);
+
+    m_conductor.removeAvailableCounterHandler(countingCounterHandler);
+    m_conductor.removeUnavailableCounterHandler(countingCounterHandler);
+    m_conductor.onAvailableCounter(id, COUNTER_ID);
+    m_conductor.onUnavailableCounter(id, COUNTER_ID);
+    EXPECT_EQ(countingCounterHandlerCalls, 2);
+}
+
+static ClientConductor *selfRemovingCounterHandlerConductor = nullptr;
+
+static void selfRemovingCounterHandler(
+    CountersReader& countersReader, std::int64_t registrationId, std::int32_t counterId)
+{
+    countingCounterHandlerCalls++;
+    selfRemovingCounterHandlerConductor->removeAvailableCounterHandler(selfRemovingCounterHandler);
+}
+
+TEST_F(ClientConductorTest, shouldAllowCounterHandlerToRemoveItselfWhenCalled)
+{
+    std::int64_t id = 101;
+    countingCounterHandlerCalls = 0;
+    selfRemovingCounterHandlerConductor = &m_conductor;
+    m_errorHandler = [&](const std::exception& exception) {};
+
+    m_conductor.addAvailableCounterHandler(selfRemovingCounterHandler);
+    m_conductor.onAvailableCounter(id, COUNTER_ID);
+    m_conductor.onAvailableCounter(id, COUNTER_ID);
+    EXPECT_EQ(countingCounterHandlerCalls, 1);
+}
+
 TEST_F(ClientConductorTest, shouldThrowExceptionOnReentrantCallback)
 {
     m_conductor.addAvailableCounterHandler(
@@ -19,6 +19,7 @@
 #include <array>
 #include "FragmentAssembler.h"
 #include "ControlledFragmentAssembler.h"
+#include "ArenaFragmentAssembler.h"
 
 using namespace aeron::util;
 using namespace aeron;
@@ -235,3 +236,163 @@ TEST_F(FragmentAssemblerTest, shouldNotReassembleIfMissingBegin)
     adapter.handler()(m_buffer, (MTU_LENGTH * 2) + DataFrameHeader::LENGTH, msgLength, m_header);
     ASSERT_FALSE(called);
 }
+
+TEST_F(FragmentAssemblerTest, shouldReassembleThroughInlinedDelegate)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int calls = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        ++calls;
+        EXPECT_EQ(length, msgLength * 2);
+        EXPECT_EQ(header.flags(), FrameDescriptor::END_FRAG);
+        verifyPayload(buffer, offset, length);
+    };
+
+    auto adapter = makeFragmentAssembler(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_EQ(calls, 0);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    adapter(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_EQ(calls, 1);
+}
+
+TEST_F(FragmentAssemblerTest, shouldRetainFragmentsWhenInlinedControlledDelegateAborts)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int calls = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        ++calls;
+        EXPECT_EQ(length, msgLength * 2);
+        verifyPayload(buffer, offset, length);
+
+        return 1 == calls ? ControlledPollAction::ABORT : ControlledPollAction::CONTINUE;
+    };
+
+    auto adapter = makeControlledFragmentAssembler(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    EXPECT_EQ(adapter(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::CONTINUE);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    EXPECT_EQ(
+        adapter(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::ABORT);
+    EXPECT_EQ(
+        adapter(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::CONTINUE);
+    ASSERT_EQ(calls, 2);
+}
+
+TEST_F(FragmentAssemblerTest, shouldReassembleFromTwoFragmentsInArena)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int calls = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        ++calls;
+        EXPECT_EQ(offset, DataFrameHeader::LENGTH);
+        EXPECT_EQ(length, msgLength * 2);
+        EXPECT_EQ(header.sessionId(), SESSION_ID);
+        verifyPayload(buffer, offset, length);
+    };
+
+    ArenaFragmentAssembler adapter(handler, static_cast<std::uint32_t>(msgLength * 2), 2);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter.handler()(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_EQ(calls, 0);
+    EXPECT_EQ(adapter.sessionCount(), 1u);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_EQ(calls, 1);
+
+    adapter.deleteSessionBuffer(SESSION_ID);
+    EXPECT_EQ(adapter.sessionCount(), 0u);
+}
+
+TEST_F(FragmentAssemblerTest, shouldDropMessageExceedingArenaMaxMessageLength)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int calls = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        ++calls;
+    };
+
+    auto adapter = makeArenaFragmentAssembler(handler, static_cast<std::uint32_t>(msgLength), 1);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(0, MTU_LENGTH, msgLength, msgLength % 256);
+    EXPECT_THROW(
+        adapter(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header), util::IllegalStateException);
+
+    m_header.offset(MTU_LENGTH * 2);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH * 2, msgLength, (msgLength * 2) % 256);
+    adapter(m_buffer, (MTU_LENGTH * 2) + DataFrameHeader::LENGTH, msgLength, m_header);
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(FragmentAssemblerTest, shouldReuseArenaSlotsOfEvictedSessions)
+{
+    const std::int32_t maxSessions = 4;
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    std::vector<std::int32_t> delivered;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        delivered.push_back(header.sessionId());
+        EXPECT_EQ(length, msgLength * 2);
+        verifyPayload(buffer, offset, length);
+    };
+
+    auto adapter = makeArenaFragmentAssembler(handler, static_cast<std::uint32_t>(msgLength * 2), maxSessions);
+    auto onFrame = [&](std::uint8_t flags, std::int32_t sessionId, std::int32_t frameOffset, std::uint8_t value)
+    {
+        fillFrame(flags, frameOffset, msgLength, value);
+        m_buffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(frameOffset).sessionId = sessionId;
+        m_header.offset(frameOffset);
+        adapter(m_buffer, frameOffset + DataFrameHeader::LENGTH, msgLength, m_header);
+    };
+
+    for (std::int32_t sessionId = 0; sessionId < maxSessions; sessionId++)
+    {
+        onFrame(FrameDescriptor::BEGIN_FRAG, sessionId * 16, 0, 0);
+    }
+
+    EXPECT_THROW(onFrame(FrameDescriptor::BEGIN_FRAG, 1000, 0, 0), util::IllegalStateException);
+
+    adapter.deleteSessionBuffer(16);
+    adapter.deleteSessionBuffer(32);
+    EXPECT_EQ(adapter.sessionCount(), static_cast<std::size_t>(maxSessions - 2));
+
+    onFrame(FrameDescriptor::BEGIN_FRAG, 1000, 0, 0);
+    for (std::int32_t sessionId : { 0, 48, 1000 })
+    {
+        onFrame(FrameDescriptor::END_FRAG, sessionId, MTU_LENGTH, msgLength % 256);
+    }
+
+    onFrame(FrameDescriptor::END_FRAG, 16, MTU_LENGTH, msgLength % 256);
+    EXPECT_EQ(delivered, std::vector<std::int32_t>({ 0, 48, 1000 }));
+}
+
+TEST_F(FragmentAssemblerTest, shouldRejectArenaWithoutSessions)
+{
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+    };
+
+    EXPECT_THROW(makeArenaFragmentAssembler(handler, MTU_LENGTH, 0), util::IllegalArgumentException);
+}
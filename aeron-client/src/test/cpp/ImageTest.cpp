@@ -15,6 +15,7 @@
  */
 
 #include <array>
+#include <map>
 
 #include <gtest/gtest.h>
 
@@ -50,6 +51,11 @@ static const std::int32_t POSITION_BITS_TO_SHIFT = BitUtil::numberOfTrailingZero
 static const util::index_t ALIGNED_FRAME_LENGTH =
     BitUtil::align(DataFrameHeader::LENGTH + (std::int32_t)DATA.size(), FrameDescriptor::FRAME_ALIGNMENT);
 
+static std::int64_t packTail(std::int32_t termId, std::int32_t termOffset)
+{
+    return (static_cast<std::int64_t>(termId) << 32) + termOffset;
+}
+
 void exceptionHandler(const std::exception&)
 {
 }
@@ -66,7 +72,7 @@ public:
     MOCK_CONST_METHOD4(onFragment, ControlledPollAction(AtomicBuffer&, util::index_t, util::index_t, Header&));
 };
 
-class ImageTest : public testing::Test, ClientConductorFixture
+class ImageTest : public testing::Test, public ClientConductorFixture
 {
 public:
     ImageTest() :
@@ -613,3 +619,158 @@ TEST_F(ImageTest, shouldPollFragmentsToBoundedControlledFragmentHandlerWithMaxPo
     EXPECT_EQ(m_subscriberPosition.get(), TERM_LENGTH);
     EXPECT_EQ(image.position(), TERM_LENGTH);
 }
+
+TEST_F(ImageTest, shouldReportAvailablePositionFromTermTail)
+{
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+    const std::int32_t tailOffset = offsetOfFrame(3);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    EXPECT_EQ(image.availablePosition(), initialPosition);
+
+    m_logMetaDataBuffer.putInt64(
+        LogBufferDescriptor::TERM_TAIL_COUNTER_OFFSET, packTail(INITIAL_TERM_ID, tailOffset));
+
+    EXPECT_EQ(image.availablePosition(), initialPosition + tailOffset);
+}
+
+TEST_F(ImageTest, shouldIgnoreZeroedTermTailsWithNegativeInitialTermId)
+{
+    const std::int32_t initialTermId = -7;
+    m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_INITIAL_TERM_ID_OFFSET, initialTermId);
+
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        initialTermId, offsetOfFrame(1), POSITION_BITS_TO_SHIFT, initialTermId);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    EXPECT_EQ(image.availablePosition(), initialPosition);
+
+    const std::int32_t tailOffset = offsetOfFrame(3);
+    m_logMetaDataBuffer.putInt64(
+        LogBufferDescriptor::TERM_TAIL_COUNTER_OFFSET, packTail(initialTermId, tailOffset));
+
+    EXPECT_EQ(image.availablePosition(), initialPosition - offsetOfFrame(1) + tailOffset);
+}
+
+TEST_F(ImageTest, shouldBoundedPollWholeFragmentsStartingBeforeMaxPosition)
+{
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(0));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(1));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(2));
+
+    EXPECT_CALL(m_fragmentHandler, onFragment(testing::_, testing::_, static_cast<index_t>(DATA.size()), testing::_))
+        .Times(2);
+
+    const int fragments = image.boundedPoll(m_handler, initialPosition + ALIGNED_FRAME_LENGTH + 1, INT_MAX);
+    EXPECT_EQ(fragments, 2);
+    EXPECT_EQ(image.position(), initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+}
+
+TEST_F(ImageTest, shouldFairPollImagesInProportionToBacklog)
+{
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+    UnsafeBufferPosition otherSubscriberPosition(m_counterValuesBuffer, SUBSCRIBER_POSITION_ID + 1);
+
+    for (int i = 0; i < 12; i++)
+    {
+        insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(i));
+    }
+    m_logMetaDataBuffer.putInt64(
+        LogBufferDescriptor::TERM_TAIL_COUNTER_OFFSET, packTail(INITIAL_TERM_ID, offsetOfFrame(12)));
+
+    m_subscriberPosition.set(initialPosition + offsetOfFrame(4));
+    otherSubscriberPosition.set(initialPosition + offsetOfFrame(8));
+
+    Subscription subscription(m_conductor, SUBSCRIPTION_REGISTRATION_ID, "aeron:ipc", STREAM_ID, -1);
+    delete[] subscription.addImage(std::make_shared<Image>(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, otherSubscriberPosition, m_logBuffers, exceptionHandler));
+    delete[] subscription.addImage(std::make_shared<Image>(
+        SESSION_ID, CORRELATION_ID + 1, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler));
+
+    std::map<std::int64_t, long> consumedByImage;
+    int fragments = 0;
+
+    const long bytesConsumed = subscription.fairPoll(
+        [&](AtomicBuffer&, util::index_t, util::index_t, Header&)
+        {
+            fragments++;
+        },
+        6 * ALIGNED_FRAME_LENGTH,
+        [&](Image& image, long bytes)
+        {
+            consumedByImage[image.correlationId()] = bytes;
+        });
+
+    EXPECT_EQ(bytesConsumed, 6 * ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(fragments, 6);
+    EXPECT_EQ(consumedByImage[CORRELATION_ID + 1], 4 * ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(consumedByImage[CORRELATION_ID], 2 * ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + offsetOfFrame(8));
+    EXPECT_EQ(otherSubscriberPosition.get(), initialPosition + offsetOfFrame(10));
+}
+
+TEST_F(ImageTest, shouldBlockPollWithFrameIndexLimitedByIndexCapacity)
+{
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(0));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(1));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(2));
+
+    TermBlockFrameIndex frameIndex(2);
+    std::vector<util::index_t> frameOffsets;
+    util::index_t blockOffset = -1;
+    util::index_t blockLength = 0;
+
+    auto handler = [&](
+        AtomicBuffer&, util::index_t offset, util::index_t length, std::int32_t sessionId, std::int32_t termId,
+        const TermBlockFrameIndex& index)
+    {
+        EXPECT_EQ(sessionId, SESSION_ID);
+        EXPECT_EQ(termId, INITIAL_TERM_ID);
+        blockOffset = offset;
+        blockLength = length;
+
+        for (std::int32_t i = 0; i < index.size(); i++)
+        {
+            EXPECT_EQ(index.length(i), DataFrameHeader::LENGTH + static_cast<index_t>(DATA.size()));
+            EXPECT_EQ(index.flags(i), FrameDescriptor::UNFRAGMENTED);
+            frameOffsets.push_back(index.offset(i));
+        }
+    };
+
+    EXPECT_EQ(image.blockPoll(handler, TERM_LENGTH, frameIndex), 2 * ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(blockOffset, offsetOfFrame(0));
+    EXPECT_EQ(blockLength, 2 * ALIGNED_FRAME_LENGTH);
+
+    EXPECT_EQ(image.blockPoll(handler, TERM_LENGTH, frameIndex), ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(blockOffset, offsetOfFrame(2));
+    EXPECT_EQ(frameOffsets, std::vector<util::index_t>({ offsetOfFrame(0), offsetOfFrame(1), offsetOfFrame(2) }));
+    EXPECT_EQ(image.position(), initialPosition + (3 * ALIGNED_FRAME_LENGTH));
+}
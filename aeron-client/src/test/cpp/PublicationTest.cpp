@@ -215,3 +215,88 @@ TEST_F(PublicationTest, shouldRotateWhenClaimTrips)
     EXPECT_GT(m_publication->tryClaim(SRC_BUFFER_LENGTH, bufferClaim), initialPosition + DataFrameHeader::LENGTH + m_srcBuffer.capacity());
     EXPECT_GT(m_publication->position(), initialPosition + DataFrameHeader::LENGTH + m_srcBuffer.capacity());
 }
+
+TEST_F(PublicationTest, shouldOfferBatchOfMessagesAsSeparateFrames)
+{
+    const std::array<AtomicBuffer, 3> batch = {{
+        AtomicBuffer(m_src.data(), 100), AtomicBuffer(m_src.data() + 100, 200), AtomicBuffer(m_src.data() + 300, 24) }};
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    EXPECT_EQ(m_publication->offerBatch(batch), 160 + 256 + 64);
+    EXPECT_EQ(m_publication->position(), 160 + 256 + 64);
+
+    AtomicBuffer& termBuffer = m_termBuffers[LogBufferDescriptor::indexByTermCount(0)];
+    EXPECT_EQ(FrameDescriptor::frameLengthVolatile(termBuffer, 0), 100 + DataFrameHeader::LENGTH);
+    EXPECT_EQ(FrameDescriptor::frameLengthVolatile(termBuffer, 160), 200 + DataFrameHeader::LENGTH);
+    EXPECT_EQ(FrameDescriptor::frameLengthVolatile(termBuffer, 160 + 256), 24 + DataFrameHeader::LENGTH);
+    EXPECT_EQ(termBuffer.getInt32(160 + DataFrameHeader::TERM_OFFSET_FIELD_OFFSET), 160);
+}
+
+TEST_F(PublicationTest, shouldRotateWhenBatchTrips)
+{
+    const int activeIndex = LogBufferDescriptor::indexByTermCount(0);
+    const std::int64_t initialPosition = TERM_LENGTH - 256;
+    m_logMetaDataBuffer.putInt64(termTailCounterOffset(activeIndex), rawTailValue(TERM_ID_1, initialPosition));
+    m_publicationLimit.set(LONG_MAX);
+
+    const std::array<AtomicBuffer, 2> batch = {{
+        AtomicBuffer(m_src.data(), 100), AtomicBuffer(m_src.data() + 100, 100) }};
+
+    EXPECT_EQ(m_publication->offerBatch(batch), ADMIN_ACTION);
+    EXPECT_EQ(m_logMetaDataBuffer.getInt32(LogBufferDescriptor::LOG_ACTIVE_TERM_COUNT_OFFSET), 1);
+    EXPECT_TRUE(
+        FrameDescriptor::isPaddingFrame(m_termBuffers[activeIndex], static_cast<util::index_t>(initialPosition)));
+
+    EXPECT_EQ(m_publication->offerBatch(batch), TERM_LENGTH + 160 + 160);
+}
+
+TEST_F(PublicationTest, shouldRejectBatchWithMessageExceedingMaxPayloadLength)
+{
+    const std::array<AtomicBuffer, 2> batch = {{
+        AtomicBuffer(m_src.data(), 100), AtomicBuffer(m_src.data(), m_publication->maxPayloadLength() + 1) }};
+    m_publicationLimit.set(LONG_MAX);
+
+    EXPECT_THROW(m_publication->offerBatch(batch), util::IllegalArgumentException);
+    EXPECT_EQ(m_publication->position(), 0);
+}
+
+TEST_F(PublicationTest, shouldClaimBatchOfFramesWithSingleReservation)
+{
+    const std::array<util::index_t, 3> lengths = {{ 100, 200, 24 }};
+    std::array<BufferClaim, 3> bufferClaims;
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    EXPECT_EQ(m_publication->tryClaimBatch(lengths, bufferClaims), 160 + 256 + 64);
+    EXPECT_EQ(m_publication->position(), 160 + 256 + 64);
+
+    AtomicBuffer& termBuffer = m_termBuffers[LogBufferDescriptor::indexByTermCount(0)];
+    EXPECT_EQ(bufferClaims[1].buffer().buffer(), termBuffer.buffer() + 160);
+    EXPECT_EQ(bufferClaims[2].length(), 24);
+    EXPECT_EQ(FrameDescriptor::frameLengthVolatile(termBuffer, 160), -(200 + DataFrameHeader::LENGTH));
+
+    bufferClaims[1].commit();
+    EXPECT_EQ(FrameDescriptor::frameLengthVolatile(termBuffer, 0), -(100 + DataFrameHeader::LENGTH));
+    EXPECT_EQ(FrameDescriptor::frameLengthVolatile(termBuffer, 160), 200 + DataFrameHeader::LENGTH);
+
+    BufferClaim::commit(bufferClaims.data(), bufferClaims.size());
+    EXPECT_EQ(FrameDescriptor::frameLengthVolatile(termBuffer, 0), 100 + DataFrameHeader::LENGTH);
+    EXPECT_EQ(FrameDescriptor::frameLengthVolatile(termBuffer, 160 + 256), 24 + DataFrameHeader::LENGTH);
+}
+
+TEST_F(PublicationTest, shouldRotateWhenClaimBatchTrips)
+{
+    const int activeIndex = LogBufferDescriptor::indexByTermCount(0);
+    const std::int64_t initialPosition = TERM_LENGTH - 256;
+    m_logMetaDataBuffer.putInt64(termTailCounterOffset(activeIndex), rawTailValue(TERM_ID_1, initialPosition));
+    m_publicationLimit.set(LONG_MAX);
+
+    const std::array<util::index_t, 2> lengths = {{ 100, 100 }};
+    std::array<BufferClaim, 2> bufferClaims;
+
+    EXPECT_EQ(m_publication->tryClaimBatch(lengths, bufferClaims), ADMIN_ACTION);
+    EXPECT_EQ(m_logMetaDataBuffer.getInt32(LogBufferDescriptor::LOG_ACTIVE_TERM_COUNT_OFFSET), 1);
+
+    EXPECT_EQ(m_publication->tryClaimBatch(lengths, bufferClaims), TERM_LENGTH + 160 + 160);
+    BufferClaim::abort(bufferClaims.data(), bufferClaims.size());
+    EXPECT_TRUE(FrameDescriptor::isPaddingFrame(m_termBuffers[LogBufferDescriptor::indexByTermCount(1)], 160));
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <concurrent/RegistrationMap.h>
+#include <concurrent/ManyToOneConcurrentLinkedQueue.h>
+
+using namespace aeron::concurrent;
+
+static const long long LINGER_TIMEOUT_MS = 1000;
+
+struct TestValue
+{
+    std::string m_name;
+    int m_count;
+
+    TestValue(const std::string& name, int count) : m_name(name), m_count(count)
+    {
+    }
+};
+
+TEST(registrationMapTest, shouldFindEmplacedValue)
+{
+    RegistrationMap<TestValue> map(16);
+
+    TestValue& value = map.emplace(7, "seven", 7);
+
+    TestValue *found = map.find(7);
+    ASSERT_EQ(found, &value);
+    EXPECT_EQ(found->m_name, "seven");
+    EXPECT_EQ(found->m_count, 7);
+    EXPECT_EQ(map.find(8), nullptr);
+}
+
+TEST(registrationMapTest, shouldFindValuesSharingBucket)
+{
+    RegistrationMap<TestValue> map(1);
+
+    for (int i = 0; i < 100; i++)
+    {
+        map.emplace(i, std::to_string(i), i);
+    }
+
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_NE(map.find(i), nullptr);
+        EXPECT_EQ(map.find(i)->m_count, i);
+    }
+}
+
+TEST(registrationMapTest, shouldRemoveValueOnlyOnce)
+{
+    RegistrationMap<TestValue> map(16);
+    TestValue& value = map.emplace(3, "three", 3);
+
+    EXPECT_EQ(map.remove(3), &value);
+    EXPECT_EQ(map.remove(3), nullptr);
+    EXPECT_EQ(map.find(3), nullptr);
+}
+
+TEST(registrationMapTest, shouldKeepRemovedValueReadableUntilLingerExpires)
+{
+    RegistrationMap<TestValue> map(1);
+    map.emplace(1, "one", 1);
+    TestValue& value = map.emplace(2, "two", 2);
+    map.emplace(3, "three", 3);
+
+    map.remove(2);
+    map.reclaim(100, LINGER_TIMEOUT_MS);
+
+    EXPECT_EQ(value.m_name, "two");
+    EXPECT_EQ(map.find(1)->m_count, 1);
+    EXPECT_EQ(map.find(3)->m_count, 3);
+
+    map.reclaim(100 + LINGER_TIMEOUT_MS + 1, LINGER_TIMEOUT_MS);
+
+    EXPECT_EQ(map.find(1)->m_count, 1);
+    EXPECT_EQ(map.find(2), nullptr);
+    EXPECT_EQ(map.find(3)->m_count, 3);
+}
+
+TEST(registrationMapTest, shouldRemoveAllAndSkipRemovedInForEach)
+{
+    RegistrationMap<TestValue> map(4);
+
+    for (int i = 0; i < 10; i++)
+    {
+        map.emplace(i, std::to_string(i), i);
+    }
+
+    map.remove(4);
+
+    int visited = 0;
+    map.forEach([&](std::int64_t key, TestValue& value) { visited++; });
+    EXPECT_EQ(visited, 9);
+
+    int removed = 0;
+    map.removeAll([&](std::int64_t key, TestValue& value) { removed++; });
+    EXPECT_EQ(removed, 9);
+
+    visited = 0;
+    map.forEach([&](std::int64_t key, TestValue& value) { visited++; });
+    EXPECT_EQ(visited, 0);
+}
+
+TEST(registrationMapTest, shouldInsertAndFindFromManyThreadsWhileReclaiming)
+{
+    const int threadCount = 4;
+    const int perThread = 2000;
+    RegistrationMap<TestValue> map(64);
+    std::atomic<bool> running(true);
+    std::vector<std::thread> threads;
+
+    std::thread owner([&]()
+    {
+        long long nowMs = 0;
+        while (running)
+        {
+            map.reclaim(nowMs++, 10);
+        }
+    });
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (int i = 0; i < perThread; i++)
+            {
+                const std::int64_t key = (static_cast<std::int64_t>(i) * threadCount) + t;
+                map.emplace(key, "", i);
+
+                TestValue *value = map.find(key);
+                ASSERT_NE(value, nullptr);
+                ASSERT_EQ(value->m_count, i);
+
+                if (0 == (i & 1))
+                {
+                    ASSERT_EQ(map.remove(key), value);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    running = false;
+    owner.join();
+
+    for (std::int64_t key = 0; key < (threadCount * perThread); key++)
+    {
+        TestValue *value = map.find(key);
+        const int i = static_cast<int>(key / threadCount);
+
+        if (0 == (i & 1))
+        {
+            EXPECT_EQ(value, nullptr);
+        }
+        else
+        {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(value->m_count, i);
+        }
+    }
+}
+
+TEST(manyToOneConcurrentLinkedQueueTest, shouldDrainInOrderUpToLimit)
+{
+    ManyToOneConcurrentLinkedQueue<int> queue;
+    std::vector<int> drained;
+    auto handler = [&](int& value) { drained.push_back(value); };
+
+    EXPECT_TRUE(queue.isEmpty());
+
+    for (int i = 0; i < 5; i++)
+    {
+        queue.offer(i);
+    }
+
+    EXPECT_EQ(queue.drain(handler, 3), 3);
+    EXPECT_EQ(queue.drain(handler), 2);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(drained, std::vector<int>({ 0, 1, 2, 3, 4 }));
+}
+
+TEST(manyToOneConcurrentLinkedQueueTest, shouldDrainAllOffersFromManyThreadsInProducerOrder)
+{
+    const int threadCount = 4;
+    const int perThread = 10000;
+    ManyToOneConcurrentLinkedQueue<std::int64_t> queue;
+    std::vector<std::thread> threads;
+    std::vector<std::int64_t> lastSeen(threadCount, -1);
+    int drained = 0;
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (std::int64_t i = 0; i < perThread; i++)
+            {
+                queue.offer((i * threadCount) + t);
+            }
+        });
+    }
+
+    auto handler = [&](std::int64_t& value)
+    {
+        const int producer = static_cast<int>(value % threadCount);
+        const std::int64_t sequence = value / threadCount;
+
+        EXPECT_EQ(sequence, lastSeen[producer] + 1);
+        lastSeen[producer] = sequence;
+    };
+
+    while (drained < (threadCount * perThread))
+    {
+        drained += queue.drain(handler);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_TRUE(queue.isEmpty());
+}
@@ -229,4 +229,77 @@ TEST_F(TermBlockScannerTest, shouldReadBlockOfOneMessageThenPadding)
 
     const std::int32_t offsetTwo = TermBlockScanner::scan(m_log, offsetOne, limitOffset);
     EXPECT_EQ(offsetTwo, alignedMessageLength * 2);
-}
\ No newline at end of file
+}
+TEST_F(TermBlockScannerTest, shouldIndexFramesOfBlock)
+{
+    const std::int32_t offset = 0;
+    const std::int32_t limitOffset = m_log.capacity();
+    const std::int32_t messageLength = 50;
+    const std::int32_t alignedMessageLength = util::BitUtil::align(messageLength, FrameDescriptor::FRAME_ALIGNMENT);
+    TermBlockFrameIndex frameIndex(8);
+
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(offset)))
+        .WillOnce(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(offset)))
+        .WillOnce(testing::Return(DataFrameHeader::HDR_TYPE_DATA));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(alignedMessageLength)))
+        .WillOnce(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(alignedMessageLength)))
+        .WillOnce(testing::Return(DataFrameHeader::HDR_TYPE_DATA));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(alignedMessageLength * 2)))
+        .WillOnce(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(alignedMessageLength * 2)))
+        .WillOnce(testing::Return(DataFrameHeader::HDR_TYPE_PAD));
+
+    const std::int32_t newOffset = TermBlockScanner::scan(m_log, offset, limitOffset, frameIndex);
+
+    EXPECT_EQ(newOffset, alignedMessageLength * 2);
+    ASSERT_EQ(frameIndex.size(), 2);
+    EXPECT_EQ(frameIndex.offset(0), offset);
+    EXPECT_EQ(frameIndex.offset(1), alignedMessageLength);
+    EXPECT_EQ(frameIndex.length(0), messageLength);
+    EXPECT_EQ(frameIndex.length(1), messageLength);
+    EXPECT_EQ(frameIndex.type(0), DataFrameHeader::HDR_TYPE_DATA);
+    EXPECT_EQ(frameIndex.type(1), DataFrameHeader::HDR_TYPE_DATA);
+}
+
+TEST_F(TermBlockScannerTest, shouldStopIndexingWhenFrameIndexIsFull)
+{
+    const std::int32_t offset = 0;
+    const std::int32_t limitOffset = m_log.capacity();
+    const std::int32_t messageLength = 50;
+    const std::int32_t alignedMessageLength = util::BitUtil::align(messageLength, FrameDescriptor::FRAME_ALIGNMENT);
+    TermBlockFrameIndex frameIndex(1);
+
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(offset)))
+        .WillOnce(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(offset)))
+        .WillOnce(testing::Return(DataFrameHeader::HDR_TYPE_DATA));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(alignedMessageLength)))
+        .Times(0);
+
+    const std::int32_t newOffset = TermBlockScanner::scan(m_log, offset, limitOffset, frameIndex);
+
+    EXPECT_EQ(newOffset, alignedMessageLength);
+    EXPECT_EQ(frameIndex.size(), 1);
+}
+
+TEST_F(TermBlockScannerTest, shouldIndexPaddingFrameAtStartOfBlock)
+{
+    const std::int32_t offset = 0;
+    const std::int32_t limitOffset = m_log.capacity();
+    const std::int32_t paddingLength = m_log.capacity();
+    TermBlockFrameIndex frameIndex(8);
+
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(offset)))
+        .WillOnce(testing::Return(paddingLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(offset)))
+        .WillOnce(testing::Return(DataFrameHeader::HDR_TYPE_PAD));
+
+    const std::int32_t newOffset = TermBlockScanner::scan(m_log, offset, limitOffset, frameIndex);
+
+    EXPECT_EQ(newOffset, paddingLength);
+    ASSERT_EQ(frameIndex.size(), 1);
+    EXPECT_EQ(frameIndex.length(0), paddingLength);
+    EXPECT_EQ(frameIndex.type(0), DataFrameHeader::HDR_TYPE_PAD);
+}
@@ -18,9 +18,13 @@
 #include <string>
 
 #include <util/MemoryMappedFile.h>
+#include <LogBuffers.h>
 #include "TestUtils.h"
 
+using namespace aeron;
+using namespace aeron::concurrent;
 using namespace aeron::util;
+using namespace aeron::concurrent::logbuffer;
 using namespace aeron::test;
 
 #ifdef _MSC_VER
@@ -88,3 +92,73 @@ TEST(mmfileTest, writeReadCheck)
 
     ::unlink(name.c_str());
 }
+
+TEST(mmfileTest, adviseHugePagesCheck)
+{
+    MemoryMappedFile::ptr_t m;
+
+    const size_t size = 4 * MemoryMappedFile::getPageSize();
+    const std::string name(makeTempFileName());
+
+    ASSERT_NO_THROW({
+        m = MemoryMappedFile::createNew(name.c_str(), 0, size);
+    });
+
+    // regular file systems either take the hint or ignore it, the mapping stays usable either way
+    EXPECT_TRUE(m->adviseHugePages());
+
+    for (size_t n = 0; n < size; n++)
+    {
+        m->getMemoryPtr()[n] = static_cast<uint8_t>(n & 0xff);
+    }
+
+    for (size_t n = 0; n < size; n++)
+    {
+        ASSERT_EQ(m->getMemoryPtr()[n], static_cast<uint8_t>(n & 0xff));
+    }
+
+    m.reset();
+    ::unlink(name.c_str());
+}
+
+TEST(mmfileTest, logBuffersWithPageSizeAboveOsPageSizeCheck)
+{
+    const std::int32_t termLength = LogBufferDescriptor::TERM_MIN_LENGTH;
+    const std::int32_t pageSize = static_cast<std::int32_t>(16 * MemoryMappedFile::getPageSize());
+    const size_t logLength =
+        (LogBufferDescriptor::PARTITION_COUNT * termLength) + LogBufferDescriptor::LOG_META_DATA_LENGTH;
+    const std::string name(makeTempFileName());
+
+    {
+        MemoryMappedFile::ptr_t m;
+
+        ASSERT_NO_THROW({
+            m = MemoryMappedFile::createNew(name.c_str(), 0, logLength);
+        });
+
+        AtomicBuffer logMetaDataBuffer(
+            m->getMemoryPtr() + (logLength - LogBufferDescriptor::LOG_META_DATA_LENGTH),
+            LogBufferDescriptor::LOG_META_DATA_LENGTH);
+        logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_TERM_LENGTH_OFFSET, termLength);
+        logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_PAGE_SIZE_OFFSET, pageSize);
+    }
+
+    {
+        std::unique_ptr<LogBuffers> logBuffers;
+
+        ASSERT_NO_THROW({
+            logBuffers.reset(new LogBuffers(name.c_str(), true));
+        });
+
+        for (int i = 0; i < LogBufferDescriptor::PARTITION_COUNT; i++)
+        {
+            AtomicBuffer &termBuffer = logBuffers->atomicBuffer(i);
+
+            EXPECT_EQ(termBuffer.capacity(), termLength);
+            termBuffer.putInt64(termLength - 8, i);
+            EXPECT_EQ(termBuffer.getInt64(termLength - 8), i);
+        }
+    }
+
+    ::unlink(name.c_str());
+}
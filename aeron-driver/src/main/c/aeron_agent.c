@@ -404,12 +404,53 @@ int aeron_agent_init(
 
     runner->idle_strategy_state = idle_strategy_state;
     runner->idle_strategy = idle_strategy_func;
+    runner->has_cpu_affinity = false;
+    runner->numa_node = AERON_NUMA_NODE_NONE;
     runner->running = true;
     runner->state = AERON_AGENT_STATE_INITED;
 
     return 0;
 }
 
+int aeron_agent_set_placement(aeron_agent_runner_t *runner, const char *cpu_affinity, int32_t numa_node)
+{
+    if (NULL == runner || numa_node >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "%s", "invalid argument");
+        return -1;
+    }
+
+    runner->has_cpu_affinity = false;
+    if (NULL != cpu_affinity)
+    {
+        if (aeron_cpu_set_parse(cpu_affinity, &runner->cpu_set) < 0)
+        {
+            return -1;
+        }
+
+        runner->has_cpu_affinity = true;
+    }
+
+    runner->numa_node = numa_node < 0 ? AERON_NUMA_NODE_NONE : numa_node;
+
+    return 0;
+}
+
+int aeron_agent_apply_placement(aeron_agent_runner_t *runner)
+{
+    if (runner->has_cpu_affinity && aeron_thread_set_cpu_affinity(&runner->cpu_set) < 0)
+    {
+        return -1;
+    }
+
+    if (AERON_NUMA_NODE_NONE != runner->numa_node && aeron_numa_set_preferred_node(runner->numa_node) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
 static void *agent_main(void *arg)
 {
     aeron_agent_runner_t *runner = (aeron_agent_runner_t *)arg;
@@ -450,7 +491,32 @@ int aeron_agent_start(aeron_agent_runner_t *runner)
         return -1;
     }
 
-    if ((pthread_result = aeron_thread_create(&runner->thread, &attr, agent_main, runner)) != 0)
+    if (runner->has_cpu_affinity && aeron_thread_attr_set_cpu_affinity(&attr, &runner->cpu_set) < 0)
+    {
+        return -1;
+    }
+
+    /*
+     * the memory policy is inherited by the new thread, so it is set here where a failure can be reported and the
+     * caller's own policy, which may come from numactl, is put back once the thread exists
+     */
+    aeron_numa_policy_t caller_policy;
+    if (AERON_NUMA_NODE_NONE != runner->numa_node)
+    {
+        if (aeron_numa_get_policy(&caller_policy) < 0 || aeron_numa_set_preferred_node(runner->numa_node) < 0)
+        {
+            return -1;
+        }
+    }
+
+    pthread_result = aeron_thread_create(&runner->thread, &attr, agent_main, runner);
+
+    if (AERON_NUMA_NODE_NONE != runner->numa_node)
+    {
+        aeron_numa_set_policy(&caller_policy);
+    }
+
+    if (pthread_result != 0)
     {
         aeron_set_err(pthread_result, "aeron_thread_create: %s", strerror(pthread_result));
         return -1;
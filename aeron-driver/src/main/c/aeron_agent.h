@@ -23,6 +23,7 @@
 #include "concurrent/aeron_thread.h"
 #include "aeron_driver_common.h"
 #include "concurrent/aeron_atomic.h"
+#include "util/aeron_affinity.h"
 #include "aeronmd.h"
 
 typedef int (*aeron_agent_do_work_func_t)(void *);
@@ -70,6 +71,9 @@ typedef struct aeron_agent_runner_stct
     aeron_agent_on_close_func_t on_close;
     aeron_idle_strategy_func_t idle_strategy;
     aeron_thread_t thread;
+    aeron_cpu_set_t cpu_set;
+    bool has_cpu_affinity;
+    int32_t numa_node;
     volatile bool running;
     uint8_t state;
 }
@@ -94,6 +98,17 @@ int aeron_agent_init(
     aeron_idle_strategy_func_t idle_strategy_func,
     void *idle_strategy_state);
 
+/*
+ * Pin the agent thread to the CPUs in the list and prefer the NUMA node for memory it first touches. A NULL list
+ * leaves the thread free to run on any CPU and AERON_NUMA_NODE_NONE leaves the memory policy alone.
+ */
+int aeron_agent_set_placement(aeron_agent_runner_t *runner, const char *cpu_affinity, int32_t numa_node);
+
+/*
+ * Apply the placement of the runner to the calling thread, for agents run by the caller rather than started.
+ */
+int aeron_agent_apply_placement(aeron_agent_runner_t *runner);
+
 int aeron_agent_start(aeron_agent_runner_t *runner);
 
 inline int aeron_agent_do_work(aeron_agent_runner_t *runner)
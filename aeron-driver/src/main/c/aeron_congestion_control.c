@@ -19,14 +19,19 @@
 #define _GNU_SOURCE
 #endif
 
+#include <stdlib.h>
 #include <errno.h>
+#include <math.h>
 #include "protocol/aeron_udp_protocol.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
+#include "concurrent/aeron_thread.h"
 #include "util/aeron_error.h"
 #include "util/aeron_dlopen.h"
+#include "util/aeron_parse_util.h"
 #include "aeron_congestion_control.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_context.h"
+#include "aeron_position.h"
 
 aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strategy_supplier_load(
     const char *strategy_name)
@@ -58,6 +63,10 @@ bool aeron_static_window_congestion_control_strategy_should_measure_rtt(void *st
     return false;
 }
 
+void aeron_static_window_congestion_control_strategy_on_rttm_sent(void *state, int64_t now_ns)
+{
+}
+
 void aeron_static_window_congestion_control_strategy_on_rttm(
     void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address)
 {
@@ -113,6 +122,7 @@ int aeron_static_window_congestion_control_strategy_supplier(
     }
 
     _strategy->should_measure_rtt = aeron_static_window_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm_sent = aeron_static_window_congestion_control_strategy_on_rttm_sent;
     _strategy->on_rttm = aeron_static_window_congestion_control_strategy_on_rttm;
     _strategy->on_track_rebuild = aeron_static_window_congestion_control_strategy_on_track_rebuild;
     _strategy->initial_window_length = aeron_static_window_congestion_control_strategy_initial_window_length;
@@ -128,3 +138,285 @@ int aeron_static_window_congestion_control_strategy_supplier(
 
     return 0;
 }
+
+#define AERON_CUBICCONGESTIONCONTROL_RTT_MEASUREMENT_TIMEOUT_NS (10 * 1000 * 1000LL)
+#define AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS (1000 * 1000 * 1000LL)
+#define AERON_CUBICCONGESTIONCONTROL_MAX_OUTSTANDING_RTT_MEASUREMENTS (1)
+#define AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS (1000 * 1000 * 1000LL)
+
+#define AERON_CUBICCONGESTIONCONTROL_C (0.4)
+#define AERON_CUBICCONGESTIONCONTROL_B (0.2)
+
+typedef struct aeron_cubic_congestion_control_strategy_state_stct
+{
+    int32_t mtu;
+    int32_t min_window;
+    int32_t max_cwnd;
+    int32_t cwnd;
+    int32_t w_max;
+    double k;
+
+    int64_t last_loss_timestamp_ns;
+    int64_t last_update_timestamp_ns;
+    int64_t last_rtt_timestamp_ns;
+    int64_t window_update_timeout_ns;
+    int64_t rtt_ns;
+    int32_t outstanding_rtt_measurements;
+
+    aeron_position_t rtt_indicator;
+    aeron_position_t window_indicator;
+    aeron_position_t loss_indicator;
+    aeron_counters_manager_t *counters_manager;
+}
+aeron_cubic_congestion_control_strategy_state_t;
+
+static AERON_INIT_ONCE cubic_configuration_is_initialized = AERON_INIT_ONCE_VALUE;
+
+static int64_t aeron_cubic_congestion_control_initial_rtt_ns;
+static bool aeron_cubic_congestion_control_measure_rtt;
+static bool aeron_cubic_congestion_control_tcp_mode;
+
+static void initialize_aeron_cubic_congestion_control_configuration()
+{
+    const char *initial_rtt_str = getenv(AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR);
+    uint64_t initial_rtt_ns = AERON_CUBICCONGESTIONCONTROL_INITIALRTT_DEFAULT;
+
+    if (NULL != initial_rtt_str)
+    {
+        aeron_parse_duration_ns(initial_rtt_str, &initial_rtt_ns);
+    }
+
+    aeron_cubic_congestion_control_initial_rtt_ns = (int64_t)initial_rtt_ns;
+    aeron_cubic_congestion_control_measure_rtt = aeron_config_parse_bool(
+        getenv(AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR), AERON_CUBICCONGESTIONCONTROL_MEASURERTT_DEFAULT);
+    aeron_cubic_congestion_control_tcp_mode = aeron_config_parse_bool(
+        getenv(AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR), AERON_CUBICCONGESTIONCONTROL_TCPMODE_DEFAULT);
+}
+
+bool aeron_cubic_congestion_control_strategy_should_measure_rtt(void *state, int64_t now_ns)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    /* a measurement whose reply was lost stops counting as outstanding once the max timeout has passed */
+    return aeron_cubic_congestion_control_measure_rtt &&
+        ((cubic_state->outstanding_rtt_measurements < AERON_CUBICCONGESTIONCONTROL_MAX_OUTSTANDING_RTT_MEASUREMENTS &&
+        now_ns > (cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MEASUREMENT_TIMEOUT_NS)) ||
+        now_ns > (cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS));
+}
+
+void aeron_cubic_congestion_control_strategy_on_rttm_sent(void *state, int64_t now_ns)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    const bool is_reply_overdue =
+        now_ns > (cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS);
+
+    cubic_state->last_rtt_timestamp_ns = now_ns;
+    cubic_state->outstanding_rtt_measurements = is_reply_overdue ? 1 : cubic_state->outstanding_rtt_measurements + 1;
+}
+
+void aeron_cubic_congestion_control_strategy_on_rttm(
+    void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    if (cubic_state->outstanding_rtt_measurements > 0)
+    {
+        cubic_state->outstanding_rtt_measurements--;
+    }
+
+    cubic_state->last_rtt_timestamp_ns = now_ns;
+    cubic_state->rtt_ns = rtt_ns;
+    aeron_counter_set_ordered(cubic_state->rtt_indicator.value_addr, rtt_ns);
+}
+
+int32_t aeron_cubic_congestion_control_strategy_on_track_rebuild(
+    void *state,
+    bool *should_force_sm,
+    int64_t now_ns,
+    int64_t new_consumption_position,
+    int64_t last_sm_position,
+    int64_t hwm_position,
+    int64_t starting_rebuild_position,
+    int64_t ending_rebuild_position,
+    bool loss_occurred)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    *should_force_sm = false;
+
+    if (loss_occurred)
+    {
+        cubic_state->w_max = cubic_state->cwnd;
+        cubic_state->k = cbrt((double)cubic_state->w_max * AERON_CUBICCONGESTIONCONTROL_B / AERON_CUBICCONGESTIONCONTROL_C);
+
+        const int32_t cwnd = (int32_t)(cubic_state->cwnd * (1.0 - AERON_CUBICCONGESTIONCONTROL_B));
+        cubic_state->cwnd = cwnd > 1 ? cwnd : 1;
+        cubic_state->last_loss_timestamp_ns = now_ns;
+        *should_force_sm = true;
+
+        aeron_counter_ordered_increment(cubic_state->loss_indicator.value_addr, 1);
+    }
+    else if (cubic_state->cwnd < cubic_state->max_cwnd &&
+        now_ns > (cubic_state->last_update_timestamp_ns + cubic_state->window_update_timeout_ns))
+    {
+        /* W_cubic = C(T - K)^3 + w_max */
+        const double duration_since_decrease =
+            (double)(now_ns - cubic_state->last_loss_timestamp_ns) / (double)AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS;
+        const double diff_to_k = duration_since_decrease - cubic_state->k;
+        const double increase = AERON_CUBICCONGESTIONCONTROL_C * diff_to_k * diff_to_k * diff_to_k;
+        const int32_t cwnd = cubic_state->w_max + (int32_t)increase;
+
+        cubic_state->cwnd = cwnd < cubic_state->max_cwnd ? cwnd : cubic_state->max_cwnd;
+        cubic_state->cwnd = cubic_state->cwnd > 1 ? cubic_state->cwnd : 1;
+
+        /* W_tcp(t) = w_max * (1 - B) + 3 * B / (2 - B) * t / RTT, used while below w_max in TCP mode */
+        if (aeron_cubic_congestion_control_tcp_mode && cubic_state->cwnd < cubic_state->w_max)
+        {
+            const double rtt_in_seconds =
+                (double)cubic_state->rtt_ns / (double)AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS;
+            const double w_tcp =
+                (double)cubic_state->w_max * (1.0 - AERON_CUBICCONGESTIONCONTROL_B) +
+                ((3.0 * AERON_CUBICCONGESTIONCONTROL_B / (2.0 - AERON_CUBICCONGESTIONCONTROL_B)) *
+                (duration_since_decrease / rtt_in_seconds));
+
+            cubic_state->cwnd = cubic_state->cwnd > (int32_t)w_tcp ? cubic_state->cwnd : (int32_t)w_tcp;
+        }
+
+        cubic_state->last_update_timestamp_ns = now_ns;
+    }
+
+    const int32_t window = cubic_state->cwnd * cubic_state->mtu;
+    aeron_counter_set_ordered(cubic_state->window_indicator.value_addr, window);
+
+    return window;
+}
+
+int32_t aeron_cubic_congestion_control_strategy_initial_window_length(void *state)
+{
+    return ((aeron_cubic_congestion_control_strategy_state_t *)state)->min_window;
+}
+
+int aeron_cubic_congestion_control_strategy_fini(aeron_congestion_control_strategy_t *strategy)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state =
+        (aeron_cubic_congestion_control_strategy_state_t *)strategy->state;
+
+    aeron_counters_manager_free(cubic_state->counters_manager, cubic_state->rtt_indicator.counter_id);
+    aeron_counters_manager_free(cubic_state->counters_manager, cubic_state->window_indicator.counter_id);
+    aeron_counters_manager_free(cubic_state->counters_manager, cubic_state->loss_indicator.counter_id);
+
+    aeron_free(strategy->state);
+    aeron_free(strategy);
+
+    return 0;
+}
+
+int aeron_cubic_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager)
+{
+    aeron_congestion_control_strategy_t *_strategy;
+
+    if (aeron_alloc((void **)&_strategy, sizeof(aeron_congestion_control_strategy_t)) < 0 ||
+        aeron_alloc((void **)&_strategy->state, sizeof(aeron_cubic_congestion_control_strategy_state_t)) < 0)
+    {
+        return -1;
+    }
+
+    _strategy->should_measure_rtt = aeron_cubic_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm_sent = aeron_cubic_congestion_control_strategy_on_rttm_sent;
+    _strategy->on_rttm = aeron_cubic_congestion_control_strategy_on_rttm;
+    _strategy->on_track_rebuild = aeron_cubic_congestion_control_strategy_on_track_rebuild;
+    _strategy->initial_window_length = aeron_cubic_congestion_control_strategy_initial_window_length;
+    _strategy->fini = aeron_cubic_congestion_control_strategy_fini;
+
+    (void)aeron_thread_once(&cubic_configuration_is_initialized, initialize_aeron_cubic_congestion_control_configuration);
+
+    aeron_cubic_congestion_control_strategy_state_t *state = _strategy->state;
+    const int32_t initial_window_length = (int32_t)context->initial_window_length;
+    const int32_t max_window_for_term = term_length / 2;
+    const int32_t max_window = max_window_for_term < initial_window_length ? max_window_for_term : initial_window_length;
+
+    state->mtu = sender_mtu_length;
+    state->min_window = sender_mtu_length;
+    state->max_cwnd = max_window / sender_mtu_length > 1 ? max_window / sender_mtu_length : 1;
+    state->cwnd = 1;
+    /* start with w_max at the max window so growth begins in the concave region */
+    state->w_max = state->max_cwnd;
+    state->k = cbrt((double)state->w_max * AERON_CUBICCONGESTIONCONTROL_B / AERON_CUBICCONGESTIONCONTROL_C);
+
+    state->rtt_ns = aeron_cubic_congestion_control_initial_rtt_ns;
+    state->window_update_timeout_ns = state->rtt_ns;
+    state->outstanding_rtt_measurements = 0;
+    state->last_rtt_timestamp_ns = 0;
+    state->counters_manager = counters_manager;
+
+    state->rtt_indicator.counter_id = aeron_counter_per_image_indicator_allocate(
+        counters_manager,
+        AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_NAME,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel);
+    state->window_indicator.counter_id = aeron_counter_per_image_indicator_allocate(
+        counters_manager,
+        AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_NAME,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel);
+    state->loss_indicator.counter_id = aeron_counter_per_image_indicator_allocate(
+        counters_manager,
+        AERON_CUBICCONGESTIONCONTROL_LOSS_INDICATOR_NAME,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel);
+
+    if (state->rtt_indicator.counter_id < 0 ||
+        state->window_indicator.counter_id < 0 ||
+        state->loss_indicator.counter_id < 0)
+    {
+        int32_t counter_ids[] =
+            { state->rtt_indicator.counter_id, state->window_indicator.counter_id, state->loss_indicator.counter_id };
+
+        for (size_t i = 0; i < sizeof(counter_ids) / sizeof(int32_t); i++)
+        {
+            if (counter_ids[i] >= 0)
+            {
+                aeron_counters_manager_free(counters_manager, counter_ids[i]);
+            }
+        }
+
+        aeron_free(_strategy->state);
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    state->rtt_indicator.value_addr = aeron_counter_addr(counters_manager, state->rtt_indicator.counter_id);
+    state->window_indicator.value_addr = aeron_counter_addr(counters_manager, state->window_indicator.counter_id);
+    state->loss_indicator.value_addr = aeron_counter_addr(counters_manager, state->loss_indicator.counter_id);
+
+    aeron_counter_set_ordered(state->rtt_indicator.value_addr, 0);
+    aeron_counter_set_ordered(state->window_indicator.value_addr, state->min_window);
+    aeron_counter_set_ordered(state->loss_indicator.value_addr, 0);
+
+    state->last_loss_timestamp_ns = context->nano_clock();
+    state->last_update_timestamp_ns = state->last_loss_timestamp_ns;
+
+    *strategy = _strategy;
+
+    return 0;
+}
@@ -27,6 +27,8 @@ typedef struct aeron_counters_manager_stct aeron_counters_manager_t;
 
 typedef bool (*aeron_congestion_control_strategy_should_measure_rtt_func_t)(void *state, int64_t now_ns);
 
+typedef void (*aeron_congestion_control_strategy_on_rttm_sent_func_t)(void *state, int64_t now_ns);
+
 typedef void (*aeron_congestion_control_strategy_on_rttm_func_t)(
     void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address);
 
@@ -48,6 +50,7 @@ typedef int (*aeron_congestion_control_strategy_fini_func_t)(aeron_congestion_co
 typedef struct aeron_congestion_control_strategy_stct
 {
     aeron_congestion_control_strategy_should_measure_rtt_func_t should_measure_rtt;
+    aeron_congestion_control_strategy_on_rttm_sent_func_t on_rttm_sent;
     aeron_congestion_control_strategy_on_rttm_func_t on_rttm;
     aeron_congestion_control_strategy_on_track_rebuild_func_t on_track_rebuild;
     aeron_congestion_control_strategy_initial_window_length_func_t initial_window_length;
@@ -56,7 +59,39 @@ typedef struct aeron_congestion_control_strategy_stct
 }
 aeron_congestion_control_strategy_t;
 
+#define AERON_CUBICCONGESTIONCONTROL_INITIALRTT_DEFAULT (100 * 1000LL)
+#define AERON_CUBICCONGESTIONCONTROL_MEASURERTT_DEFAULT (true)
+#define AERON_CUBICCONGESTIONCONTROL_TCPMODE_DEFAULT (false)
+
+#define AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_NAME "rcv-cc-cubic-rtt"
+#define AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_NAME "rcv-cc-cubic-wnd"
+#define AERON_CUBICCONGESTIONCONTROL_LOSS_INDICATOR_NAME "rcv-cc-cubic-loss"
+
 aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strategy_supplier_load(
     const char *strategy_name);
 
+int aeron_static_window_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
+int aeron_cubic_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
 #endif //AERON_CONGESTION_CONTROL_H
@@ -337,6 +337,14 @@ int aeron_driver_ensure_dir_is_recreated(aeron_driver_t *driver)
         return -1;
     }
 
+    snprintf(buffer, sizeof(buffer) - 1, "%s/%s", dirname, AERON_RAW_LOG_POOL_DIR);
+    if (mkdir(buffer, S_IRWXU) != 0)
+    {
+        int errcode = errno;
+        aeron_set_err(errcode, "mkdir %s: %s", buffer, strerror(errcode));
+        return -1;
+    }
+
     return 0;
 }
 
@@ -562,6 +570,18 @@ int aeron_driver_validate_page_size(aeron_driver_t *driver)
         return -1;
     }
 
+    const uint64_t huge_page_size = aeron_hugetlbfs_page_size(driver->context->aeron_dir);
+    if (huge_page_size > 0 && 0 != (driver->context->file_page_size % huge_page_size))
+    {
+        aeron_set_err(
+            EINVAL,
+            "Page size not a multiple of the hugetlbfs page size for %s: page size=%" PRIu64 ", huge page size=%" PRIu64,
+            driver->context->aeron_dir,
+            driver->context->file_page_size,
+            huge_page_size);
+        return -1;
+    }
+
     return 0;
 }
 
@@ -614,6 +634,18 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     /* publicationReservedSessionIdHigh */
     fprintf(fpout, "\n    loss_report_length=%" PRIu64, (uint64_t)context->loss_report_length);
     fprintf(fpout, "\n    send_to_sm_poll_ratio=%" PRIu64, (uint64_t)context->send_to_sm_poll_ratio);
+    fprintf(fpout, "\n    network_publication_max_messages_per_send=%" PRIu64,
+        (uint64_t)context->network_publication_max_messages_per_send);
+    fprintf(fpout, "\n    receiver_io_vector_capacity=%" PRIu64, (uint64_t)context->receiver_io_vector_capacity);
+    fprintf(fpout, "\n    sender_io_vector_capacity=%" PRIu64, (uint64_t)context->sender_io_vector_capacity);
+    fprintf(fpout, "\n    socket_udp_gso=%d", context->socket_udp_gso);
+    fprintf(fpout, "\n    socket_udp_gro=%d", context->socket_udp_gro);
+    fprintf(fpout, "\n    udp_transport_poller_io_uring=%d", context->udp_transport_poller_io_uring);
+    fprintf(fpout, "\n    udp_transport_poller_io_uring_buffer_count=%" PRIu64,
+        (uint64_t)context->udp_transport_poller_io_uring_buffer_count);
+    fprintf(fpout, "\n    raw_log_pool_capacity=%" PRIu64, (uint64_t)context->raw_log_pool_capacity);
+    fprintf(fpout, "\n    nak_max_ranges=%" PRIu64, (uint64_t)context->nak_max_ranges);
+    fprintf(fpout, "\n    max_resend=%" PRIu64, (uint64_t)context->max_resend);
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpedantic"
@@ -661,6 +693,21 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     fprintf(fpout, "\n    shared_idle_strategy_init_args=%p%s",
         (void *)context->shared_idle_strategy_init_args,
         context->shared_idle_strategy_init_args ? context->shared_idle_strategy_init_args : "");
+    fprintf(fpout, "\n    conductor_cpu_affinity=%s",
+        NULL == context->conductor_cpu_affinity ? "" : context->conductor_cpu_affinity);
+    fprintf(fpout, "\n    conductor_numa_node=%" PRId32, context->conductor_numa_node);
+    fprintf(fpout, "\n    sender_cpu_affinity=%s",
+        NULL == context->sender_cpu_affinity ? "" : context->sender_cpu_affinity);
+    fprintf(fpout, "\n    sender_numa_node=%" PRId32, context->sender_numa_node);
+    fprintf(fpout, "\n    receiver_cpu_affinity=%s",
+        NULL == context->receiver_cpu_affinity ? "" : context->receiver_cpu_affinity);
+    fprintf(fpout, "\n    receiver_numa_node=%" PRId32, context->receiver_numa_node);
+    fprintf(fpout, "\n    shared_network_cpu_affinity=%s",
+        NULL == context->shared_network_cpu_affinity ? "" : context->shared_network_cpu_affinity);
+    fprintf(fpout, "\n    shared_network_numa_node=%" PRId32, context->shared_network_numa_node);
+    fprintf(fpout, "\n    shared_cpu_affinity=%s",
+        NULL == context->shared_cpu_affinity ? "" : context->shared_cpu_affinity);
+    fprintf(fpout, "\n    shared_numa_node=%" PRId32, context->shared_numa_node);
     fprintf(fpout, "\n    unicast_flow_control_supplier_func=%p%s",
         (void *)context->unicast_flow_control_supplier_func,
         aeron_dlinfo((const void *)context->unicast_flow_control_supplier_func, buffer, sizeof(buffer)));
@@ -671,6 +718,9 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     fprintf(fpout, "\n    congestion_control_supplier_func=%p%s",
         (void *)context->congestion_control_supplier_func,
         aeron_dlinfo((const void *)context->congestion_control_supplier_func, buffer, sizeof(buffer)));
+    fprintf(fpout, "\n    udp_channel_transport_bindings=%p%s",
+        (void *)context->udp_channel_transport_bindings,
+        aeron_dlinfo((const void *)context->udp_channel_transport_bindings, buffer, sizeof(buffer)));
     fprintf(fpout, "\n    usable_fs_space_func=%p%s",
         (void *)context->usable_fs_space_func,
         aeron_dlinfo((const void *)context->usable_fs_space_func, buffer, sizeof(buffer)));
@@ -862,6 +912,14 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 goto error;
             }
+
+            if (aeron_agent_set_placement(
+                &_driver->runners[AERON_AGENT_RUNNER_SHARED],
+                _driver->context->shared_cpu_affinity,
+                _driver->context->shared_numa_node) < 0)
+            {
+                goto error;
+            }
             break;
 
         case AERON_THREADING_MODE_SHARED_NETWORK:
@@ -879,6 +937,14 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 goto error;
             }
 
+            if (aeron_agent_set_placement(
+                &_driver->runners[AERON_AGENT_RUNNER_CONDUCTOR],
+                _driver->context->conductor_cpu_affinity,
+                _driver->context->conductor_numa_node) < 0)
+            {
+                goto error;
+            }
+
             if (aeron_agent_init(
                 &_driver->runners[AERON_AGENT_RUNNER_SHARED_NETWORK],
                 "[sender, receiver]",
@@ -892,6 +958,14 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 goto error;
             }
+
+            if (aeron_agent_set_placement(
+                &_driver->runners[AERON_AGENT_RUNNER_SHARED_NETWORK],
+                _driver->context->shared_network_cpu_affinity,
+                _driver->context->shared_network_numa_node) < 0)
+            {
+                goto error;
+            }
             break;
 
         case AERON_THREADING_MODE_DEDICATED:
@@ -910,6 +984,14 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 goto error;
             }
 
+            if (aeron_agent_set_placement(
+                &_driver->runners[AERON_AGENT_RUNNER_CONDUCTOR],
+                _driver->context->conductor_cpu_affinity,
+                _driver->context->conductor_numa_node) < 0)
+            {
+                goto error;
+            }
+
             if (aeron_agent_init(
                 &_driver->runners[AERON_AGENT_RUNNER_SENDER],
                 "sender",
@@ -924,6 +1006,14 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 goto error;
             }
 
+            if (aeron_agent_set_placement(
+                &_driver->runners[AERON_AGENT_RUNNER_SENDER],
+                _driver->context->sender_cpu_affinity,
+                _driver->context->sender_numa_node) < 0)
+            {
+                goto error;
+            }
+
             if (aeron_agent_init(
                 &_driver->runners[AERON_AGENT_RUNNER_RECEIVER],
                 "receiver",
@@ -937,6 +1027,14 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 goto error;
             }
+
+            if (aeron_agent_set_placement(
+                &_driver->runners[AERON_AGENT_RUNNER_RECEIVER],
+                _driver->context->receiver_cpu_affinity,
+                _driver->context->receiver_numa_node) < 0)
+            {
+                goto error;
+            }
             break;
     }
 
@@ -971,6 +1069,11 @@ int aeron_driver_start(aeron_driver_t *driver, bool manual_main_loop)
     }
     else
     {
+        if (aeron_agent_apply_placement(&driver->runners[0]) < 0)
+        {
+            return -1;
+        }
+
         if (NULL != driver->runners[0].on_start)
         {
             driver->runners[0].on_start(driver->runners[0].on_start_state, driver->runners[0].role_name);
@@ -43,6 +43,8 @@ aeron_driver_t;
 bool aeron_is_driver_active_with_cnc(
     aeron_mapped_file_t *cnc_map, int64_t timeout_ms, int64_t now_ms, aeron_log_func_t log_func);
 
+int aeron_driver_validate_page_size(aeron_driver_t *driver);
+
 int32_t aeron_semantic_version_compose(uint8_t major, uint8_t minor, uint8_t patch);
 
 uint8_t aeron_semantic_version_major(int32_t version);
@@ -109,6 +109,24 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
         return -1;
     }
 
+    if (aeron_raw_log_pool_init(
+        &conductor->raw_log_pool,
+        context->aeron_dir,
+        context->raw_log_pool_capacity,
+        context->file_page_size,
+        context->map_raw_log_func,
+        context->map_raw_log_close_func) < 0)
+    {
+        return -1;
+    }
+    context->raw_log_pool = &conductor->raw_log_pool;
+
+    if (aeron_raw_log_pool_preallocate(&conductor->raw_log_pool, context->term_buffer_length) < 0 ||
+        aeron_raw_log_pool_preallocate(&conductor->raw_log_pool, context->ipc_term_buffer_length) < 0)
+    {
+        return -1;
+    }
+
     conductor->conductor_proxy.command_queue = &context->conductor_command_queue;
     conductor->conductor_proxy.fail_counter = aeron_counter_addr(
         &conductor->counters_manager, AERON_SYSTEM_COUNTER_CONDUCTOR_PROXY_FAILS);
@@ -157,6 +175,10 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     conductor->publication_images.has_reached_end_of_life = aeron_publication_image_entry_has_reached_end_of_life;
     conductor->publication_images.delete_func = aeron_publication_image_entry_delete;
 
+    conductor->rebuild_images.array = NULL;
+    conductor->rebuild_images.length = 0;
+    conductor->rebuild_images.capacity = 0;
+
     conductor->lingering_resources.array = NULL;
     conductor->lingering_resources.length = 0;
     conductor->lingering_resources.capacity = 0;
@@ -184,11 +206,17 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
 
     int64_t now_ns = context->nano_clock();
 
+    aeron_clock_update_cached_nano_time(&context->conductor_cached_clock, now_ns);
+
     conductor->nano_clock = context->nano_clock;
     conductor->epoch_clock = context->epoch_clock;
     conductor->time_of_last_timeout_check_ns = now_ns;
+    conductor->time_of_next_image_sweep_ns = now_ns;
     conductor->time_of_last_to_driver_position_change_ns = now_ns;
     conductor->next_session_id = aeron_randomised_int32();
+    conductor->response_batch.is_active = false;
+    conductor->response_batch.entry_count = 0;
+    conductor->response_batch.length = sizeof(aeron_batch_message_t);
     conductor->last_consumer_command_position = aeron_mpsc_rb_consumer_position(&conductor->to_driver_commands);
 
     conductor->context = context;
@@ -514,7 +542,14 @@ void aeron_driver_conductor_cleanup_network_publication(
 void aeron_send_channel_endpoint_entry_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_send_channel_endpoint_entry_t *entry, int64_t now_ns, int64_t now_ms)
 {
-    /* nothing done here. Could linger if needed. */
+    aeron_send_channel_endpoint_t *endpoint = entry->endpoint;
+
+    if (NULL != endpoint->destination_tracker &&
+        !endpoint->destination_tracker->is_manual_control_mode &&
+        AERON_SEND_CHANNEL_ENDPOINT_STATUS_ACTIVE == endpoint->conductor_fields.status)
+    {
+        aeron_driver_sender_proxy_on_check_destinations(conductor->context->sender_proxy, endpoint);
+    }
 }
 
 bool aeron_send_channel_endpoint_entry_has_reached_end_of_life(
@@ -572,6 +607,20 @@ bool aeron_publication_image_entry_has_reached_end_of_life(
 void aeron_publication_image_entry_delete(
     aeron_driver_conductor_t *conductor, aeron_publication_image_entry_t *entry)
 {
+    if (entry->image->conductor_fields.is_rebuild_pending)
+    {
+        for (size_t i = 0, last_index = conductor->rebuild_images.length - 1; i <= last_index; i++)
+        {
+            if (entry->image == conductor->rebuild_images.array[i].image)
+            {
+                aeron_array_fast_unordered_remove(
+                    (uint8_t *)conductor->rebuild_images.array, sizeof(aeron_publication_image_entry_t), i, last_index);
+                conductor->rebuild_images.length--;
+                break;
+            }
+        }
+    }
+
     for (size_t i = 0, size = conductor->network_subscriptions.length; i < size; i++)
     {
         aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
@@ -752,7 +801,8 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
                     client->publication_links.length++;
 
                     conductor->ipc_publications.array[conductor->ipc_publications.length++].publication = publication;
-                    publication->conductor_fields.managed_resource.time_of_last_status_change = conductor->nano_clock();
+                    publication->conductor_fields.managed_resource.time_of_last_status_change =
+                        aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock);
                 }
             }
         }
@@ -779,6 +829,7 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
     size_t uri_length,
     const char *uri,
     aeron_uri_publication_params_t *params,
+    aeron_flow_control_strategy_supplier_func_t flow_control_supplier_func,
     int64_t registration_id,
     int32_t stream_id,
     bool is_exclusive)
@@ -868,6 +919,7 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                 }
 
                 aeron_flow_control_strategy_supplier_func_t flow_control_strategy_supplier_func =
+                    NULL != flow_control_supplier_func ? flow_control_supplier_func :
                     udp_channel->explicit_control || udp_channel->multicast ?
                         conductor->context->multicast_flow_control_supplier_func :
                         conductor->context->unicast_flow_control_supplier_func;
@@ -915,7 +967,8 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                     client->publication_links.length++;
 
                     conductor->network_publications.array[conductor->network_publications.length++].publication = publication;
-                    publication->conductor_fields.managed_resource.time_of_last_status_change = conductor->nano_clock();
+                    publication->conductor_fields.managed_resource.time_of_last_status_change =
+                        aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock);
                 }
             }
         }
@@ -1098,10 +1151,101 @@ aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_chan
     return endpoint;
 }
 
+inline static bool aeron_driver_conductor_is_batchable_response(int32_t msg_type_id)
+{
+    switch (msg_type_id)
+    {
+        case AERON_RESPONSE_ON_ERROR:
+        case AERON_RESPONSE_ON_PUBLICATION_READY:
+        case AERON_RESPONSE_ON_OPERATION_SUCCESS:
+        case AERON_RESPONSE_ON_EXCLUSIVE_PUBLICATION_READY:
+        case AERON_RESPONSE_ON_SUBSCRIPTION_READY:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static bool aeron_driver_conductor_response_batch_append(
+    aeron_driver_conductor_t *conductor, int32_t msg_type_id, const void *msg, size_t length)
+{
+    size_t capacity = conductor->to_clients.max_message_length < AERON_DRIVER_CONDUCTOR_RESPONSE_BATCH_CAPACITY ?
+        conductor->to_clients.max_message_length : AERON_DRIVER_CONDUCTOR_RESPONSE_BATCH_CAPACITY;
+    size_t entry_offset = AERON_ALIGN(conductor->response_batch.length, AERON_BATCH_ENTRY_ALIGNMENT);
+
+    if ((entry_offset + sizeof(aeron_batch_entry_t) + length) > capacity)
+    {
+        return false;
+    }
+
+    aeron_batch_entry_t *entry = (aeron_batch_entry_t *)(conductor->response_batch.buffer + entry_offset);
+    entry->msg_type_id = msg_type_id;
+    entry->length = (int32_t)length;
+    memcpy(conductor->response_batch.buffer + entry_offset + sizeof(aeron_batch_entry_t), msg, length);
+
+    conductor->response_batch.length = entry_offset + sizeof(aeron_batch_entry_t) + length;
+    conductor->response_batch.entry_count++;
+
+    return true;
+}
+
+void aeron_driver_conductor_flush_response_batch(aeron_driver_conductor_t *conductor)
+{
+    if (1 == conductor->response_batch.entry_count)
+    {
+        aeron_batch_entry_t *entry =
+            (aeron_batch_entry_t *)(conductor->response_batch.buffer + sizeof(aeron_batch_message_t));
+
+        aeron_broadcast_transmitter_transmit(
+            &conductor->to_clients,
+            entry->msg_type_id,
+            (uint8_t *)entry + sizeof(aeron_batch_entry_t),
+            (size_t)entry->length);
+    }
+    else if (conductor->response_batch.entry_count > 1)
+    {
+        aeron_batch_message_t *response = (aeron_batch_message_t *)conductor->response_batch.buffer;
+
+        response->correlated.client_id = conductor->response_batch.client_id;
+        response->correlated.correlation_id = conductor->response_batch.correlation_id;
+        response->entry_count = conductor->response_batch.entry_count;
+        response->reserved = 0;
+
+        aeron_broadcast_transmitter_transmit(
+            &conductor->to_clients,
+            AERON_RESPONSE_ON_BATCH,
+            conductor->response_batch.buffer,
+            conductor->response_batch.length);
+    }
+
+    conductor->response_batch.entry_count = 0;
+    conductor->response_batch.length = sizeof(aeron_batch_message_t);
+}
+
 void aeron_driver_conductor_client_transmit(
     aeron_driver_conductor_t *conductor, int32_t msg_type_id, const void *msg, size_t length)
 {
     conductor->context->to_client_interceptor_func(conductor, msg_type_id, msg, length);
+
+    if (conductor->response_batch.is_active)
+    {
+        const bool is_batchable = aeron_driver_conductor_is_batchable_response(msg_type_id);
+
+        if (is_batchable && aeron_driver_conductor_response_batch_append(conductor, msg_type_id, msg, length))
+        {
+            return;
+        }
+
+        /* keep responses in order, anything that is not batched goes after what has been batched so far */
+        aeron_driver_conductor_flush_response_batch(conductor);
+
+        if (is_batchable && aeron_driver_conductor_response_batch_append(conductor, msg_type_id, msg, length))
+        {
+            return;
+        }
+    }
+
     aeron_broadcast_transmitter_transmit(&conductor->to_clients, msg_type_id, msg, length);
 }
 
@@ -1465,6 +1609,21 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             break;
         }
 
+        case AERON_COMMAND_BATCH:
+        {
+            aeron_batch_message_t *command = (aeron_batch_message_t *)message;
+
+            if (length < sizeof(aeron_batch_message_t))
+            {
+                goto malformed_command;
+            }
+
+            correlation_id = command->correlated.correlation_id;
+
+            result = aeron_driver_conductor_on_command_batch(conductor, command, length);
+            break;
+        }
+
         default:
             AERON_FORMAT_BUFFER(error_message, "command=%d unknown", msg_type_id);
             aeron_driver_conductor_error(
@@ -1496,6 +1655,66 @@ void aeron_driver_conductor_on_command_queue(void *clientd, volatile void *item)
     cmd->func(clientd, cmd);
 }
 
+void aeron_driver_conductor_mark_image_for_rebuild(
+    aeron_driver_conductor_t *conductor, aeron_publication_image_t *image)
+{
+    if (!image->conductor_fields.is_rebuild_pending)
+    {
+        int ensure_capacity_result = 0;
+
+        /* on failure the image is picked up again by the next sweep */
+        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->rebuild_images, aeron_publication_image_entry_t);
+        if (ensure_capacity_result >= 0)
+        {
+            conductor->rebuild_images.array[conductor->rebuild_images.length++].image = image;
+            image->conductor_fields.is_rebuild_pending = true;
+        }
+    }
+}
+
+void aeron_driver_conductor_on_image_rebuild_signal(void *clientd, volatile void *item)
+{
+    aeron_driver_conductor_mark_image_for_rebuild(
+        (aeron_driver_conductor_t *)clientd, (aeron_publication_image_t *)item);
+}
+
+/*
+ * Images are only tracked while they have something to track: the receiver signals when new data arrives and an
+ * image stays in the set until its subscribers have consumed all of it. Idle images still need periodic status
+ * messages and congestion control updates so every image is swept in at a fraction of the status message timeout.
+ */
+void aeron_driver_conductor_track_image_rebuilds(aeron_driver_conductor_t *conductor, int64_t now_ns)
+{
+    const int64_t status_message_timeout_ns = (int64_t)conductor->context->status_message_timeout_ns;
+
+    if (now_ns >= conductor->time_of_next_image_sweep_ns)
+    {
+        for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
+        {
+            aeron_driver_conductor_mark_image_for_rebuild(conductor, conductor->publication_images.array[i].image);
+        }
+
+        conductor->time_of_next_image_sweep_ns = now_ns + (status_message_timeout_ns / 4);
+    }
+
+    for (int last_index = (int)conductor->rebuild_images.length - 1, i = last_index; i >= 0; i--)
+    {
+        aeron_publication_image_t *image = conductor->rebuild_images.array[i].image;
+
+        if (!aeron_publication_image_track_rebuild(image, now_ns, status_message_timeout_ns))
+        {
+            image->conductor_fields.is_rebuild_pending = false;
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)conductor->rebuild_images.array,
+                sizeof(aeron_publication_image_entry_t),
+                (size_t)i,
+                (size_t)last_index);
+            last_index--;
+            conductor->rebuild_images.length--;
+        }
+    }
+}
+
 void aeron_driver_conductor_on_check_for_blocked_driver_commands(aeron_driver_conductor_t *conductor, int64_t now_ns)
 {
     int64_t consumer_position = aeron_mpsc_rb_consumer_position(&conductor->to_driver_commands);
@@ -1525,10 +1744,14 @@ int aeron_driver_conductor_do_work(void *clientd)
     int work_count = 0;
     int64_t now_ns = conductor->nano_clock();
 
+    aeron_clock_update_cached_nano_time(&conductor->context->conductor_cached_clock, now_ns);
+
     work_count += (int)aeron_mpsc_rb_read(
         &conductor->to_driver_commands, aeron_driver_conductor_on_command, conductor, 10);
     work_count += aeron_mpsc_concurrent_array_queue_drain(
         conductor->conductor_proxy.command_queue, aeron_driver_conductor_on_command_queue, conductor, 10);
+    aeron_spsc_concurrent_array_queue_drain_all(
+        &conductor->context->image_rebuild_queue, aeron_driver_conductor_on_image_rebuild_signal, conductor);
 
     if (now_ns > (conductor->time_of_last_timeout_check_ns + (int64_t)conductor->context->timer_interval_ns))
     {
@@ -1551,11 +1774,9 @@ int aeron_driver_conductor_do_work(void *clientd)
         work_count += aeron_network_publication_update_pub_lmt(conductor->network_publications.array[i].publication);
     }
 
-    for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
-    {
-        aeron_publication_image_track_rebuild(
-            conductor->publication_images.array[i].image, now_ns, conductor->context->status_message_timeout_ns);
-    }
+    aeron_driver_conductor_track_image_rebuilds(conductor, now_ns);
+
+    work_count += aeron_raw_log_pool_do_work(&conductor->raw_log_pool);
 
     return work_count;
 }
@@ -1622,7 +1843,9 @@ void aeron_driver_conductor_on_close(void *clientd)
         aeron_publication_image_close(&conductor->counters_manager, conductor->publication_images.array[i].image);
     }
     aeron_free(conductor->publication_images.array);
+    aeron_free(conductor->rebuild_images.array);
 
+    aeron_raw_log_pool_close(&conductor->raw_log_pool);
     aeron_system_counters_close(&conductor->system_counters);
     aeron_counters_manager_close(&conductor->counters_manager);
     aeron_distinct_error_log_close(&conductor->error_log);
@@ -1809,7 +2032,7 @@ int aeron_driver_conductor_on_add_ipc_publication(
         publication->log_file_name,
         publication->log_file_name_length);
 
-    int64_t now_ns = conductor->context->nano_clock();
+    int64_t now_ns = aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock);
 
     for (size_t i = 0; i < conductor->ipc_subscriptions.length; i++)
     {
@@ -1856,6 +2079,7 @@ int aeron_driver_conductor_on_add_network_publication(
     const char *uri = (const char *)command + sizeof(aeron_publication_command_t);
     size_t uri_length = command->channel_length;
     aeron_uri_publication_params_t params;
+    aeron_flow_control_strategy_supplier_func_t flow_control_supplier_func = NULL;
 
     if (aeron_udp_channel_parse(uri_length, uri, &udp_channel) < 0 ||
         aeron_uri_publication_params(&udp_channel->uri, &params, conductor, is_exclusive) < 0)
@@ -1863,6 +2087,15 @@ int aeron_driver_conductor_on_add_network_publication(
         return -1;
     }
 
+    const char *fc_value = aeron_uri_find_param_value(
+        &udp_channel->uri.params.udp.additional_params, AERON_URI_FC_KEY);
+    if (NULL != fc_value &&
+        (flow_control_supplier_func = aeron_flow_control_strategy_supplier_from_uri_value(fc_value)) == NULL)
+    {
+        aeron_udp_channel_delete(udp_channel);
+        return -1;
+    }
+
     if ((client = aeron_driver_conductor_get_or_add_client(conductor, command->correlated.client_id)) == NULL)
     {
         return -1;
@@ -1886,6 +2119,7 @@ int aeron_driver_conductor_on_add_network_publication(
         uri_length,
         uri,
         &params,
+        flow_control_supplier_func,
         correlation_id,
         command->stream_id,
         is_exclusive);
@@ -1909,7 +2143,7 @@ int aeron_driver_conductor_on_add_network_publication(
         publication->log_file_name,
         publication->log_file_name_length);
 
-    int64_t now_ns = conductor->context->nano_clock();
+    int64_t now_ns = aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock);
 
     for (size_t i = 0; i < conductor->spy_subscriptions.length; i++)
     {
@@ -2027,7 +2261,7 @@ int aeron_driver_conductor_on_add_ipc_subscription(
     aeron_driver_conductor_on_subscription_ready(
         conductor, command->correlated.correlation_id, AERON_CHANNEL_STATUS_INDICATOR_NOT_ALLOCATED);
 
-    int64_t now_ns = conductor->context->nano_clock();
+    int64_t now_ns = aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock);
 
     for (size_t i = 0; i < conductor->ipc_publications.length; i++)
     {
@@ -2110,7 +2344,7 @@ int aeron_driver_conductor_on_add_spy_subscription(
     aeron_driver_conductor_on_subscription_ready(
         conductor, command->correlated.correlation_id, AERON_CHANNEL_STATUS_INDICATOR_NOT_ALLOCATED);
 
-    int64_t now_ns = conductor->context->nano_clock();
+    int64_t now_ns = aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock);
 
     for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
     {
@@ -2209,7 +2443,7 @@ int aeron_driver_conductor_on_add_network_subscription(
         aeron_driver_conductor_on_subscription_ready(
             conductor, command->correlated.correlation_id, endpoint->channel_status.counter_id);
 
-        int64_t now_ns = conductor->context->nano_clock();
+        int64_t now_ns = aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock);
 
         for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
         {
@@ -2238,6 +2472,8 @@ int aeron_driver_conductor_on_add_network_subscription(
                 {
                     return -1;
                 }
+
+                aeron_driver_conductor_mark_image_for_rebuild(conductor, image);
             }
         }
 
@@ -2609,6 +2845,54 @@ int aeron_driver_conductor_on_terminate_driver(
     return 0;
 }
 
+int aeron_driver_conductor_on_command_batch(
+    aeron_driver_conductor_t *conductor, aeron_batch_message_t *command, size_t length)
+{
+    const uint8_t *message = (const uint8_t *)command;
+    size_t offset = sizeof(aeron_batch_message_t);
+    int result = 0;
+
+    if (conductor->response_batch.is_active)
+    {
+        aeron_set_err(EINVAL, "%s", "command batch nested in command batch");
+        return -1;
+    }
+
+    conductor->response_batch.is_active = true;
+    conductor->response_batch.client_id = command->correlated.client_id;
+    conductor->response_batch.correlation_id = command->correlated.correlation_id;
+
+    for (int32_t i = 0; i < command->entry_count; i++)
+    {
+        offset = AERON_ALIGN(offset, AERON_BATCH_ENTRY_ALIGNMENT);
+
+        if ((offset + sizeof(aeron_batch_entry_t)) > length)
+        {
+            aeron_set_err(EINVAL, "command batch entry %d header beyond length=%lu", i, length);
+            result = -1;
+            break;
+        }
+
+        aeron_batch_entry_t *entry = (aeron_batch_entry_t *)(message + offset);
+        offset += sizeof(aeron_batch_entry_t);
+
+        if (entry->length < 0 || (offset + (size_t)entry->length) > length)
+        {
+            aeron_set_err(EINVAL, "command batch entry %d body beyond length=%lu", i, length);
+            result = -1;
+            break;
+        }
+
+        aeron_driver_conductor_on_command(entry->msg_type_id, message + offset, (size_t)entry->length, conductor);
+        offset += (size_t)entry->length;
+    }
+
+    aeron_driver_conductor_flush_response_batch(conductor);
+    conductor->response_batch.is_active = false;
+
+    return result;
+}
+
 void aeron_driver_conductor_on_create_publication_image(void *clientd, void *item)
 {
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
@@ -2704,7 +2988,7 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
     }
 
     conductor->publication_images.array[conductor->publication_images.length++].image = image;
-    int64_t now_ns = conductor->context->nano_clock();
+    int64_t now_ns = aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock);
 
     for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
     {
@@ -2737,6 +3021,7 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         }
     }
 
+    aeron_driver_conductor_mark_image_for_rebuild(conductor, image);
     aeron_driver_receiver_proxy_on_add_publication_image(conductor->context->receiver_proxy, endpoint, image);
     aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(conductor->context->receiver_proxy, item);
 }
@@ -2755,7 +3040,8 @@ void aeron_driver_conductor_on_linger_buffer(void *clientd, void *item)
 
         entry->buffer = command->item;
         entry->has_reached_end_of_life = false;
-        entry->timeout_ns = conductor->nano_clock() + AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS;
+        entry->timeout_ns = aeron_clock_cached_nano_time(&conductor->context->conductor_cached_clock) +
+            AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS;
     }
 
     if (conductor->context->threading_mode != AERON_THREADING_MODE_SHARED)
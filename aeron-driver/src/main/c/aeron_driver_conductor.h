@@ -34,6 +34,7 @@
 #include "reports/aeron_loss_reporter.h"
 
 #define AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS (5 * 1000 * 1000 * 1000L)
+#define AERON_DRIVER_CONDUCTOR_RESPONSE_BATCH_CAPACITY (4096)
 
 typedef struct aeron_publication_link_stct
 {
@@ -158,6 +159,7 @@ typedef struct aeron_driver_conductor_stct
     aeron_system_counters_t system_counters;
     aeron_driver_conductor_proxy_t conductor_proxy;
     aeron_loss_reporter_t loss_reporter;
+    aeron_raw_log_pool_t raw_log_pool;
 
     aeron_str_to_ptr_hash_map_t send_channel_endpoint_by_channel_map;
     aeron_str_to_ptr_hash_map_t receive_channel_endpoint_by_channel_map;
@@ -252,6 +254,14 @@ typedef struct aeron_driver_conductor_stct
     }
     publication_images;
 
+    struct aeron_driver_conductor_rebuild_images_stct
+    {
+        size_t length;
+        size_t capacity;
+        aeron_publication_image_entry_t *array;
+    }
+    rebuild_images;
+
     struct aeron_driver_conductor_lingering_resources_stct
     {
         size_t length;
@@ -263,6 +273,17 @@ typedef struct aeron_driver_conductor_stct
     }
     lingering_resources;
 
+    struct aeron_driver_conductor_response_batch_stct
+    {
+        bool is_active;
+        int64_t client_id;
+        int64_t correlation_id;
+        int32_t entry_count;
+        size_t length;
+        uint8_t buffer[AERON_DRIVER_CONDUCTOR_RESPONSE_BATCH_CAPACITY];
+    }
+    response_batch;
+
     int64_t *errors_counter;
     int64_t *unblocked_commands_counter;
     int64_t *client_timeouts_counter;
@@ -272,6 +293,7 @@ typedef struct aeron_driver_conductor_stct
 
     int32_t next_session_id;
     int64_t time_of_last_timeout_check_ns;
+    int64_t time_of_next_image_sweep_ns;
     int64_t time_of_last_to_driver_position_change_ns;
     int64_t last_consumer_command_position;
 }
@@ -377,6 +399,13 @@ void aeron_driver_conductor_cleanup_network_publication(
 
 void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message, size_t length, void *clientd);
 
+void aeron_driver_conductor_mark_image_for_rebuild(
+    aeron_driver_conductor_t *conductor, aeron_publication_image_t *image);
+
+void aeron_driver_conductor_on_image_rebuild_signal(void *clientd, volatile void *item);
+
+void aeron_driver_conductor_track_image_rebuilds(aeron_driver_conductor_t *conductor, int64_t now_ns);
+
 int aeron_driver_conductor_do_work(void *clientd);
 
 void aeron_driver_conductor_on_close(void *clientd);
@@ -436,6 +465,11 @@ int aeron_driver_conductor_on_client_close(aeron_driver_conductor_t *conductor,
 int aeron_driver_conductor_on_terminate_driver(
     aeron_driver_conductor_t *conductor, aeron_terminate_driver_command_t *command);
 
+int aeron_driver_conductor_on_command_batch(
+    aeron_driver_conductor_t *conductor, aeron_batch_message_t *command, size_t length);
+
+void aeron_driver_conductor_flush_response_batch(aeron_driver_conductor_t *conductor);
+
 void aeron_driver_conductor_on_create_publication_image(void *clientd, void *item);
 
 void aeron_driver_conductor_on_linger_buffer(void *clientd, void *item);
@@ -56,6 +56,10 @@
 #include "aeron_agent.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_termination_validator.h"
+#include "aeron_retransmit_handler.h"
+#include "util/aeron_affinity.h"
+#include "media/aeron_udp_transport_io_uring.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
 
 #if defined(__clang__)
     #pragma clang diagnostic push
@@ -168,6 +172,31 @@ uint64_t aeron_config_parse_uint64(const char *name, const char *str, uint64_t d
     return result;
 }
 
+int64_t aeron_config_parse_int64(const char *name, const char *str, int64_t def, int64_t min, int64_t max)
+{
+    int64_t result = def;
+
+    if (NULL != str)
+    {
+        errno = 0;
+        char *end_ptr = NULL;
+        int64_t value = strtoll(str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == str || '\0' != *end_ptr)
+        {
+            aeron_config_prop_warning(name, str);
+        }
+        else
+        {
+            result = value;
+            result = result > max ? max : result;
+            result = result < min ? min : result;
+        }
+    }
+
+    return result;
+}
+
 uint64_t aeron_config_parse_size64(const char *name, const char *str, uint64_t def, uint64_t min, uint64_t max)
 {
     uint64_t result = def;
@@ -214,6 +243,13 @@ uint64_t aeron_config_parse_duration_ns(const char *name, const char *str, uint6
     return result;
 }
 
+int32_t aeron_config_parse_numa_node(const char *name, const char *str, int32_t def)
+{
+    const int64_t value = aeron_config_parse_int64(name, str, def, INT64_MIN, AERON_NUMA_MAX_NODES - 1);
+
+    return value < 0 ? AERON_NUMA_NODE_NONE : (int32_t)value;
+}
+
 aeron_threading_mode_t aeron_config_parse_threading_mode(const char *threading_mode, aeron_threading_mode_t def)
 {
     aeron_threading_mode_t result = def;
@@ -280,6 +316,7 @@ static void aeron_driver_conductor_to_client_interceptor_null(
 #define AERON_RCV_STATUS_MESSAGE_TIMEOUT_NS_DEFAULT (200 * 1000 * 1000LL)
 #define AERON_MULTICAST_FLOWCONTROL_SUPPLIER_DEFAULT ("aeron_max_multicast_flow_control_strategy_supplier")
 #define AERON_UNICAST_FLOWCONTROL_SUPPLIER_DEFAULT ("aeron_unicast_flow_control_strategy_supplier")
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA_DEFAULT (AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DEFAULT_NAME)
 #define AERON_CONGESTIONCONTROL_SUPPLIER_DEFAULT ("aeron_static_window_congestion_control_strategy_supplier")
 #define AERON_IMAGE_LIVENESS_TIMEOUT_NS_DEFAULT (10 * 1000 * 1000 * 1000LL)
 #define AERON_RCV_INITIAL_WINDOW_LENGTH_DEFAULT (128 * 1024)
@@ -300,6 +337,16 @@ static void aeron_driver_conductor_to_client_interceptor_null(
 #define AERON_NAK_MULTICAST_GROUP_SIZE_DEFAULT (10)
 #define AERON_NAK_MULTICAST_MAX_BACKOFF_NS_DEFAULT (60 * 1000 * 1000LL)
 #define AERON_NAK_UNICAST_DELAY_NS_DEFAULT (60 * 1000 * 1000LL)
+#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_DEFAULT (2)
+#define AERON_RECEIVER_IO_VECTOR_CAPACITY_DEFAULT (2)
+#define AERON_SENDER_IO_VECTOR_CAPACITY_DEFAULT (2)
+#define AERON_SOCKET_UDP_GSO_DEFAULT (false)
+#define AERON_SOCKET_UDP_GRO_DEFAULT (false)
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_DEFAULT (false)
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT_DEFAULT (256)
+#define AERON_RAW_LOG_POOL_CAPACITY_DEFAULT (0)
+#define AERON_NAK_MAX_RANGES_DEFAULT (1)
+#define AERON_MAX_RESEND_DEFAULT (AERON_RETRANSMIT_HANDLER_MAX_RESEND_DEFAULT)
 
 int aeron_driver_context_init(aeron_driver_context_t **context)
 {
@@ -344,6 +391,11 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         return -1;
     }
 
+    if (aeron_spsc_concurrent_array_queue_init(&_context->image_rebuild_queue, AERON_IMAGE_REBUILD_QUEUE_CAPACITY) < 0)
+    {
+        return -1;
+    }
+
     _context->agent_on_start_func = NULL;
     _context->agent_on_start_state = NULL;
 
@@ -365,6 +417,12 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         return -1;
     }
 
+    if ((_context->udp_channel_transport_bindings = aeron_udp_channel_transport_bindings_load(
+        AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA_DEFAULT)) == NULL)
+    {
+        return -1;
+    }
+
 #if defined(__linux__)
     snprintf(_context->aeron_dir, AERON_MAX_PATH - 1, "/dev/shm/aeron-%s", username());
 #elif defined(_MSC_VER)
@@ -416,6 +474,16 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->nak_multicast_group_size = AERON_NAK_MULTICAST_GROUP_SIZE_DEFAULT;
     _context->nak_multicast_max_backoff_ns = AERON_NAK_MULTICAST_MAX_BACKOFF_NS_DEFAULT;
     _context->nak_unicast_delay_ns = AERON_NAK_UNICAST_DELAY_NS_DEFAULT;
+    _context->network_publication_max_messages_per_send = AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_DEFAULT;
+    _context->receiver_io_vector_capacity = AERON_RECEIVER_IO_VECTOR_CAPACITY_DEFAULT;
+    _context->sender_io_vector_capacity = AERON_SENDER_IO_VECTOR_CAPACITY_DEFAULT;
+    _context->socket_udp_gso = AERON_SOCKET_UDP_GSO_DEFAULT;
+    _context->socket_udp_gro = AERON_SOCKET_UDP_GRO_DEFAULT;
+    _context->udp_transport_poller_io_uring = AERON_UDP_TRANSPORT_POLLER_IO_URING_DEFAULT;
+    _context->udp_transport_poller_io_uring_buffer_count = AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT_DEFAULT;
+    _context->raw_log_pool_capacity = AERON_RAW_LOG_POOL_CAPACITY_DEFAULT;
+    _context->nak_max_ranges = AERON_NAK_MAX_RANGES_DEFAULT;
+    _context->max_resend = AERON_MAX_RESEND_DEFAULT;
 
     char *value = NULL;
 
@@ -456,6 +524,14 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         }
     }
 
+    if ((value = getenv(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA_ENV_VAR)))
+    {
+        if ((_context->udp_channel_transport_bindings = aeron_udp_channel_transport_bindings_load(value)) == NULL)
+        {
+            return -1;
+        }
+    }
+
     _context->dirs_delete_on_start = aeron_config_parse_bool(
         getenv(AERON_DIR_DELETE_ON_START_ENV_VAR),
         _context->dirs_delete_on_start);
@@ -719,6 +795,89 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1000,
         INT64_MAX);
 
+    _context->network_publication_max_messages_per_send = (size_t)aeron_config_parse_uint64(
+        AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_ENV_VAR,
+        getenv(AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_ENV_VAR),
+        _context->network_publication_max_messages_per_send,
+        1,
+        AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND);
+
+    _context->receiver_io_vector_capacity = (size_t)aeron_config_parse_uint64(
+        AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR,
+        getenv(AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR),
+        _context->receiver_io_vector_capacity,
+        1,
+        AERON_DRIVER_IO_VECTOR_CAPACITY_MAX);
+
+    _context->sender_io_vector_capacity = (size_t)aeron_config_parse_uint64(
+        AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR,
+        getenv(AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR),
+        _context->sender_io_vector_capacity,
+        1,
+        AERON_DRIVER_IO_VECTOR_CAPACITY_MAX);
+
+    _context->socket_udp_gso = aeron_config_parse_bool(
+        getenv(AERON_SOCKET_UDP_GSO_ENV_VAR),
+        _context->socket_udp_gso);
+
+    _context->socket_udp_gro = aeron_config_parse_bool(
+        getenv(AERON_SOCKET_UDP_GRO_ENV_VAR),
+        _context->socket_udp_gro);
+
+    _context->udp_transport_poller_io_uring = aeron_config_parse_bool(
+        getenv(AERON_UDP_TRANSPORT_POLLER_IO_URING_ENV_VAR),
+        _context->udp_transport_poller_io_uring);
+
+    _context->udp_transport_poller_io_uring_buffer_count = (size_t)aeron_find_next_power_of_two(
+        (int32_t)aeron_config_parse_uint64(
+            AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT_ENV_VAR,
+            getenv(AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT_ENV_VAR),
+            _context->udp_transport_poller_io_uring_buffer_count,
+            1,
+            AERON_UDP_TRANSPORT_IO_URING_BUFFER_COUNT_MAX));
+
+    _context->raw_log_pool_capacity = (size_t)aeron_config_parse_uint64(
+        AERON_RAW_LOG_POOL_CAPACITY_ENV_VAR,
+        getenv(AERON_RAW_LOG_POOL_CAPACITY_ENV_VAR),
+        _context->raw_log_pool_capacity,
+        0,
+        INT32_MAX);
+
+    _context->nak_max_ranges = (size_t)aeron_config_parse_uint64(
+        AERON_NAK_MAX_RANGES_ENV_VAR,
+        getenv(AERON_NAK_MAX_RANGES_ENV_VAR),
+        _context->nak_max_ranges,
+        1,
+        AERON_NAK_LIST_MAX_RANGES);
+
+    _context->max_resend = (size_t)aeron_config_parse_uint64(
+        AERON_MAX_RESEND_ENV_VAR,
+        getenv(AERON_MAX_RESEND_ENV_VAR),
+        _context->max_resend,
+        1,
+        AERON_RETRANSMIT_HANDLER_MAX_RESEND_MAX);
+
+    _context->conductor_cpu_affinity =
+        AERON_CONFIG_STRNDUP_GETENV_OR_NULL(AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR);
+    _context->conductor_numa_node = aeron_config_parse_numa_node(
+        AERON_CONDUCTOR_NUMA_NODE_ENV_VAR, getenv(AERON_CONDUCTOR_NUMA_NODE_ENV_VAR), AERON_NUMA_NODE_NONE);
+    _context->sender_cpu_affinity =
+        AERON_CONFIG_STRNDUP_GETENV_OR_NULL(AERON_SENDER_CPU_AFFINITY_ENV_VAR);
+    _context->sender_numa_node = aeron_config_parse_numa_node(
+        AERON_SENDER_NUMA_NODE_ENV_VAR, getenv(AERON_SENDER_NUMA_NODE_ENV_VAR), AERON_NUMA_NODE_NONE);
+    _context->receiver_cpu_affinity =
+        AERON_CONFIG_STRNDUP_GETENV_OR_NULL(AERON_RECEIVER_CPU_AFFINITY_ENV_VAR);
+    _context->receiver_numa_node = aeron_config_parse_numa_node(
+        AERON_RECEIVER_NUMA_NODE_ENV_VAR, getenv(AERON_RECEIVER_NUMA_NODE_ENV_VAR), AERON_NUMA_NODE_NONE);
+    _context->shared_network_cpu_affinity =
+        AERON_CONFIG_STRNDUP_GETENV_OR_NULL(AERON_SHAREDNETWORK_CPU_AFFINITY_ENV_VAR);
+    _context->shared_network_numa_node = aeron_config_parse_numa_node(
+        AERON_SHAREDNETWORK_NUMA_NODE_ENV_VAR, getenv(AERON_SHAREDNETWORK_NUMA_NODE_ENV_VAR), AERON_NUMA_NODE_NONE);
+    _context->shared_cpu_affinity =
+        AERON_CONFIG_STRNDUP_GETENV_OR_NULL(AERON_SHARED_CPU_AFFINITY_ENV_VAR);
+    _context->shared_numa_node = aeron_config_parse_numa_node(
+        AERON_SHARED_NUMA_NODE_ENV_VAR, getenv(AERON_SHARED_NUMA_NODE_ENV_VAR), AERON_NUMA_NODE_NONE);
+
     _context->to_driver_buffer = NULL;
     _context->to_clients_buffer = NULL;
     _context->counters_values_buffer = NULL;
@@ -793,6 +952,7 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         aeron_usable_fs_space : aeron_usable_fs_space_disabled;
     _context->map_raw_log_func = aeron_map_raw_log;
     _context->map_raw_log_close_func = aeron_map_raw_log_close;
+    _context->raw_log_pool = NULL;
 
     _context->to_driver_interceptor_func = aeron_driver_conductor_to_driver_interceptor_null;
     _context->to_client_interceptor_func = aeron_driver_conductor_to_client_interceptor_null;
@@ -841,6 +1001,7 @@ int aeron_driver_context_close(aeron_driver_context_t *context)
     aeron_mpsc_concurrent_array_queue_close(&context->conductor_command_queue);
     aeron_spsc_concurrent_array_queue_close(&context->sender_command_queue);
     aeron_spsc_concurrent_array_queue_close(&context->receiver_command_queue);
+    aeron_spsc_concurrent_array_queue_close(&context->image_rebuild_queue);
 
     aeron_unmap(&context->cnc_map);
     aeron_unmap(&context->loss_report);
@@ -851,6 +1012,11 @@ int aeron_driver_context_close(aeron_driver_context_t *context)
     aeron_free(context->sender_idle_strategy_state);
     aeron_free(context->shared_idle_strategy_state);
     aeron_free(context->shared_network_idle_strategy_state);
+    aeron_free(context->conductor_cpu_affinity);
+    aeron_free(context->sender_cpu_affinity);
+    aeron_free(context->receiver_cpu_affinity);
+    aeron_free(context->shared_network_cpu_affinity);
+    aeron_free(context->shared_cpu_affinity);
     aeron_free((void *)context->conductor_idle_strategy_name);
     aeron_free((void *)context->shared_network_idle_strategy_name);
     aeron_free((void *)context->shared_idle_strategy_name);
@@ -886,6 +1052,21 @@ int aeron_driver_context_validate_mtu_length(uint64_t mtu_length)
     return 0;
 }
 
+int aeron_driver_context_validate_max_messages_per_send(uint64_t max_messages_per_send)
+{
+    if (max_messages_per_send < 1 || max_messages_per_send > AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND)
+    {
+        aeron_set_err(
+            EINVAL,
+            "maxMessagesPerSend must be >= 1 and <= %d: maxMessagesPerSend=%" PRIu64,
+            AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND,
+            max_messages_per_send);
+        return -1;
+    }
+
+    return 0;
+}
+
 bool aeron_is_driver_active_with_cnc(
     aeron_mapped_file_t *cnc_mmap, int64_t timeout_ms, int64_t now_ms, aeron_log_func_t log_func)
 {
@@ -1005,6 +1186,8 @@ extern uint8_t *aeron_cnc_error_log_buffer(aeron_cnc_metadata_t *metadata);
 extern size_t aeron_cnc_computed_length(size_t total_length_of_buffers, size_t alignment);
 
 extern size_t aeron_producer_window_length(size_t producer_window_length, size_t term_length);
+extern int32_t aeron_driver_context_sender_agent_numa_node(aeron_driver_context_t *context);
+extern int32_t aeron_driver_context_receiver_agent_numa_node(aeron_driver_context_t *context);
 
 
 #define AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(r, a) \
@@ -1423,6 +1606,23 @@ aeron_congestion_control_strategy_supplier_func_t aeron_driver_context_get_conge
     aeron_congestion_control_strategy_supplier_load(AERON_CONGESTIONCONTROL_SUPPLIER_DEFAULT);
 }
 
+int aeron_driver_context_set_udp_channel_transport_bindings(
+    aeron_driver_context_t *context, aeron_udp_channel_transport_bindings_t *value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, value);
+
+    context->udp_channel_transport_bindings = value;
+    return 0;
+}
+
+aeron_udp_channel_transport_bindings_t *aeron_driver_context_get_udp_channel_transport_bindings(
+    aeron_driver_context_t *context)
+{
+    return NULL != context ? context->udp_channel_transport_bindings :
+        aeron_udp_channel_transport_bindings_load(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA_DEFAULT);
+}
+
 int aeron_driver_context_set_loss_report_buffer_length(aeron_driver_context_t *context, size_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -1898,3 +2098,385 @@ uint64_t aeron_driver_context_get_nak_unicast_delay_ns(aeron_driver_context_t *c
 {
     return NULL != context ? context->nak_unicast_delay_ns : AERON_NAK_UNICAST_DELAY_NS_DEFAULT;
 }
+
+int aeron_driver_context_set_network_publication_max_messages_per_send(
+    aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (aeron_driver_context_validate_max_messages_per_send(value) < 0)
+    {
+        return -1;
+    }
+
+    context->network_publication_max_messages_per_send = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_network_publication_max_messages_per_send(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->network_publication_max_messages_per_send : AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_DEFAULT;
+}
+
+int aeron_driver_context_set_receiver_io_vector_capacity(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value < 1 || value > AERON_DRIVER_IO_VECTOR_CAPACITY_MAX)
+    {
+        aeron_set_err(
+            EINVAL, "receiver io vector capacity must be >= 1 and <= %d: %" PRIu64,
+            AERON_DRIVER_IO_VECTOR_CAPACITY_MAX, (uint64_t)value);
+        return -1;
+    }
+
+    context->receiver_io_vector_capacity = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_receiver_io_vector_capacity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_io_vector_capacity : AERON_RECEIVER_IO_VECTOR_CAPACITY_DEFAULT;
+}
+
+int aeron_driver_context_set_sender_io_vector_capacity(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value < 1 || value > AERON_DRIVER_IO_VECTOR_CAPACITY_MAX)
+    {
+        aeron_set_err(
+            EINVAL, "sender io vector capacity must be >= 1 and <= %d: %" PRIu64,
+            AERON_DRIVER_IO_VECTOR_CAPACITY_MAX, (uint64_t)value);
+        return -1;
+    }
+
+    context->sender_io_vector_capacity = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_sender_io_vector_capacity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_io_vector_capacity : AERON_SENDER_IO_VECTOR_CAPACITY_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_udp_gso(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_udp_gso = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_udp_gso(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_udp_gso : AERON_SOCKET_UDP_GSO_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_udp_gro(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_udp_gro = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_udp_gro(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_udp_gro : AERON_SOCKET_UDP_GRO_DEFAULT;
+}
+
+int aeron_driver_context_set_udp_transport_poller_io_uring(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->udp_transport_poller_io_uring = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_udp_transport_poller_io_uring(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->udp_transport_poller_io_uring : AERON_UDP_TRANSPORT_POLLER_IO_URING_DEFAULT;
+}
+
+int aeron_driver_context_set_udp_transport_poller_io_uring_buffer_count(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (!AERON_IS_POWER_OF_TWO(value) || value > AERON_UDP_TRANSPORT_IO_URING_BUFFER_COUNT_MAX)
+    {
+        aeron_set_err(
+            EINVAL, "io_uring buffer count must be a power of 2 and <= %d: %" PRIu64,
+            AERON_UDP_TRANSPORT_IO_URING_BUFFER_COUNT_MAX, (uint64_t)value);
+        return -1;
+    }
+
+    context->udp_transport_poller_io_uring_buffer_count = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_udp_transport_poller_io_uring_buffer_count(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->udp_transport_poller_io_uring_buffer_count : AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT_DEFAULT;
+}
+
+int aeron_driver_context_set_raw_log_pool_capacity(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->raw_log_pool_capacity = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_raw_log_pool_capacity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->raw_log_pool_capacity : AERON_RAW_LOG_POOL_CAPACITY_DEFAULT;
+}
+
+int aeron_driver_context_set_nak_max_ranges(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value < 1 || value > AERON_NAK_LIST_MAX_RANGES)
+    {
+        aeron_set_err(
+            EINVAL, "nak max ranges must be >= 1 and <= %d: %" PRIu64, AERON_NAK_LIST_MAX_RANGES, (uint64_t)value);
+        return -1;
+    }
+
+    context->nak_max_ranges = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_nak_max_ranges(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->nak_max_ranges : AERON_NAK_MAX_RANGES_DEFAULT;
+}
+
+int aeron_driver_context_set_max_resend(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value < 1 || value > AERON_RETRANSMIT_HANDLER_MAX_RESEND_MAX)
+    {
+        aeron_set_err(
+            EINVAL, "max resend must be >= 1 and <= %d: %" PRIu64,
+            AERON_RETRANSMIT_HANDLER_MAX_RESEND_MAX, (uint64_t)value);
+        return -1;
+    }
+
+    context->max_resend = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_max_resend(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->max_resend : AERON_MAX_RESEND_DEFAULT;
+}
+
+int aeron_driver_context_set_conductor_cpu_affinity(aeron_driver_context_t *context, const char *value)
+{
+    aeron_cpu_set_t cpu_set;
+
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (NULL != value && aeron_cpu_set_parse(value, &cpu_set) < 0)
+    {
+        return -1;
+    }
+
+    aeron_free(context->conductor_cpu_affinity);
+    context->conductor_cpu_affinity = NULL == value ? NULL : aeron_strndup(value, AERON_MAX_PATH);
+
+    return 0;
+}
+
+const char *aeron_driver_context_get_conductor_cpu_affinity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->conductor_cpu_affinity : NULL;
+}
+
+int aeron_driver_context_set_conductor_numa_node(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "NUMA node must be < %d: %d", AERON_NUMA_MAX_NODES, value);
+        return -1;
+    }
+
+    context->conductor_numa_node = value < 0 ? AERON_NUMA_NODE_NONE : value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_conductor_numa_node(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->conductor_numa_node : AERON_NUMA_NODE_NONE;
+}
+
+int aeron_driver_context_set_sender_cpu_affinity(aeron_driver_context_t *context, const char *value)
+{
+    aeron_cpu_set_t cpu_set;
+
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (NULL != value && aeron_cpu_set_parse(value, &cpu_set) < 0)
+    {
+        return -1;
+    }
+
+    aeron_free(context->sender_cpu_affinity);
+    context->sender_cpu_affinity = NULL == value ? NULL : aeron_strndup(value, AERON_MAX_PATH);
+
+    return 0;
+}
+
+const char *aeron_driver_context_get_sender_cpu_affinity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_cpu_affinity : NULL;
+}
+
+int aeron_driver_context_set_sender_numa_node(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "NUMA node must be < %d: %d", AERON_NUMA_MAX_NODES, value);
+        return -1;
+    }
+
+    context->sender_numa_node = value < 0 ? AERON_NUMA_NODE_NONE : value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_sender_numa_node(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_numa_node : AERON_NUMA_NODE_NONE;
+}
+
+int aeron_driver_context_set_receiver_cpu_affinity(aeron_driver_context_t *context, const char *value)
+{
+    aeron_cpu_set_t cpu_set;
+
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (NULL != value && aeron_cpu_set_parse(value, &cpu_set) < 0)
+    {
+        return -1;
+    }
+
+    aeron_free(context->receiver_cpu_affinity);
+    context->receiver_cpu_affinity = NULL == value ? NULL : aeron_strndup(value, AERON_MAX_PATH);
+
+    return 0;
+}
+
+const char *aeron_driver_context_get_receiver_cpu_affinity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_cpu_affinity : NULL;
+}
+
+int aeron_driver_context_set_receiver_numa_node(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "NUMA node must be < %d: %d", AERON_NUMA_MAX_NODES, value);
+        return -1;
+    }
+
+    context->receiver_numa_node = value < 0 ? AERON_NUMA_NODE_NONE : value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_receiver_numa_node(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_numa_node : AERON_NUMA_NODE_NONE;
+}
+
+int aeron_driver_context_set_sharednetwork_cpu_affinity(aeron_driver_context_t *context, const char *value)
+{
+    aeron_cpu_set_t cpu_set;
+
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (NULL != value && aeron_cpu_set_parse(value, &cpu_set) < 0)
+    {
+        return -1;
+    }
+
+    aeron_free(context->shared_network_cpu_affinity);
+    context->shared_network_cpu_affinity = NULL == value ? NULL : aeron_strndup(value, AERON_MAX_PATH);
+
+    return 0;
+}
+
+const char *aeron_driver_context_get_sharednetwork_cpu_affinity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->shared_network_cpu_affinity : NULL;
+}
+
+int aeron_driver_context_set_sharednetwork_numa_node(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "NUMA node must be < %d: %d", AERON_NUMA_MAX_NODES, value);
+        return -1;
+    }
+
+    context->shared_network_numa_node = value < 0 ? AERON_NUMA_NODE_NONE : value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_sharednetwork_numa_node(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->shared_network_numa_node : AERON_NUMA_NODE_NONE;
+}
+
+int aeron_driver_context_set_shared_cpu_affinity(aeron_driver_context_t *context, const char *value)
+{
+    aeron_cpu_set_t cpu_set;
+
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (NULL != value && aeron_cpu_set_parse(value, &cpu_set) < 0)
+    {
+        return -1;
+    }
+
+    aeron_free(context->shared_cpu_affinity);
+    context->shared_cpu_affinity = NULL == value ? NULL : aeron_strndup(value, AERON_MAX_PATH);
+
+    return 0;
+}
+
+const char *aeron_driver_context_get_shared_cpu_affinity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->shared_cpu_affinity : NULL;
+}
+
+int aeron_driver_context_set_shared_numa_node(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "NUMA node must be < %d: %d", AERON_NUMA_MAX_NODES, value);
+        return -1;
+    }
+
+    context->shared_numa_node = value < 0 ? AERON_NUMA_NODE_NONE : value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_shared_numa_node(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->shared_numa_node : AERON_NUMA_NODE_NONE;
+}
@@ -21,11 +21,13 @@
 #include "aeronmd.h"
 #include "util/aeron_bitutil.h"
 #include "util/aeron_fileutil.h"
+#include "util/aeron_clock.h"
 #include "concurrent/aeron_spsc_concurrent_array_queue.h"
 #include "concurrent/aeron_mpsc_concurrent_array_queue.h"
 #include "concurrent/aeron_mpsc_rb.h"
 #include "aeron_flow_control.h"
 #include "aeron_congestion_control.h"
+#include "aeron_raw_log_pool.h"
 #include "aeron_agent.h"
 
 #define AERON_CNC_FILE "cnc.dat"
@@ -51,6 +53,10 @@ aeron_cnc_metadata_t;
 #define AERON_CNC_VERSION_AND_META_DATA_LENGTH (AERON_ALIGN(sizeof(aeron_cnc_metadata_t), AERON_CACHE_LINE_LENGTH * 2))
 
 #define AERON_COMMAND_QUEUE_CAPACITY (256)
+#define AERON_IMAGE_REBUILD_QUEUE_CAPACITY (4096)
+
+#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND (64)
+#define AERON_DRIVER_IO_VECTOR_CAPACITY_MAX (64)
 
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 
@@ -106,6 +112,16 @@ typedef struct aeron_driver_context_stct
     size_t loss_report_length;                   /* aeron.loss.report.buffer.length = 1MB */
     size_t file_page_size;                       /* aeron.file.page.size = 4KB */
     size_t nak_multicast_group_size;             /* aeron.nak.multicast.group.size = 10 */
+    size_t network_publication_max_messages_per_send; /* aeron.network.publication.max.messages.per.send = 2 */
+    size_t receiver_io_vector_capacity;          /* aeron.receiver.io.vector.capacity = 2 */
+    size_t sender_io_vector_capacity;            /* aeron.sender.io.vector.capacity = 2 */
+    bool socket_udp_gso;                         /* aeron.socket.udp.gso = false */
+    bool socket_udp_gro;                         /* aeron.socket.udp.gro = false */
+    bool udp_transport_poller_io_uring;          /* aeron.udp.transport.poller.io.uring = false */
+    size_t udp_transport_poller_io_uring_buffer_count; /* aeron.udp.transport.poller.io.uring.buffer.count = 256 */
+    size_t raw_log_pool_capacity;                /* aeron.raw.log.pool.capacity = 0 */
+    size_t nak_max_ranges;                       /* aeron.nak.max.ranges = 1 */
+    size_t max_resend;                           /* aeron.max.resend = 16 */
     uint8_t multicast_ttl;                       /* aeron.socket.multicast.ttl = 0 */
 
     aeron_mapped_file_t cnc_map;
@@ -120,9 +136,14 @@ typedef struct aeron_driver_context_stct
     aeron_clock_func_t nano_clock;
     aeron_clock_func_t epoch_clock;
 
+    aeron_clock_cache_t conductor_cached_clock;
+    aeron_clock_cache_t sender_cached_clock;
+    aeron_clock_cache_t receiver_cached_clock;
+
     aeron_spsc_concurrent_array_queue_t sender_command_queue;
     aeron_spsc_concurrent_array_queue_t receiver_command_queue;
     aeron_mpsc_concurrent_array_queue_t conductor_command_queue;
+    aeron_spsc_concurrent_array_queue_t image_rebuild_queue;
 
     aeron_agent_on_start_func_t agent_on_start_func;
     void *agent_on_start_state;
@@ -131,35 +152,47 @@ typedef struct aeron_driver_context_stct
     void *conductor_idle_strategy_state;
     char *conductor_idle_strategy_init_args;
     const char *conductor_idle_strategy_name;
+    char *conductor_cpu_affinity;
+    int32_t conductor_numa_node;
 
     aeron_idle_strategy_func_t shared_idle_strategy_func;
     void *shared_idle_strategy_state;
     char *shared_idle_strategy_init_args;
     const char *shared_idle_strategy_name;
+    char *shared_cpu_affinity;
+    int32_t shared_numa_node;
 
     aeron_idle_strategy_func_t shared_network_idle_strategy_func;
     void *shared_network_idle_strategy_state;
     char *shared_network_idle_strategy_init_args;
     const char *shared_network_idle_strategy_name;
+    char *shared_network_cpu_affinity;
+    int32_t shared_network_numa_node;
 
     aeron_idle_strategy_func_t sender_idle_strategy_func;
     void *sender_idle_strategy_state;
     char *sender_idle_strategy_init_args;
     const char *sender_idle_strategy_name;
+    char *sender_cpu_affinity;
+    int32_t sender_numa_node;
 
     aeron_idle_strategy_func_t receiver_idle_strategy_func;
     void *receiver_idle_strategy_state;
     char *receiver_idle_strategy_init_args;
     const char *receiver_idle_strategy_name;
+    char *receiver_cpu_affinity;
+    int32_t receiver_numa_node;
 
     aeron_usable_fs_space_func_t usable_fs_space_func;
     aeron_map_raw_log_func_t map_raw_log_func;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
+    aeron_raw_log_pool_t *raw_log_pool;
 
     aeron_flow_control_strategy_supplier_func_t unicast_flow_control_supplier_func;
     aeron_flow_control_strategy_supplier_func_t multicast_flow_control_supplier_func;
 
     aeron_congestion_control_strategy_supplier_func_t congestion_control_supplier_func;
+    aeron_udp_channel_transport_bindings_t *udp_channel_transport_bindings;
 
     aeron_driver_conductor_proxy_t *conductor_proxy;
     aeron_driver_sender_proxy_t *sender_proxy;
@@ -183,10 +216,16 @@ aeron_driver_context_t;
 
 void aeron_driver_context_print_configuration(aeron_driver_context_t *context);
 
+bool aeron_config_parse_bool(const char *str, bool def);
+
+int64_t aeron_config_parse_int64(const char *name, const char *str, int64_t def, int64_t min, int64_t max);
+
 void aeron_driver_fill_cnc_metadata(aeron_driver_context_t *context);
 
 int aeron_driver_context_validate_mtu_length(uint64_t mtu_length);
 
+int aeron_driver_context_validate_max_messages_per_send(uint64_t max_messages_per_send);
+
 size_t aeron_cnc_length(aeron_driver_context_t *context);
 
 inline int32_t aeron_cnc_version_volatile(aeron_cnc_metadata_t *metadata)
@@ -252,4 +291,34 @@ inline size_t aeron_producer_window_length(size_t producer_window_length, size_t
     return window_length;
 }
 
+inline int32_t aeron_driver_context_sender_agent_numa_node(aeron_driver_context_t *context)
+{
+    switch (context->threading_mode)
+    {
+        case AERON_THREADING_MODE_SHARED:
+            return context->shared_numa_node;
+
+        case AERON_THREADING_MODE_SHARED_NETWORK:
+            return context->shared_network_numa_node;
+
+        default:
+            return context->sender_numa_node;
+    }
+}
+
+inline int32_t aeron_driver_context_receiver_agent_numa_node(aeron_driver_context_t *context)
+{
+    switch (context->threading_mode)
+    {
+        case AERON_THREADING_MODE_SHARED:
+            return context->shared_numa_node;
+
+        case AERON_THREADING_MODE_SHARED_NETWORK:
+            return context->shared_network_numa_node;
+
+        default:
+            return context->receiver_numa_node;
+    }
+}
+
 #endif //AERON_DRIVER_CONTEXT_H
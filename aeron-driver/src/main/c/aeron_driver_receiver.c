@@ -22,6 +22,7 @@
 #include "aeron_socket.h"
 #include <stdio.h>
 #include "util/aeron_arrayutil.h"
+#include "util/aeron_affinity.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_receiver.h"
 #include "aeron_publication_image.h"
@@ -40,28 +41,70 @@ int aeron_driver_receiver_init(
     aeron_system_counters_t *system_counters,
     aeron_distinct_error_log_t *error_log)
 {
-    if (aeron_udp_transport_poller_init(&receiver->poller) < 0)
+    receiver->poller_poll_func = context->udp_channel_transport_bindings->poller_poll_func;
+
+    if (context->udp_channel_transport_bindings->poller_init_func(
+        &receiver->poller, context, AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH) < 0)
     {
         return -1;
     }
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
+    const size_t vector_capacity = context->receiver_io_vector_capacity;
+    size_t offset = 0;
+
+    receiver->recv_buffers.vector_capacity = vector_capacity;
+    receiver->recv_buffers.buffer = NULL;
+    receiver->recv_buffers.iov = NULL;
+    receiver->recv_buffers.addrs = NULL;
+    receiver->recv_buffers.msgvec = NULL;
+    receiver->recv_buffers.control = NULL;
+
+    if (aeron_alloc_aligned(
+        (void **)&receiver->recv_buffers.buffer,
+        &offset,
+        vector_capacity * AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH,
+        AERON_CACHE_LINE_LENGTH * 2) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.iov, vector_capacity * sizeof(struct iovec)) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.addrs, vector_capacity * sizeof(struct sockaddr_storage)) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.msgvec, vector_capacity * sizeof(struct mmsghdr)) < 0 ||
+        (context->socket_udp_gro && aeron_alloc(
+            (void **)&receiver->recv_buffers.control,
+            vector_capacity * AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH) < 0))
     {
-        size_t offset = 0;
-        if (aeron_alloc_aligned(
-            (void **)&receiver->recv_buffers.buffers[i],
-            &offset,
-            AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH,
-            AERON_CACHE_LINE_LENGTH * 2) < 0)
-        {
-            int errcode = errno;
+        int errcode = errno;
 
-            aeron_set_err(errcode, "%s:%d: %s", __FILE__, __LINE__, strerror(errcode));
-            return -1;
-        }
+        aeron_set_err(errcode, "%s:%d: %s", __FILE__, __LINE__, strerror(errcode));
+        return -1;
+    }
+
+    aeron_numa_bind_preferred(
+        receiver->recv_buffers.buffer,
+        offset + (vector_capacity * AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH),
+        aeron_driver_context_receiver_agent_numa_node(context));
 
-        receiver->recv_buffers.iov[i].iov_base = receiver->recv_buffers.buffers[i] + offset;
+    for (size_t i = 0; i < vector_capacity; i++)
+    {
+        struct mmsghdr *msg = &receiver->recv_buffers.msgvec[i];
+
+        receiver->recv_buffers.iov[i].iov_base =
+            receiver->recv_buffers.buffer + offset + (i * AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH);
         receiver->recv_buffers.iov[i].iov_len = AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH;
+
+        msg->msg_hdr.msg_name = &receiver->recv_buffers.addrs[i];
+        msg->msg_hdr.msg_namelen = sizeof(receiver->recv_buffers.addrs[i]);
+        msg->msg_hdr.msg_iov = &receiver->recv_buffers.iov[i];
+        msg->msg_hdr.msg_iovlen = 1;
+        msg->msg_hdr.msg_flags = 0;
+        msg->msg_hdr.msg_control = NULL;
+        msg->msg_hdr.msg_controllen = 0;
+        msg->msg_len = 0;
+
+        if (NULL != receiver->recv_buffers.control)
+        {
+            msg->msg_hdr.msg_control =
+                receiver->recv_buffers.control + (i * AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH);
+            msg->msg_hdr.msg_controllen = AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH;
+        }
     }
 
     receiver->images.array = NULL;
@@ -74,6 +117,7 @@ int aeron_driver_receiver_init(
 
     receiver->context = context;
     receiver->error_log = error_log;
+    aeron_clock_update_cached_nano_time(&context->receiver_cached_clock, context->nano_clock());
 
     receiver->receiver_proxy.command_queue = &context->receiver_command_queue;
     receiver->receiver_proxy.fail_counter = aeron_system_counter_addr(
@@ -86,6 +130,11 @@ int aeron_driver_receiver_init(
     receiver->total_bytes_received_counter =  aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_BYTES_RECEIVED);
 
+    if (receiver->poller.is_io_uring_unavailable)
+    {
+        AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver io_uring unavailable, using %s", "epoll/poll");
+    }
+
     return 0;
 }
 
@@ -98,30 +147,21 @@ void aeron_driver_receiver_on_command(void *clientd, volatile void *item)
 
 int aeron_driver_receiver_do_work(void *clientd)
 {
-    struct mmsghdr mmsghdr[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
     aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
     int64_t bytes_received = 0;
     int work_count = 0;
+    int64_t now_ns = receiver->context->nano_clock();
+
+    aeron_clock_update_cached_nano_time(&receiver->context->receiver_cached_clock, now_ns);
 
     work_count += aeron_spsc_concurrent_array_queue_drain(
         receiver->receiver_proxy.command_queue, aeron_driver_receiver_on_command, receiver, 10);
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
-    {
-        mmsghdr[i].msg_hdr.msg_name = &receiver->recv_buffers.addrs[i];
-        mmsghdr[i].msg_hdr.msg_namelen = sizeof(receiver->recv_buffers.addrs[i]);
-        mmsghdr[i].msg_hdr.msg_iov = &receiver->recv_buffers.iov[i];
-        mmsghdr[i].msg_hdr.msg_iovlen = 1;
-        mmsghdr[i].msg_hdr.msg_flags = 0;
-        mmsghdr[i].msg_hdr.msg_control = NULL;
-        mmsghdr[i].msg_hdr.msg_controllen = 0;
-        mmsghdr[i].msg_len = 0;
-    }
-
-    int poll_result = aeron_udp_transport_poller_poll(
+    int poll_result = receiver->poller_poll_func(
         &receiver->poller,
-        mmsghdr,
-        AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS,
+        receiver->recv_buffers.msgvec,
+        receiver->recv_buffers.vector_capacity,
+        &bytes_received,
         aeron_receive_channel_endpoint_dispatch,
         receiver);
 
@@ -130,20 +170,16 @@ int aeron_driver_receiver_do_work(void *clientd)
         AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver poller_poll: %s", aeron_errmsg());
     }
 
-    for (int i = 0; i < poll_result; i++)
-    {
-        bytes_received += mmsghdr[i].msg_len;
-        work_count++;
-    }
+    work_count += (poll_result < 0) ? 0 : poll_result;
 
     aeron_counter_add_ordered(receiver->total_bytes_received_counter, bytes_received);
 
-    int64_t now_ns = receiver->context->nano_clock();
-
     for (size_t i = 0, length = receiver->images.length; i < length; i++)
     {
         aeron_publication_image_t *image = receiver->images.array[i].image;
 
+        aeron_publication_image_signal_rebuild(image, &receiver->context->image_rebuild_queue);
+
         int send_sm_result = aeron_publication_image_send_pending_status_message(image);
         if (send_sm_result < 0)
         {
@@ -217,15 +253,16 @@ void aeron_driver_receiver_on_close(void *clientd)
 {
     aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
-    {
-        aeron_free(receiver->recv_buffers.buffers[i]);
-    }
+    aeron_free(receiver->recv_buffers.buffer);
+    aeron_free(receiver->recv_buffers.iov);
+    aeron_free(receiver->recv_buffers.addrs);
+    aeron_free(receiver->recv_buffers.msgvec);
+    aeron_free(receiver->recv_buffers.control);
 
     aeron_free(receiver->images.array);
     aeron_free(receiver->pending_setups.array);
 
-    aeron_udp_transport_poller_close(&receiver->poller);
+    receiver->context->udp_channel_transport_bindings->poller_close_func(&receiver->poller);
 }
 
 void aeron_driver_receiver_on_add_endpoint(void *clientd, void *command)
@@ -235,7 +272,7 @@ void aeron_driver_receiver_on_add_endpoint(void *clientd, void *command)
     aeron_receive_channel_endpoint_t *endpoint = (aeron_receive_channel_endpoint_t *)cmd->item;
     aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
 
-    if (aeron_udp_transport_poller_add(&receiver->poller, &endpoint->transport) < 0)
+    if (receiver->context->udp_channel_transport_bindings->poller_add_func(&receiver->poller, &endpoint->transport) < 0)
     {
         AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_add_endpoint: %s", aeron_errmsg());
     }
@@ -270,7 +307,8 @@ void aeron_driver_receiver_on_remove_endpoint(void *clientd, void *command)
     aeron_command_base_t *cmd = (aeron_command_base_t *)command;
     aeron_receive_channel_endpoint_t *endpoint = (aeron_receive_channel_endpoint_t *)cmd->item;
 
-    if (aeron_udp_transport_poller_remove(&receiver->poller, &endpoint->transport) < 0)
+    if (receiver->context->udp_channel_transport_bindings->poller_remove_func(
+        &receiver->poller, &endpoint->transport) < 0)
     {
         AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_remove_endpoint: %s", aeron_errmsg());
     }
@@ -405,7 +443,7 @@ int aeron_driver_receiver_add_pending_setup(
     entry->endpoint = endpoint;
     entry->session_id = session_id;
     entry->stream_id = stream_id;
-    entry->time_of_status_message_ns = receiver->context->nano_clock();
+    entry->time_of_status_message_ns = aeron_clock_cached_nano_time(&receiver->context->receiver_cached_clock);
     entry->is_periodic = false;
     if (NULL != control_addr)
     {
@@ -18,12 +18,12 @@
 #define AERON_DRIVER_RECEIVER_H
 
 #include "media/aeron_udp_transport_poller.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
 #include "concurrent/aeron_distinct_error_log.h"
 #include "aeron_driver_context.h"
 #include "aeron_driver_receiver_proxy.h"
 #include "aeron_system_counters.h"
 
-#define AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS (2)
 #define AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH (64 * 1024)
 
 #define AERON_DRIVER_RECEIVER_PENDING_SETUP_TIMEOUT_NS (1000 * 1000 * 1000L)
@@ -49,12 +49,16 @@ typedef struct aeron_driver_receiver_stct
 {
     aeron_driver_receiver_proxy_t receiver_proxy;
     aeron_udp_transport_poller_t poller;
+    aeron_udp_transport_poller_poll_func_t poller_poll_func;
 
     struct aeron_driver_receiver_buffers_stct
     {
-        uint8_t *buffers[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
-        struct iovec iov[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
-        struct sockaddr_storage addrs[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
+        size_t vector_capacity;
+        uint8_t *buffer;
+        struct iovec *iov;
+        struct sockaddr_storage *addrs;
+        struct mmsghdr *msgvec;
+        uint8_t *control;
     }
     recv_buffers;
 
@@ -31,6 +31,7 @@ struct mmsghdr
 #endif
 
 #include "util/aeron_arrayutil.h"
+#include "util/aeron_affinity.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "aeron_driver_sender.h"
 #include "aeron_driver_conductor_proxy.h"
@@ -41,28 +42,55 @@ int aeron_driver_sender_init(
     aeron_system_counters_t *system_counters,
     aeron_distinct_error_log_t *error_log)
 {
-    if (aeron_udp_transport_poller_init(&sender->poller) < 0)
+    sender->poller_poll_func = context->udp_channel_transport_bindings->poller_poll_func;
+
+    if (context->udp_channel_transport_bindings->poller_init_func(&sender->poller, context, context->mtu_length) < 0)
     {
         return -1;
     }
 
-    for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
+    const size_t vector_capacity = context->sender_io_vector_capacity;
+    const size_t slot_length = AERON_ALIGN(context->mtu_length, AERON_CACHE_LINE_LENGTH * 2);
+    size_t offset = 0;
+
+    sender->recv_buffers.vector_capacity = vector_capacity;
+    sender->recv_buffers.buffer = NULL;
+    sender->recv_buffers.iov = NULL;
+    sender->recv_buffers.addrs = NULL;
+    sender->recv_buffers.msgvec = NULL;
+
+    if (aeron_alloc_aligned(
+        (void **)&sender->recv_buffers.buffer, &offset, vector_capacity * slot_length, AERON_CACHE_LINE_LENGTH * 2) < 0 ||
+        aeron_alloc((void **)&sender->recv_buffers.iov, vector_capacity * sizeof(struct iovec)) < 0 ||
+        aeron_alloc((void **)&sender->recv_buffers.addrs, vector_capacity * sizeof(struct sockaddr_storage)) < 0 ||
+        aeron_alloc((void **)&sender->recv_buffers.msgvec, vector_capacity * sizeof(struct mmsghdr)) < 0)
     {
-        size_t offset = 0;
-        if (aeron_alloc_aligned(
-            (void **)&sender->recv_buffers.buffers[i],
-            &offset,
-            context->mtu_length,
-            AERON_CACHE_LINE_LENGTH * 2) < 0)
-        {
-            int errcode = errno;
+        int errcode = errno;
 
-            aeron_set_err(errcode, "%s:%d: %s", __FILE__, __LINE__, strerror(errcode));
-            return -1;
-        }
+        aeron_set_err(errcode, "%s:%d: %s", __FILE__, __LINE__, strerror(errcode));
+        return -1;
+    }
+
+    aeron_numa_bind_preferred(
+        sender->recv_buffers.buffer,
+        offset + (vector_capacity * slot_length),
+        aeron_driver_context_sender_agent_numa_node(context));
 
-        sender->recv_buffers.iov[i].iov_base = sender->recv_buffers.buffers[i] + offset;
+    for (size_t i = 0; i < vector_capacity; i++)
+    {
+        struct mmsghdr *msg = &sender->recv_buffers.msgvec[i];
+
+        sender->recv_buffers.iov[i].iov_base = sender->recv_buffers.buffer + offset + (i * slot_length);
         sender->recv_buffers.iov[i].iov_len = context->mtu_length;
+
+        msg->msg_hdr.msg_name = &sender->recv_buffers.addrs[i];
+        msg->msg_hdr.msg_namelen = sizeof(sender->recv_buffers.addrs[i]);
+        msg->msg_hdr.msg_iov = &sender->recv_buffers.iov[i];
+        msg->msg_hdr.msg_iovlen = 1;
+        msg->msg_hdr.msg_flags = 0;
+        msg->msg_hdr.msg_control = NULL;
+        msg->msg_hdr.msg_controllen = 0;
+        msg->msg_len = 0;
     }
 
     sender->context = context;
@@ -82,6 +110,7 @@ int aeron_driver_sender_init(
     sender->duty_cycle_ratio = context->send_to_sm_poll_ratio;
     sender->status_message_read_timeout_ns = context->status_message_timeout_ns / 2;
     sender->control_poll_timeout_ns = 0;
+    aeron_clock_update_cached_nano_time(&context->sender_cached_clock, context->nano_clock());
     sender->total_bytes_sent_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_BYTES_SENT);
     sender->errors_counter =
@@ -93,6 +122,11 @@ int aeron_driver_sender_init(
     sender->nak_messages_received_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_NAK_MESSAGES_RECEIVED);
 
+    if (sender->poller.is_io_uring_unavailable)
+    {
+        AERON_DRIVER_SENDER_ERROR(sender, "sender io_uring unavailable, using %s", "epoll/poll");
+    }
+
     return 0;
 }
 
@@ -111,12 +145,14 @@ int aeron_driver_sender_do_work(void *clientd)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
     int work_count = 0;
+    int64_t now_ns = sender->context->nano_clock();
+
+    aeron_clock_update_cached_nano_time(&sender->context->sender_cached_clock, now_ns);
 
     work_count +=
         aeron_spsc_concurrent_array_queue_drain(
             sender->sender_proxy.command_queue, aeron_driver_sender_on_command, sender, 10);
 
-    int64_t now_ns = sender->context->nano_clock();
     int bytes_sent = aeron_driver_sender_do_send(sender, now_ns);
     int poll_result;
 
@@ -124,24 +160,13 @@ int aeron_driver_sender_do_work(void *clientd)
         ++sender->duty_cycle_counter == sender->duty_cycle_ratio ||
         now_ns > sender->control_poll_timeout_ns)
     {
-        struct mmsghdr mmsghdr[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
+        int64_t bytes_received = 0;
 
-        for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
-        {
-            mmsghdr[i].msg_hdr.msg_name = &sender->recv_buffers.addrs[i];
-            mmsghdr[i].msg_hdr.msg_namelen = sizeof(sender->recv_buffers.addrs[i]);
-            mmsghdr[i].msg_hdr.msg_iov = &sender->recv_buffers.iov[i];
-            mmsghdr[i].msg_hdr.msg_iovlen = 1;
-            mmsghdr[i].msg_hdr.msg_flags = 0;
-            mmsghdr[i].msg_hdr.msg_control = NULL;
-            mmsghdr[i].msg_hdr.msg_controllen = 0;
-            mmsghdr[i].msg_len = 0;
-        }
-
-        poll_result = aeron_udp_transport_poller_poll(
+        poll_result = sender->poller_poll_func(
             &sender->poller,
-            mmsghdr,
-            AERON_DRIVER_SENDER_NUM_RECV_BUFFERS,
+            sender->recv_buffers.msgvec,
+            sender->recv_buffers.vector_capacity,
+            &bytes_received,
             aeron_send_channel_endpoint_dispatch,
             sender);
 
@@ -163,12 +188,12 @@ void aeron_driver_sender_on_close(void *clientd)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
 
-    for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
-    {
-        aeron_free(sender->recv_buffers.buffers[i]);
-    }
+    aeron_free(sender->recv_buffers.buffer);
+    aeron_free(sender->recv_buffers.iov);
+    aeron_free(sender->recv_buffers.addrs);
+    aeron_free(sender->recv_buffers.msgvec);
 
-    aeron_udp_transport_poller_close(&sender->poller);
+    sender->context->udp_channel_transport_bindings->poller_close_func(&sender->poller);
     aeron_free(sender->network_publications.array);
 }
 
@@ -178,7 +203,7 @@ void aeron_driver_sender_on_add_endpoint(void *clientd, void *command)
     aeron_command_base_t *cmd = (aeron_command_base_t *)command;
     aeron_send_channel_endpoint_t *endpoint = (aeron_send_channel_endpoint_t *)cmd->item;
 
-    if (aeron_udp_transport_poller_add(&sender->poller, &endpoint->transport) < 0)
+    if (sender->context->udp_channel_transport_bindings->poller_add_func(&sender->poller, &endpoint->transport) < 0)
     {
         AERON_DRIVER_SENDER_ERROR(sender, "sender on_add_endpoint: %s", aeron_errmsg());
     }
@@ -190,7 +215,7 @@ void aeron_driver_sender_on_remove_endpoint(void *clientd, void *command)
     aeron_command_base_t *cmd = (aeron_command_base_t *)command;
     aeron_send_channel_endpoint_t *endpoint = (aeron_send_channel_endpoint_t *)cmd->item;
 
-    if (aeron_udp_transport_poller_remove(&sender->poller, &endpoint->transport) < 0)
+    if (sender->context->udp_channel_transport_bindings->poller_remove_func(&sender->poller, &endpoint->transport) < 0)
     {
         AERON_DRIVER_SENDER_ERROR(sender, "sender on_remove_endpoint: %s", aeron_errmsg());
     }
@@ -260,6 +285,14 @@ void aeron_driver_sender_on_add_destination(void *clientd, void *command)
     }
 }
 
+void aeron_driver_sender_on_check_destinations(void *clientd, void *command)
+{
+    aeron_command_base_t *cmd = (aeron_command_base_t *)command;
+    aeron_send_channel_endpoint_t *endpoint = (aeron_send_channel_endpoint_t *)cmd->item;
+
+    aeron_send_channel_endpoint_check_destinations(endpoint);
+}
+
 void aeron_driver_sender_on_remove_destination(void *clientd, void *command)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
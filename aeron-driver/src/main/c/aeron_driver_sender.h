@@ -22,6 +22,7 @@
 #include "aeron_driver_sender_proxy.h"
 #include "aeron_system_counters.h"
 #include "media/aeron_udp_transport_poller.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
 #include "aeron_network_publication.h"
 #include "concurrent/aeron_distinct_error_log.h"
 
@@ -31,12 +32,11 @@ typedef struct aeron_driver_sender_network_publication_entry_stct
 }
 aeron_driver_sender_network_publication_entry_t;
 
-#define AERON_DRIVER_SENDER_NUM_RECV_BUFFERS (2)
-
 typedef struct aeron_driver_sender_stct
 {
     aeron_driver_sender_proxy_t sender_proxy;
     aeron_udp_transport_poller_t poller;
+    aeron_udp_transport_poller_poll_func_t poller_poll_func;
 
     struct aeron_driver_sender_network_publications_stct
     {
@@ -48,9 +48,11 @@ typedef struct aeron_driver_sender_stct
 
     struct aeron_driver_sender_buffers_stct
     {
-        uint8_t *buffers[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
-        struct iovec iov[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
-        struct sockaddr_storage addrs[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
+        size_t vector_capacity;
+        uint8_t *buffer;
+        struct iovec *iov;
+        struct sockaddr_storage *addrs;
+        struct mmsghdr *msgvec;
     }
     recv_buffers;
 
@@ -96,6 +98,7 @@ void aeron_driver_sender_on_remove_endpoint(void *clientd, void *command);
 void aeron_driver_sender_on_add_publication(void *clientd, void *command);
 void aeron_driver_sender_on_remove_publication(void *clientd, void *command);
 void aeron_driver_sender_on_add_destination(void *clientd, void *command);
+void aeron_driver_sender_on_check_destinations(void *clientd, void *command);
 void aeron_driver_sender_on_remove_destination(void *clientd, void *command);
 
 int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns);
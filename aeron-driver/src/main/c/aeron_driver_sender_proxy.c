@@ -147,6 +147,36 @@ void aeron_driver_sender_proxy_on_remove_publication(
     }
 }
 
+void aeron_driver_sender_proxy_on_check_destinations(
+    aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint)
+{
+    if (AERON_THREADING_MODE_SHARED == sender_proxy->threading_mode)
+    {
+        aeron_command_base_t cmd =
+            {
+                .func = aeron_driver_sender_on_check_destinations,
+                .item = endpoint
+            };
+
+        aeron_driver_sender_on_check_destinations(sender_proxy->sender, &cmd);
+    }
+    else
+    {
+        aeron_command_base_t *cmd;
+
+        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_base_t)) < 0)
+        {
+            aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
+            return;
+        }
+
+        cmd->func = aeron_driver_sender_on_check_destinations;
+        cmd->item = endpoint;
+
+        aeron_driver_sender_proxy_offer(sender_proxy, cmd);
+    }
+}
+
 void aeron_driver_sender_proxy_on_add_destination(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint, struct sockaddr_storage *addr)
 {
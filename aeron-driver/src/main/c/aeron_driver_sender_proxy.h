@@ -44,6 +44,9 @@ void aeron_driver_sender_proxy_on_add_publication(
 void aeron_driver_sender_proxy_on_remove_publication(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_network_publication_t *publication);
 
+void aeron_driver_sender_proxy_on_check_destinations(
+    aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint);
+
 typedef struct aeron_command_destination_stct
 {
     aeron_command_base_t base;
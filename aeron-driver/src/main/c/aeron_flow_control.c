@@ -20,6 +20,8 @@
 #endif
 
 #include <errno.h>
+#include <string.h>
+#include <stdlib.h>
 #include "protocol/aeron_udp_protocol.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
 #include "util/aeron_error.h"
@@ -43,6 +45,104 @@ aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier
     return func;
 }
 
+aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier_from_uri_value(const char *fc_value)
+{
+    const char *options = strchr(fc_value, ',');
+    const size_t name_length = NULL != options ? (size_t)(options - fc_value) : strlen(fc_value);
+
+    if (strlen(AERON_FLOW_CONTROL_URI_MAX_VALUE) == name_length &&
+        strncmp(fc_value, AERON_FLOW_CONTROL_URI_MAX_VALUE, name_length) == 0)
+    {
+        return aeron_max_multicast_flow_control_strategy_supplier;
+    }
+
+    if (strlen(AERON_FLOW_CONTROL_URI_MIN_VALUE) == name_length &&
+        strncmp(fc_value, AERON_FLOW_CONTROL_URI_MIN_VALUE, name_length) == 0)
+    {
+        return aeron_min_flow_control_strategy_supplier;
+    }
+
+    if (strlen(AERON_FLOW_CONTROL_URI_TAGGED_VALUE) == name_length &&
+        strncmp(fc_value, AERON_FLOW_CONTROL_URI_TAGGED_VALUE, name_length) == 0)
+    {
+        return aeron_tagged_flow_control_strategy_supplier;
+    }
+
+    aeron_set_err(EINVAL, "unknown flow control strategy: %s", fc_value);
+
+    return NULL;
+}
+
+int aeron_flow_control_parse_group_option(const char *fc_value, int64_t *group_tag, int32_t *group_min_size)
+{
+    const char *option = NULL != fc_value ? strchr(fc_value, ',') : NULL;
+
+    while (NULL != option)
+    {
+        option++;
+
+        if (strncmp(option, AERON_FLOW_CONTROL_URI_GROUP_PREFIX, strlen(AERON_FLOW_CONTROL_URI_GROUP_PREFIX)) == 0)
+        {
+            const char *ptr = option + strlen(AERON_FLOW_CONTROL_URI_GROUP_PREFIX);
+            char *end_ptr = NULL;
+
+            if ('/' != *ptr && ',' != *ptr && '\0' != *ptr)
+            {
+                errno = 0;
+                long long tag = strtoll(ptr, &end_ptr, 10);
+
+                if (0 != errno || end_ptr == ptr)
+                {
+                    goto error;
+                }
+
+                *group_tag = (int64_t)tag;
+                ptr = end_ptr;
+            }
+
+            if ('/' == *ptr)
+            {
+                ptr++;
+                errno = 0;
+                long long size = strtoll(ptr, &end_ptr, 10);
+
+                if (0 != errno || end_ptr == ptr || size < 0 || size > INT32_MAX)
+                {
+                    goto error;
+                }
+
+                *group_min_size = (int32_t)size;
+                ptr = end_ptr;
+            }
+
+            if (',' != *ptr && '\0' != *ptr)
+            {
+                goto error;
+            }
+        }
+
+        option = strchr(option, ',');
+    }
+
+    return 0;
+
+    error:
+        aeron_set_err(EINVAL, "could not parse flow control group option: %s", fc_value);
+
+    return -1;
+}
+
+bool aeron_flow_control_status_message_group_tag(const uint8_t *sm, size_t length, int64_t *group_tag)
+{
+    if (length >= sizeof(aeron_status_message_header_t) + AERON_STATUS_MESSAGE_GROUP_TAG_LENGTH)
+    {
+        memcpy(group_tag, sm + sizeof(aeron_status_message_header_t), AERON_STATUS_MESSAGE_GROUP_TAG_LENGTH);
+        return true;
+    }
+
+    return false;
+}
+
 typedef struct aeron_max_flow_control_strategy_state_stct
 {
     int64_t last_position;
@@ -84,6 +184,11 @@ int64_t aeron_max_flow_control_strategy_on_sm(
     return snd_lmt > window_edge ? snd_lmt : window_edge;
 }
 
+bool aeron_max_flow_control_strategy_has_required_receivers(aeron_flow_control_strategy_t *strategy)
+{
+    return true;
+}
+
 int aeron_max_flow_control_strategy_fini(aeron_flow_control_strategy_t *strategy)
 {
     aeron_free(strategy->state);
@@ -110,6 +215,7 @@ int aeron_max_multicast_flow_control_strategy_supplier(
 
     _strategy->on_idle = aeron_max_flow_control_strategy_on_idle;
     _strategy->on_status_message = aeron_max_flow_control_strategy_on_sm;
+    _strategy->has_required_receivers = aeron_max_flow_control_strategy_has_required_receivers;
     _strategy->fini = aeron_max_flow_control_strategy_fini;
 
     aeron_max_flow_control_strategy_state_t *state = (aeron_max_flow_control_strategy_state_t *)_strategy->state;
@@ -137,7 +243,8 @@ aeron_flow_control_strategy_supplier_func_table_entry_t aeron_flow_control_strat
 {
     { AERON_UNICAST_MAX_FLOW_CONTROL_STRATEGY_NAME, aeron_unicast_flow_control_strategy_supplier },
     { AERON_MULTICAST_MAX_FLOW_CONTROL_STRATEGY_NAME, aeron_max_multicast_flow_control_strategy_supplier },
-    { AERON_MULTICAST_MIN_FLOW_CONTROL_STRATEGY_NAME, aeron_min_flow_control_strategy_supplier }
+    { AERON_MULTICAST_MIN_FLOW_CONTROL_STRATEGY_NAME, aeron_min_flow_control_strategy_supplier },
+    { AERON_MULTICAST_TAGGED_FLOW_CONTROL_STRATEGY_NAME, aeron_tagged_flow_control_strategy_supplier }
 };
 
 aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier_by_name(const char *name)
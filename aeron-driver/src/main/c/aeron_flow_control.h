@@ -40,19 +40,59 @@ typedef int64_t (*aeron_flow_control_strategy_on_sm_func_t)(
     size_t position_bits_to_shift,
     int64_t now_ns);
 
+typedef bool (*aeron_flow_control_strategy_has_required_receivers_func_t)(aeron_flow_control_strategy_t *strategy);
+
 typedef int (*aeron_flow_control_strategy_fini_func_t)(aeron_flow_control_strategy_t *strategy);
 
 typedef struct aeron_flow_control_strategy_stct
 {
     aeron_flow_control_strategy_on_sm_func_t on_status_message;
     aeron_flow_control_strategy_on_idle_func_t on_idle;
+    aeron_flow_control_strategy_has_required_receivers_func_t has_required_receivers;
     aeron_flow_control_strategy_fini_func_t fini;
     void *state;
 }
 aeron_flow_control_strategy_t;
 
+#define AERON_FLOW_CONTROL_URI_MAX_VALUE "max"
+#define AERON_FLOW_CONTROL_URI_MIN_VALUE "min"
+#define AERON_FLOW_CONTROL_URI_TAGGED_VALUE "tagged"
+#define AERON_FLOW_CONTROL_URI_GROUP_PREFIX "g:"
+
+#define AERON_FLOW_CONTROL_GROUP_TAG_DEFAULT (-1)
+#define AERON_FLOW_CONTROL_GROUP_MIN_SIZE_DEFAULT (0)
+
 aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier_load(const char *strategy_name);
 
+/**
+ * Find the built in supplier for the value of the fc URI param, e.g. "max", "min,g:/3" or "tagged,g:101/3".
+ *
+ * @param fc_value of the fc param.
+ * @return supplier or NULL if the strategy is not known.
+ */
+aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier_from_uri_value(const char *fc_value);
+
+/**
+ * Parse the group tag and group min size from the g:tag/size option of an fc URI param value. Either part of the
+ * option may be omitted in which case the given defaults are left unchanged.
+ *
+ * @param fc_value of the fc param, may be NULL.
+ * @param group_tag to be set if present.
+ * @param group_min_size to be set if present.
+ * @return 0 on success or -1 if the option could not be parsed.
+ */
+int aeron_flow_control_parse_group_option(const char *fc_value, int64_t *group_tag, int32_t *group_min_size);
+
+/**
+ * Group tag carried after the status message header by receivers which have one configured.
+ *
+ * @param sm status message.
+ * @param length of the status message.
+ * @param group_tag set if the status message carries a group tag.
+ * @return true if the status message carries a group tag.
+ */
+bool aeron_flow_control_status_message_group_tag(const uint8_t *sm, size_t length, int64_t *group_tag);
+
 int aeron_max_multicast_flow_control_strategy_supplier(
     aeron_flow_control_strategy_t **strategy,
     size_t channel_length,
@@ -80,6 +120,15 @@ int aeron_min_flow_control_strategy_supplier(
     int32_t initial_term_id,
     size_t term_buffer_capacity);
 
+int aeron_tagged_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity);
+
 typedef struct aeron_flow_control_strategy_supplier_func_table_entry_stct
 {
     const char *name;
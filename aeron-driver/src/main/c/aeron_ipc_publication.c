@@ -71,15 +71,15 @@ int aeron_ipc_publication_create(
         return -1;
     }
 
-    if (context->map_raw_log_func(
-        &_pub->mapped_raw_log, path, params->is_sparse, params->term_length, context->file_page_size) < 0)
+    if (aeron_raw_log_pool_acquire(
+        context->raw_log_pool, &_pub->mapped_raw_log, path, params->is_sparse, params->term_length) < 0)
     {
         aeron_free(_pub->log_file_name);
         aeron_free(_pub);
         aeron_set_err(aeron_errcode(), "error mapping IPC raw log %s: %s", path, aeron_errmsg());
         return -1;
     }
-    _pub->map_raw_log_close_func = context->map_raw_log_close_func;
+    _pub->raw_log_pool = context->raw_log_pool;
 
     strncpy(_pub->log_file_name, path, (size_t)path_length);
     _pub->log_file_name[path_length] = '\0';
@@ -185,7 +185,7 @@ void aeron_ipc_publication_close(aeron_counters_manager_t *counters_manager, aer
 
     if (NULL != publication)
     {
-        publication->map_raw_log_close_func(&publication->mapped_raw_log, publication->log_file_name);
+        aeron_raw_log_pool_release(publication->raw_log_pool, &publication->mapped_raw_log, publication->log_file_name);
         aeron_free(publication->log_file_name);
     }
 
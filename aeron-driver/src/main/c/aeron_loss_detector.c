@@ -28,18 +28,40 @@ int aeron_loss_detector_init(
     aeron_loss_detector_t *detector,
     aeron_feedback_delay_generator_state_t *feedback_delay_state,
     aeron_term_gap_scanner_on_gap_detected_func_t on_gap_detected,
-    void *on_gap_detected_clientd)
+    void *on_gap_detected_clientd,
+    size_t max_gaps)
 {
     detector->on_gap_detected = on_gap_detected;
     detector->on_gap_detected_clientd = on_gap_detected_clientd;
     detector->expiry_ns = AERON_LOSS_DETECTOR_TIMER_INACTIVE;
-    detector->active_gap.term_offset = -1;
-    detector->scanned_gap.term_offset = -1;
+    detector->max_gaps = max_gaps < 1 ? 1 : (max_gaps > AERON_LOSS_DETECTOR_MAX_GAPS ?
+        AERON_LOSS_DETECTOR_MAX_GAPS : max_gaps);
+    detector->scanned_gap_count = 0;
+    detector->active_gap_count = 0;
+    detector->active_gaps[0].term_offset = -1;
+    detector->scanned_gaps[0].term_offset = -1;
     detector->feedback_delay_state = feedback_delay_state;
 
     return 0;
 }
 
+static void aeron_loss_detector_scan_following_gaps(
+    aeron_loss_detector_t *detector, const uint8_t *buffer, int32_t term_id, int32_t limit_offset)
+{
+    while (detector->scanned_gap_count < detector->max_gaps)
+    {
+        const aeron_loss_detector_gap_t *last_gap = &detector->scanned_gaps[detector->scanned_gap_count - 1];
+        const int32_t offset = last_gap->term_offset + (int32_t)last_gap->length;
+
+        if (offset >= limit_offset ||
+            aeron_term_gap_scanner_scan_for_gap(
+                buffer, term_id, offset, limit_offset, aeron_loss_detector_on_gap, detector) >= limit_offset)
+        {
+            break;
+        }
+    }
+}
+
 int32_t aeron_loss_detector_scan(
     aeron_loss_detector_t *detector,
     bool *loss_found,
@@ -52,6 +74,7 @@ int32_t aeron_loss_detector_scan(
     int32_t initial_term_id)
 {
     *loss_found = false;
+    detector->scanned_gap_count = 0;
     int32_t rebuild_offset = (int32_t)(rebuild_position & term_length_mask);
 
     if (rebuild_position < hwm_position)
@@ -74,12 +97,16 @@ int32_t aeron_loss_detector_scan(
 
         if (rebuild_offset < limit_offset)
         {
+            aeron_loss_detector_scan_following_gaps(detector, buffer, rebuild_term_id, limit_offset);
+
             if (!aeron_loss_detector_gaps_match(detector))
             {
                 aeron_loss_detector_activate_gap(detector, now_ns);
                 *loss_found = true;
             }
 
+            aeron_loss_detector_update_following_gaps(detector);
+
             aeron_loss_detector_check_timer_expiry(detector, now_ns);
         }
     }
@@ -127,4 +154,5 @@ extern int64_t aeron_loss_detector_nak_unicast_delay_generator();
 extern void aeron_loss_detector_on_gap(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 extern bool aeron_loss_detector_gaps_match(aeron_loss_detector_t *detector);
 extern void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, int64_t now_ns);
+extern void aeron_loss_detector_update_following_gaps(aeron_loss_detector_t *detector);
 extern void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns);
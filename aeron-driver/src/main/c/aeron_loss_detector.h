@@ -33,14 +33,18 @@ typedef struct aeron_loss_detector_gap_stct
 aeron_loss_detector_gap_t;
 
 #define AERON_LOSS_DETECTOR_TIMER_INACTIVE (-1)
+#define AERON_LOSS_DETECTOR_MAX_GAPS (64)
 
 typedef struct aeron_loss_detector_stct
 {
     aeron_term_gap_scanner_on_gap_detected_func_t on_gap_detected;
     aeron_feedback_delay_generator_state_t *feedback_delay_state;
     void *on_gap_detected_clientd;
-    aeron_loss_detector_gap_t scanned_gap;
-    aeron_loss_detector_gap_t active_gap;
+    size_t max_gaps;
+    size_t scanned_gap_count;
+    size_t active_gap_count;
+    aeron_loss_detector_gap_t scanned_gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+    aeron_loss_detector_gap_t active_gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
     int64_t expiry_ns;
 }
 aeron_loss_detector_t;
@@ -49,7 +53,8 @@ int aeron_loss_detector_init(
     aeron_loss_detector_t *detector,
     aeron_feedback_delay_generator_state_t *feedback_delay_state,
     aeron_term_gap_scanner_on_gap_detected_func_t on_gap_detected,
-    void *on_gap_detected_clientd);
+    void *on_gap_detected_clientd,
+    size_t max_gaps);
 
 int32_t aeron_loss_detector_scan(
     aeron_loss_detector_t *detector,
@@ -85,22 +90,25 @@ inline void aeron_loss_detector_on_gap(void *clientd, int32_t term_id, int32_t t
 {
     aeron_loss_detector_t *detector = (aeron_loss_detector_t *)clientd;
 
-    detector->scanned_gap.term_id = term_id;
-    detector->scanned_gap.term_offset = term_offset;
-    detector->scanned_gap.length = length;
+    if (detector->scanned_gap_count < detector->max_gaps)
+    {
+        aeron_loss_detector_gap_t *gap = &detector->scanned_gaps[detector->scanned_gap_count++];
+
+        gap->term_id = term_id;
+        gap->term_offset = term_offset;
+        gap->length = length;
+    }
 }
 
 inline bool aeron_loss_detector_gaps_match(aeron_loss_detector_t *detector)
 {
-    return detector->active_gap.term_id == detector->scanned_gap.term_id &&
-        detector->active_gap.term_offset == detector->scanned_gap.term_offset;
+    return detector->active_gaps[0].term_id == detector->scanned_gaps[0].term_id &&
+        detector->active_gaps[0].term_offset == detector->scanned_gaps[0].term_offset;
 }
 
 inline void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, int64_t now_ns)
 {
-    detector->active_gap.term_id = detector->scanned_gap.term_id;
-    detector->active_gap.term_offset = detector->scanned_gap.term_offset;
-    detector->active_gap.length = detector->scanned_gap.length;
+    detector->active_gaps[0] = detector->scanned_gaps[0];
 
     if (detector->feedback_delay_state->should_immediate_feedback)
     {
@@ -112,15 +120,33 @@ inline void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, in
     }
 }
 
+/*
+ * Gaps after the first are taken from every scan so those found while waiting for the timer join the next NAK.
+ * The first gap is only replaced on activation, which also restarts the timer.
+ */
+inline void aeron_loss_detector_update_following_gaps(aeron_loss_detector_t *detector)
+{
+    for (size_t i = 1; i < detector->scanned_gap_count; i++)
+    {
+        detector->active_gaps[i] = detector->scanned_gaps[i];
+    }
+
+    detector->active_gap_count = detector->scanned_gap_count;
+}
+
 inline void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns)
 {
     if (now_ns >= detector->expiry_ns)
     {
-        detector->on_gap_detected(
-            detector->on_gap_detected_clientd,
-            detector->active_gap.term_id,
-            detector->active_gap.term_offset,
-            detector->active_gap.length);
+        for (size_t i = 0; i < detector->active_gap_count; i++)
+        {
+            detector->on_gap_detected(
+                detector->on_gap_detected_clientd,
+                detector->active_gaps[i].term_id,
+                detector->active_gaps[i].term_offset,
+                detector->active_gaps[i].length);
+        }
+
         detector->expiry_ns = now_ns + detector->feedback_delay_state->delay_generator(detector->feedback_delay_state);
     }
 }
@@ -27,7 +27,9 @@
 #include "util/aeron_error.h"
 #include "util/aeron_arrayutil.h"
 #include "util/aeron_parse_util.h"
+#include "uri/aeron_uri.h"
 #include "aeron_flow_control.h"
+#include "aeron_driver_context.h"
 #include "aeron_alloc.h"
 #include <aeronmd.h>
 
@@ -52,6 +54,9 @@ typedef struct aeron_min_flow_control_strategy_state_stct
     receivers;
 
     int64_t receiver_timeout_ns;
+    int64_t group_tag;
+    int32_t group_min_size;
+    bool is_tagged;
 }
 aeron_min_flow_control_strategy_state_t;
 
@@ -89,7 +94,8 @@ int64_t aeron_min_flow_control_strategy_on_idle(
         }
     }
 
-    return strategy_state->receivers.length > 0 ? min_limit_position : snd_lmt;
+    return strategy_state->receivers.length > 0 &&
+        strategy_state->receivers.length >= (size_t)strategy_state->group_min_size ? min_limit_position : snd_lmt;
 }
 
 int64_t aeron_min_flow_control_strategy_on_sm(
@@ -115,6 +121,17 @@ int64_t aeron_min_flow_control_strategy_on_sm(
     bool is_existing = false;
     int64_t min_position = INT64_MAX;
 
+    if (strategy_state->is_tagged)
+    {
+        int64_t group_tag;
+
+        if (!aeron_flow_control_status_message_group_tag(sm, length, &group_tag) ||
+            group_tag != strategy_state->group_tag)
+        {
+            return snd_lmt;
+        }
+    }
+
     for (size_t i = 0; i < strategy_state->receivers.length; i++)
     {
         aeron_min_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[i];
@@ -156,9 +173,26 @@ int64_t aeron_min_flow_control_strategy_on_sm(
         }
     }
 
+    if (strategy_state->receivers.length < (size_t)strategy_state->group_min_size)
+    {
+        return snd_lmt;
+    }
+
     return snd_lmt > min_position ? snd_lmt : min_position;
 }
 
+bool aeron_min_flow_control_strategy_has_required_receivers(aeron_flow_control_strategy_t *strategy)
+{
+    aeron_min_flow_control_strategy_state_t *strategy_state =
+        (aeron_min_flow_control_strategy_state_t *)strategy->state;
+
+    /* a tagged group needs at least one tagged receiver so untagged receivers alone never connect it */
+    const size_t required_receivers = strategy_state->is_tagged && 0 == strategy_state->group_min_size ?
+        1 : (size_t)strategy_state->group_min_size;
+
+    return strategy_state->receivers.length >= required_receivers;
+}
+
 int aeron_min_flow_control_strategy_fini(aeron_flow_control_strategy_t *strategy)
 {
     aeron_min_flow_control_strategy_state_t *strategy_state =
@@ -174,6 +208,8 @@ int aeron_min_flow_control_strategy_fini(aeron_flow_control_strategy_t *strategy
 static AERON_INIT_ONCE timeout_is_initialized = AERON_INIT_ONCE_VALUE;
 
 static int64_t aeron_min_flow_control_strategy_timeout_ns;
+static int64_t aeron_flow_control_group_tag;
+static int32_t aeron_flow_control_group_min_size;
 
 static void initialize_aeron_min_flow_control_strategy_timeout()
 {
@@ -186,18 +222,48 @@ static void initialize_aeron_min_flow_control_strategy_timeout()
     }
 
     aeron_min_flow_control_strategy_timeout_ns = (int64_t)timeout_ns;
+
+    aeron_flow_control_group_tag = aeron_config_parse_int64(
+        AERON_FLOW_CONTROL_GROUP_TAG_ENV_VAR,
+        getenv(AERON_FLOW_CONTROL_GROUP_TAG_ENV_VAR),
+        AERON_FLOW_CONTROL_GROUP_TAG_DEFAULT,
+        INT64_MIN,
+        INT64_MAX);
+
+    aeron_flow_control_group_min_size = (int32_t)aeron_config_parse_int64(
+        AERON_FLOW_CONTROL_GROUP_MIN_SIZE_ENV_VAR,
+        getenv(AERON_FLOW_CONTROL_GROUP_MIN_SIZE_ENV_VAR),
+        AERON_FLOW_CONTROL_GROUP_MIN_SIZE_DEFAULT,
+        0,
+        INT32_MAX);
 }
 
-int aeron_min_flow_control_strategy_supplier(
-    aeron_flow_control_strategy_t **strategy,
-    size_t channel_length,
-    const char *channel,
-    int32_t stream_id,
-    int64_t registration_id,
-    int32_t initial_term_id,
-    size_t term_buffer_capacity)
+static int aeron_min_flow_control_strategy_allocate(
+    aeron_flow_control_strategy_t **strategy, size_t channel_length, const char *channel, bool is_tagged)
 {
     aeron_flow_control_strategy_t *_strategy;
+    aeron_uri_t uri;
+
+    (void)aeron_thread_once(&timeout_is_initialized, initialize_aeron_min_flow_control_strategy_timeout);
+
+    int64_t group_tag = aeron_flow_control_group_tag;
+    int32_t group_min_size = aeron_flow_control_group_min_size;
+
+    if (aeron_uri_parse(channel_length, channel, &uri) < 0)
+    {
+        return -1;
+    }
+
+    const char *fc_value = AERON_URI_UDP == uri.type ?
+        aeron_uri_find_param_value(&uri.params.udp.additional_params, AERON_URI_FC_KEY) : NULL;
+    int parse_result = aeron_flow_control_parse_group_option(fc_value, &group_tag, &group_min_size);
+
+    aeron_uri_close(&uri);
+
+    if (parse_result < 0)
+    {
+        return -1;
+    }
 
     if (aeron_alloc((void **)&_strategy, sizeof(aeron_flow_control_strategy_t)) < 0 ||
         aeron_alloc((void **)&_strategy->state, sizeof(aeron_min_flow_control_strategy_state_t)) < 0)
@@ -207,10 +273,9 @@ int aeron_min_flow_control_strategy_supplier(
 
     _strategy->on_idle = aeron_min_flow_control_strategy_on_idle;
     _strategy->on_status_message = aeron_min_flow_control_strategy_on_sm;
+    _strategy->has_required_receivers = aeron_min_flow_control_strategy_has_required_receivers;
     _strategy->fini = aeron_min_flow_control_strategy_fini;
 
-    (void)aeron_thread_once(&timeout_is_initialized, initialize_aeron_min_flow_control_strategy_timeout);
-
     aeron_min_flow_control_strategy_state_t *state = (aeron_min_flow_control_strategy_state_t *)_strategy->state;
 
     state->receivers.array = NULL;
@@ -218,8 +283,35 @@ int aeron_min_flow_control_strategy_supplier(
     state->receivers.length = 0;
 
     state->receiver_timeout_ns = aeron_min_flow_control_strategy_timeout_ns;
+    state->group_tag = group_tag;
+    state->group_min_size = group_min_size;
+    state->is_tagged = is_tagged;
 
     *strategy = _strategy;
 
     return 0;
 }
+
+int aeron_min_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity)
+{
+    return aeron_min_flow_control_strategy_allocate(strategy, channel_length, channel, false);
+}
+
+int aeron_tagged_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity)
+{
+    return aeron_min_flow_control_strategy_allocate(strategy, channel_length, channel, true);
+}
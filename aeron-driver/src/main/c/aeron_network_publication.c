@@ -31,6 +31,7 @@
 #include "media/aeron_send_channel_endpoint.h"
 #include "aeron_driver_conductor.h"
 #include "concurrent/aeron_logbuffer_unblocker.h"
+#include "util/aeron_affinity.h"
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -98,27 +99,54 @@ int aeron_network_publication_create(
         return -1;
     }
 
+    const size_t resend_batch_capacity = AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND;
+    if (aeron_alloc((void **)&_pub->resend_iov, resend_batch_capacity * sizeof(struct iovec)) < 0 ||
+        aeron_alloc((void **)&_pub->resend_mmsghdr, resend_batch_capacity * sizeof(struct mmsghdr)) < 0)
+    {
+        aeron_free(_pub->resend_iov);
+        aeron_free(_pub->log_file_name);
+        aeron_free(_pub);
+        aeron_set_err(ENOMEM, "%s", "Could not allocate network publication resend batch");
+        return -1;
+    }
+
     if (aeron_retransmit_handler_init(
         &_pub->retransmit_handler,
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS),
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMIT_OVERFLOW),
         context->retransmit_unicast_delay_ns,
-        context->retransmit_unicast_linger_ns) < 0)
+        context->retransmit_unicast_linger_ns,
+        context->max_resend) < 0)
     {
+        aeron_free(_pub->resend_mmsghdr);
+        aeron_free(_pub->resend_iov);
         aeron_free(_pub->log_file_name);
         aeron_free(_pub);
         aeron_set_err(aeron_errcode(), "Could not init network publication retransmit handler: %s", aeron_errmsg());
         return -1;
     }
 
-    if (context->map_raw_log_func(
-        &_pub->mapped_raw_log, path, params->is_sparse, params->term_length, context->file_page_size) < 0)
+    if (aeron_raw_log_pool_acquire(
+        context->raw_log_pool, &_pub->mapped_raw_log, path, params->is_sparse, params->term_length) < 0)
     {
+        aeron_retransmit_handler_close(&_pub->retransmit_handler);
+        aeron_free(_pub->resend_mmsghdr);
+        aeron_free(_pub->resend_iov);
         aeron_free(_pub->log_file_name);
         aeron_free(_pub);
         aeron_set_err(aeron_errcode(), "error mapping network raw log %s: %s", path, aeron_errmsg());
         return -1;
     }
-    _pub->map_raw_log_close_func = context->map_raw_log_close_func;
+    _pub->raw_log_pool = context->raw_log_pool;
+
+    /* best effort, keeps the term buffers the sender scans on its node */
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        aeron_numa_bind_preferred(
+            _pub->mapped_raw_log.term_buffers[i].addr,
+            _pub->mapped_raw_log.term_buffers[i].length,
+            aeron_driver_context_sender_agent_numa_node(context));
+    }
 
     strncpy(_pub->log_file_name, path, (size_t)path_length);
     _pub->log_file_name[path_length] = '\0';
@@ -168,6 +196,7 @@ int aeron_network_publication_create(
     _pub->endpoint = endpoint;
     _pub->flow_control = flow_control_strategy;
     _pub->nano_clock = context->nano_clock;
+    _pub->cached_clock = &context->sender_cached_clock;
     _pub->conductor_fields.subscribable.array = NULL;
     _pub->conductor_fields.subscribable.length = 0;
     _pub->conductor_fields.subscribable.capacity = 0;
@@ -200,6 +229,7 @@ int aeron_network_publication_create(
     _pub->term_length_mask = (int32_t)params->term_length - 1;
     _pub->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)params->term_length);
     _pub->mtu_length = params->mtu_length;
+    _pub->max_messages_per_send = params->max_messages_per_send;
     _pub->term_window_length = (int64_t)aeron_producer_window_length(
         context->publication_window_length, params->term_length);
     _pub->linger_timeout_ns = (int64_t)params->linger_timeout_ns;
@@ -219,6 +249,7 @@ int aeron_network_publication_create(
     _pub->is_end_of_stream = false;
     _pub->track_sender_limits = false;
     _pub->has_sender_released = false;
+    _pub->resend_vlen = 0;
 
     _pub->short_sends_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS);
     _pub->heartbeats_sent_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_HEARTBEATS_SENT);
@@ -227,6 +258,11 @@ int aeron_network_publication_create(
     _pub->retransmits_sent_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMITS_SENT);
     _pub->unblocked_publications_counter = aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_UNBLOCKED_PUBLICATIONS);
+    _pub->send_batches_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SEND_BATCHES);
+    _pub->send_batch_messages_counter = aeron_system_counter_addr(
+        system_counters, AERON_SYSTEM_COUNTER_SEND_BATCH_MESSAGES);
+    _pub->send_batches_at_limit_counter = aeron_system_counter_addr(
+        system_counters, AERON_SYSTEM_COUNTER_SEND_BATCHES_AT_LIMIT);
 
     _pub->conductor_fields.last_snd_pos = aeron_counter_get(_pub->snd_pos_position.value_addr);
     _pub->conductor_fields.clean_position = _pub->conductor_fields.last_snd_pos;
@@ -258,7 +294,9 @@ void aeron_network_publication_close(
         publication->conductor_fields.managed_resource.clientd = NULL;
 
         aeron_retransmit_handler_close(&publication->retransmit_handler);
-        publication->map_raw_log_close_func(&publication->mapped_raw_log, publication->log_file_name);
+        aeron_free(publication->resend_mmsghdr);
+        aeron_free(publication->resend_iov);
+        aeron_raw_log_pool_release(publication->raw_log_pool, &publication->mapped_raw_log, publication->log_file_name);
         publication->flow_control->fini(publication->flow_control);
         aeron_free(publication->log_file_name);
     }
@@ -383,8 +421,17 @@ int aeron_network_publication_send_data(
     int64_t highest_pos = snd_pos;
     struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
     struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    size_t segments[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    size_t segment_lengths[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    uint64_t control[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND]
+        [AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH / sizeof(uint64_t)];
 
-    for (size_t i = 0; i < AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND && available_window > 0; i++)
+    const size_t max_messages_per_send = publication->max_messages_per_send;
+    const bool gso_enabled = publication->endpoint->transport.gso_enabled;
+    bool can_coalesce = false;
+    size_t messages = 0;
+
+    for (; messages < max_messages_per_send && available_window > 0; messages++)
     {
         size_t scan_limit = (size_t)available_window < publication->mtu_length ?
             (size_t)available_window : publication->mtu_length;
@@ -397,15 +444,38 @@ int aeron_network_publication_send_data(
 
         if (available > 0)
         {
-            iov[i].iov_base = ptr;
-            iov[i].iov_len = available;
-            mmsghdr[i].msg_hdr.msg_iov = &iov[i];
-            mmsghdr[i].msg_hdr.msg_iovlen = 1;
-            mmsghdr[i].msg_hdr.msg_flags = 0;
-            mmsghdr[i].msg_len = 0;
-            mmsghdr[i].msg_hdr.msg_control = NULL;
-            mmsghdr[i].msg_hdr.msg_controllen = 0;
-            vlen++;
+            const int last = vlen - 1;
+
+            /*
+             * With GSO a run of contiguous equally sized chunks goes out as one buffer which is split on the
+             * segment length, a shorter chunk may only be the final segment of the run.
+             */
+            if (can_coalesce &&
+                available <= segment_lengths[last] &&
+                iov[last].iov_len + available <= AERON_MAX_UDP_PAYLOAD_LENGTH &&
+                segments[last] < AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_SEGMENTS)
+            {
+                iov[last].iov_len += available;
+                segments[last]++;
+                can_coalesce = available == segment_lengths[last];
+            }
+            else
+            {
+                iov[vlen].iov_base = ptr;
+                iov[vlen].iov_len = available;
+                mmsghdr[vlen].msg_hdr.msg_iov = &iov[vlen];
+                mmsghdr[vlen].msg_hdr.msg_iovlen = 1;
+                mmsghdr[vlen].msg_hdr.msg_flags = 0;
+                mmsghdr[vlen].msg_len = 0;
+                mmsghdr[vlen].msg_hdr.msg_control = NULL;
+                mmsghdr[vlen].msg_hdr.msg_controllen = 0;
+                segments[vlen] = 1;
+                segment_lengths[vlen] = available;
+                vlen++;
+                can_coalesce = gso_enabled;
+            }
+
+            can_coalesce = can_coalesce && 0 == padding;
 
             bytes_sent += available;
             available_window -= available + padding;
@@ -415,10 +485,20 @@ int aeron_network_publication_send_data(
 
         if (available == 0 || term_length == (size_t)term_offset)
         {
+            messages += available > 0 ? 1 : 0;
             break;
         }
     }
 
+    for (int i = 0; gso_enabled && i < vlen; i++)
+    {
+        if (segments[i] > 1)
+        {
+            aeron_udp_channel_transport_set_gso_segment_length(
+                &mmsghdr[i].msg_hdr, (uint8_t *)control[i], segment_lengths[i]);
+        }
+    }
+
     if (vlen > 0)
     {
         if ((result = aeron_send_channel_sendmmsg(publication->endpoint, mmsghdr, (size_t)vlen)) != vlen)
@@ -429,6 +509,13 @@ int aeron_network_publication_send_data(
             }
         }
 
+        aeron_counter_ordered_increment(publication->send_batches_counter, 1);
+        aeron_counter_ordered_increment(publication->send_batch_messages_counter, (int64_t)messages);
+        if (messages == max_messages_per_send)
+        {
+            aeron_counter_ordered_increment(publication->send_batches_at_limit_counter, 1);
+        }
+
         publication->time_of_last_send_or_heartbeat_ns = now_ns;
         publication->track_sender_limits = true;
         aeron_counter_set_ordered(publication->snd_pos_position.value_addr, highest_pos);
@@ -504,10 +591,30 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
 
     aeron_retransmit_handler_process_timeouts(
         &publication->retransmit_handler, now_ns, aeron_network_publication_resend, publication);
+    aeron_network_publication_resend_flush(publication);
 
     return bytes_sent;
 }
 
+int aeron_network_publication_resend_flush(aeron_network_publication_t *publication)
+{
+    int result = 0;
+    const int vlen = (int)publication->resend_vlen;
+
+    if (vlen > 0)
+    {
+        result = aeron_send_channel_sendmmsg(publication->endpoint, publication->resend_mmsghdr, (size_t)vlen);
+        if (result >= 0 && result != vlen)
+        {
+            aeron_counter_increment(publication->short_sends_counter, 1);
+        }
+
+        publication->resend_vlen = 0;
+    }
+
+    return result < 0 ? result : 0;
+}
+
 int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
 {
     aeron_network_publication_t *publication = (aeron_network_publication_t *)clientd;
@@ -541,32 +648,26 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
                 break;
             }
 
-            struct iovec iov[1];
-            struct msghdr msghdr;
-
-            iov[0].iov_base = ptr;
-            iov[0].iov_len = available;
-            msghdr.msg_iov = iov;
-            msghdr.msg_iovlen = 1;
-            msghdr.msg_control = NULL;
-            msghdr.msg_controllen = 0;
-            msghdr.msg_flags = 0;
-
-            int sendmsg_result;
-            if ((sendmsg_result = aeron_send_channel_sendmsg(publication->endpoint, &msghdr)) != (int)iov[0].iov_len)
+            if (AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND == publication->resend_vlen &&
+                aeron_network_publication_resend_flush(publication) < 0)
             {
-                if (sendmsg_result >= 0)
-                {
-                    aeron_counter_increment(publication->short_sends_counter, 1);
-                    break;
-                }
-                else
-                {
-                    result = -1;
-                    break;
-                }
+                result = -1;
+                break;
             }
 
+            const size_t i = publication->resend_vlen++;
+            struct iovec *iov = &publication->resend_iov[i];
+            struct mmsghdr *mmsghdr = &publication->resend_mmsghdr[i];
+
+            iov->iov_base = ptr;
+            iov->iov_len = available;
+            mmsghdr->msg_hdr.msg_iov = iov;
+            mmsghdr->msg_hdr.msg_iovlen = 1;
+            mmsghdr->msg_hdr.msg_flags = 0;
+            mmsghdr->msg_hdr.msg_control = NULL;
+            mmsghdr->msg_hdr.msg_controllen = 0;
+            mmsghdr->msg_len = 0;
+
             bytes_sent = (int32_t)(available + padding);
             remaining_bytes -= bytes_sent;
         }
@@ -587,9 +688,27 @@ void aeron_network_publication_on_nak(
         term_offset,
         (size_t)length,
         (size_t)(publication->term_length_mask + 1L),
-        publication->nano_clock(),
+        aeron_clock_cached_nano_time(publication->cached_clock),
+        aeron_network_publication_resend,
+        publication);
+
+    aeron_network_publication_resend_flush(publication);
+}
+
+void aeron_network_publication_on_nak_list(
+    aeron_network_publication_t *publication, int32_t term_id, const aeron_nak_range_t *ranges, size_t range_count)
+{
+    aeron_retransmit_handler_on_nak_list(
+        &publication->retransmit_handler,
+        term_id,
+        ranges,
+        range_count,
+        (size_t)(publication->term_length_mask + 1L),
+        aeron_clock_cached_nano_time(publication->cached_clock),
         aeron_network_publication_resend,
         publication);
+
+    aeron_network_publication_resend_flush(publication);
 }
 
 inline static void update_connected_status(aeron_network_publication_t *publication, bool expected_status)
@@ -607,16 +726,7 @@ inline static void update_connected_status(aeron_network_publication_t *publicat
 void aeron_network_publication_on_status_message(
     aeron_network_publication_t *publication, const uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
 {
-    const int64_t time_ns = publication->nano_clock();
-
-    publication->status_message_deadline_ns = time_ns + publication->connection_timeout_ns;
-
-    if (!publication->has_receivers)
-    {
-        AERON_PUT_ORDERED(publication->has_receivers, true);
-    }
-
-    update_connected_status(publication, true);
+    const int64_t time_ns = aeron_clock_cached_nano_time(publication->cached_clock);
 
     aeron_counter_set_ordered(
         publication->snd_lmt_position.value_addr,
@@ -629,6 +739,20 @@ void aeron_network_publication_on_status_message(
             publication->initial_term_id,
             publication->position_bits_to_shift,
             time_ns));
+
+    /* strategies from other suppliers may leave has_required_receivers NULL and so have no required group */
+    if (NULL == publication->flow_control->has_required_receivers ||
+        publication->flow_control->has_required_receivers(publication->flow_control))
+    {
+        publication->status_message_deadline_ns = time_ns + publication->connection_timeout_ns;
+
+        if (!publication->has_receivers)
+        {
+            AERON_PUT_ORDERED(publication->has_receivers, true);
+        }
+
+        update_connected_status(publication, true);
+    }
 }
 
 void aeron_network_publication_on_rttm(
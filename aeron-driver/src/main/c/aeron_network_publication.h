@@ -38,8 +38,6 @@ aeron_network_publication_status_t;
 #define AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS (100 * 1000 * 1000L)
 #define AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS (100 * 1000 * 1000L)
 
-#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND (2)
-
 typedef struct aeron_send_channel_endpoint_stct aeron_send_channel_endpoint_t;
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 
@@ -72,6 +70,7 @@ typedef struct aeron_network_publication_stct
     aeron_send_channel_endpoint_t *endpoint;
     aeron_flow_control_strategy_t *flow_control;
     aeron_clock_func_t nano_clock;
+    aeron_clock_cache_t *cached_clock;
 
     char *log_file_name;
     int64_t term_window_length;
@@ -89,6 +88,7 @@ typedef struct aeron_network_publication_stct
     size_t log_file_name_length;
     size_t position_bits_to_shift;
     size_t mtu_length;
+    size_t max_messages_per_send;
     bool is_exclusive;
     bool spies_simulate_connection;
     bool signal_eos;
@@ -99,13 +99,21 @@ typedef struct aeron_network_publication_stct
     bool is_end_of_stream;
     bool track_sender_limits;
     bool has_sender_released;
-    aeron_map_raw_log_close_func_t map_raw_log_close_func;
+    aeron_raw_log_pool_t *raw_log_pool;
+
+    /* retransmits gathered on the sender thread while handling NAKs and timeouts, sent with one sendmmsg */
+    size_t resend_vlen;
+    struct iovec *resend_iov;
+    struct mmsghdr *resend_mmsghdr;
 
     int64_t *short_sends_counter;
     int64_t *heartbeats_sent_counter;
     int64_t *sender_flow_control_limits_counter;
     int64_t *retransmits_sent_counter;
     int64_t *unblocked_publications_counter;
+    int64_t *send_batches_counter;
+    int64_t *send_batch_messages_counter;
+    int64_t *send_batches_at_limit_counter;
 }
 aeron_network_publication_t;
 
@@ -144,9 +152,14 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
 int aeron_network_publication_send_data(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset);
 
+int aeron_network_publication_resend_flush(aeron_network_publication_t *publication);
+
 void aeron_network_publication_on_nak(
     aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length);
 
+void aeron_network_publication_on_nak_list(
+    aeron_network_publication_t *publication, int32_t term_id, const aeron_nak_range_t *ranges, size_t range_count);
+
 void aeron_network_publication_on_status_message(
     aeron_network_publication_t *publication, const uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
@@ -315,3 +315,24 @@ int32_t aeron_counter_sender_bpe_allocate(
         channel,
         "");
 }
+
+int32_t aeron_counter_per_image_indicator_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    return aeron_stream_counter_allocate(
+        counters_manager,
+        name,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+}
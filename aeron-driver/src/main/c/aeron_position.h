@@ -159,4 +159,15 @@ int32_t aeron_counter_sender_bpe_allocate(
     size_t channel_length,
     const char *channel);
 
+#define AERON_COUNTER_PER_IMAGE_TYPE_ID (10)
+
+int32_t aeron_counter_per_image_indicator_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel);
+
 #endif
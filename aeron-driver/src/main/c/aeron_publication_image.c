@@ -15,6 +15,7 @@
  */
 
 #include <inttypes.h>
+#include <string.h>
 #include "util/aeron_netutil.h"
 #include "concurrent/aeron_term_rebuilder.h"
 #include "util/aeron_error.h"
@@ -22,6 +23,7 @@
 #include "aeron_driver_receiver_proxy.h"
 #include "aeron_driver_conductor.h"
 #include "concurrent/aeron_term_gap_filler.h"
+#include "util/aeron_affinity.h"
 
 int aeron_publication_image_create(
     aeron_publication_image_t **image,
@@ -89,22 +91,33 @@ int aeron_publication_image_create(
     if (aeron_loss_detector_init(
         &_image->loss_detector,
         is_multicast ? &context->multicast_delay_feedback_generator : &context->unicast_delay_feedback_generator,
-        aeron_publication_image_on_gap_detected, _image) < 0)
+        aeron_publication_image_on_gap_detected,
+        _image,
+        context->nak_max_ranges) < 0)
     {
         aeron_free(_image);
         aeron_set_err(ENOMEM, "%s", "Could not init publication image loss detector");
         return -1;
     }
 
-    if (context->map_raw_log_func(
-        &_image->mapped_raw_log, path, is_sparse, (uint64_t)term_buffer_length, context->file_page_size) < 0)
+    if (aeron_raw_log_pool_acquire(
+        context->raw_log_pool, &_image->mapped_raw_log, path, is_sparse, (uint64_t)term_buffer_length) < 0)
     {
         aeron_free(_image->log_file_name);
         aeron_free(_image);
         aeron_set_err(aeron_errcode(), "error mapping network raw log %s: %s", path, aeron_errmsg());
         return -1;
     }
-    _image->map_raw_log_close_func = context->map_raw_log_close_func;
+    _image->raw_log_pool = context->raw_log_pool;
+
+    /* best effort, the receiver is the first to write the term buffers so they belong on its node */
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        aeron_numa_bind_preferred(
+            _image->mapped_raw_log.term_buffers[i].addr,
+            _image->mapped_raw_log.term_buffers[i].length,
+            aeron_driver_context_receiver_agent_numa_node(context));
+    }
 
     strncpy(_image->log_file_name, path, (size_t)path_length);
     _image->log_file_name[path_length] = '\0';
@@ -118,6 +131,17 @@ int aeron_publication_image_create(
     _image->log_meta_data->correlation_id = correlation_id;
     _image->log_meta_data->is_connected = 0;
     _image->log_meta_data->end_of_stream_position = INT64_MAX;
+
+    size_t active_index = aeron_logbuffer_index_by_term(initial_term_id, active_term_id);
+    _image->log_meta_data->term_tail_counters[active_index] =
+        (active_term_id * ((int64_t)1 << 32)) | initial_term_offset;
+    for (int i = 1; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        int64_t expected_term_id = (active_term_id + i) - AERON_LOGBUFFER_PARTITION_COUNT;
+        active_index = (active_index + 1) % AERON_LOGBUFFER_PARTITION_COUNT;
+        _image->log_meta_data->term_tail_counters[active_index] = expected_term_id * ((int64_t)1 << 32);
+    }
+
     aeron_logbuffer_fill_default_header(
         _image->mapped_raw_log.log_meta_data.addr, session_id, stream_id, initial_term_id);
 
@@ -125,7 +149,7 @@ int aeron_publication_image_create(
     _image->congestion_control = congestion_control;
     _image->loss_reporter = loss_reporter;
     _image->loss_reporter_offset = -1;
-    _image->nano_clock = context->nano_clock;
+    _image->cached_clock = &context->receiver_cached_clock;
     _image->epoch_clock = context->epoch_clock;
     _image->conductor_fields.subscribable.array = NULL;
     _image->conductor_fields.subscribable.length = 0;
@@ -177,8 +201,9 @@ int aeron_publication_image_create(
     _image->begin_loss_change = -1;
     _image->end_loss_change = -1;
     _image->loss_term_id = active_term_id;
-    _image->loss_term_offset = initial_term_offset;
-    _image->loss_length = 0;
+    _image->loss_range_count = 0;
+    _image->pending_loss_term_id = active_term_id;
+    _image->pending_loss_range_count = 0;
 
     _image->begin_sm_change = -1;
     _image->end_sm_change = -1;
@@ -188,9 +213,11 @@ int aeron_publication_image_create(
     _image->last_sm_position = initial_position;
     _image->last_sm_position_window_limit = initial_position + _image->next_sm_receiver_window_length;
     _image->last_packet_timestamp_ns = now_ns;
+    _image->rebuild_signal_hwm_position = initial_position;
     _image->last_status_message_timestamp = 0;
     _image->conductor_fields.clean_position = initial_position;
     _image->conductor_fields.time_of_last_status_change_ns = now_ns;
+    _image->conductor_fields.is_rebuild_pending = false;
 
     aeron_counter_set_ordered(_image->rcv_hwm_position.value_addr, initial_position);
     aeron_counter_set_ordered(_image->rcv_pos_position.value_addr, initial_position);
@@ -216,7 +243,7 @@ int aeron_publication_image_close(aeron_counters_manager_t *counters_manager, ae
 
         aeron_free(subscribable->array);
 
-        image->map_raw_log_close_func(&image->mapped_raw_log, image->log_file_name);
+        aeron_raw_log_pool_release(image->raw_log_pool, &image->mapped_raw_log, image->log_file_name);
         image->congestion_control->fini(image->congestion_control);
         aeron_free(image->log_file_name);
     }
@@ -253,15 +280,15 @@ void aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, i
 void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
 {
     aeron_publication_image_t *image = (aeron_publication_image_t *)clientd;
-    const int64_t change_number = image->begin_loss_change + 1;
 
-    AERON_PUT_ORDERED(image->begin_loss_change, change_number);
-
-    image->loss_term_id = term_id;
-    image->loss_term_offset = term_offset;
-    image->loss_length = length;
+    if (image->pending_loss_range_count < AERON_LOSS_DETECTOR_MAX_GAPS)
+    {
+        aeron_nak_range_t *range = &image->pending_loss_ranges[image->pending_loss_range_count++];
 
-    AERON_PUT_ORDERED(image->end_loss_change, change_number);
+        range->term_offset = term_offset;
+        range->length = (int32_t)length;
+        image->pending_loss_term_id = term_id;
+    }
 
     if (image->loss_reporter_offset >= 0)
     {
@@ -294,7 +321,22 @@ void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int
     }
 }
 
-void aeron_publication_image_track_rebuild(
+static void aeron_publication_image_publish_pending_loss(aeron_publication_image_t *image)
+{
+    const int64_t change_number = image->begin_loss_change + 1;
+
+    AERON_PUT_ORDERED(image->begin_loss_change, change_number);
+
+    image->loss_term_id = image->pending_loss_term_id;
+    image->loss_range_count = image->pending_loss_range_count;
+    memcpy(image->loss_ranges, image->pending_loss_ranges, image->pending_loss_range_count * sizeof(aeron_nak_range_t));
+
+    AERON_PUT_ORDERED(image->end_loss_change, change_number);
+
+    image->pending_loss_range_count = 0;
+}
+
+bool aeron_publication_image_track_rebuild(
     aeron_publication_image_t *image, int64_t now_ns, int64_t status_message_timeout)
 {
     int64_t hwm_position = aeron_counter_get_volatile(image->rcv_hwm_position.value_addr);
@@ -330,6 +372,11 @@ void aeron_publication_image_track_rebuild(
         image->position_bits_to_shift,
         image->initial_term_id);
 
+    if (image->pending_loss_range_count > 0)
+    {
+        aeron_publication_image_publish_pending_loss(image);
+    }
+
     const int32_t rebuild_term_offset = (int32_t)(rebuild_position & image->term_length_mask);
     const int64_t new_rebuild_position = (rebuild_position - rebuild_term_offset) + rebuild_offset;
 
@@ -356,6 +403,9 @@ void aeron_publication_image_track_rebuild(
         aeron_publication_image_clean_buffer_to(image, min_sub_pos - image->term_length);
         aeron_publication_image_schedule_status_message(image, now_ns, min_sub_pos, window_length);
     }
+
+    /* until subscribers have consumed all that has been received, their progress must keep being tracked */
+    return min_sub_pos < hwm_position || new_rebuild_position < hwm_position;
 }
 
 int aeron_publication_image_insert_packet(
@@ -385,9 +435,17 @@ int aeron_publication_image_insert_packet(
             uint8_t *term_buffer = image->mapped_raw_log.term_buffers[index].addr;
 
             aeron_term_rebuilder_insert(term_buffer + term_offset, buffer, length);
+
+            /* tail counters of an image track the highest received offset in each term for subscriber backlog */
+            int64_t *tail_counter = &image->log_meta_data->term_tail_counters[index];
+            const int64_t raw_tail = (term_id * ((int64_t)1 << 32)) | (term_offset + (int64_t)length);
+            if (raw_tail > *tail_counter)
+            {
+                AERON_PUT_ORDERED(*tail_counter, raw_tail);
+            }
         }
 
-        AERON_PUT_ORDERED(image->last_packet_timestamp_ns, image->nano_clock());
+        AERON_PUT_ORDERED(image->last_packet_timestamp_ns, aeron_clock_cached_nano_time(image->cached_clock));
         aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, proposed_position);
     }
 
@@ -397,7 +455,7 @@ int aeron_publication_image_insert_packet(
 int aeron_publication_image_on_rttm(
     aeron_publication_image_t *image, aeron_rttm_header_t *header, struct sockaddr_storage *addr)
 {
-    const int64_t now_ns = image->nano_clock();
+    const int64_t now_ns = aeron_clock_cached_nano_time(image->cached_clock);
     const int64_t rtt_in_ns = now_ns - header->echo_timestamp - header->reception_delta;
 
     image->congestion_control->on_rttm(image->congestion_control->state, now_ns, rtt_in_ns, addr);
@@ -461,9 +519,12 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
 
         if (change_number != image->last_loss_change_number)
         {
+            aeron_nak_range_t ranges[AERON_LOSS_DETECTOR_MAX_GAPS];
             const int32_t term_id = image->loss_term_id;
-            const int32_t term_offset = image->loss_term_offset;
-            const int32_t length = image->loss_length;
+            size_t range_count = image->loss_range_count;
+
+            range_count = range_count < AERON_LOSS_DETECTOR_MAX_GAPS ? range_count : AERON_LOSS_DETECTOR_MAX_GAPS;
+            memcpy(ranges, image->loss_ranges, range_count * sizeof(aeron_nak_range_t));
 
             aeron_acquire();
 
@@ -471,16 +532,35 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
             {
                 if (image->conductor_fields.is_reliable)
                 {
+                    /*
+                     * The first range always goes as a classic NAK so a sender that does not know NAK_LIST, and
+                     * drops it, still repairs something. The retransmit handler ignores the repeat of that range.
+                     */
                     int send_nak_result = aeron_receive_channel_endpoint_send_nak(
                         image->endpoint,
                         &image->control_address,
                         image->stream_id,
                         image->session_id,
                         term_id,
-                        term_offset,
-                        length);
+                        ranges[0].term_offset,
+                        ranges[0].length);
 
                     aeron_counter_ordered_increment(image->nak_messages_sent_counter, 1);
+
+                    if (send_nak_result >= 0 && range_count > 1)
+                    {
+                        send_nak_result = aeron_receive_channel_endpoint_send_nak_list(
+                            image->endpoint,
+                            &image->control_address,
+                            image->stream_id,
+                            image->session_id,
+                            term_id,
+                            ranges,
+                            range_count);
+
+                        aeron_counter_ordered_increment(image->nak_messages_sent_counter, 1);
+                    }
+
                     work_count = send_nak_result < 0 ? send_nak_result : 1;
                 }
                 else
@@ -488,9 +568,13 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
                     const size_t index = aeron_logbuffer_index_by_term(image->initial_term_id, term_id);
                     uint8_t *buffer = image->mapped_raw_log.term_buffers[index].addr;
 
-                    if (aeron_term_gap_filler_try_fill_gap(image->log_meta_data, buffer, term_id, term_offset, length))
+                    for (size_t i = 0; i < range_count; i++)
                     {
-                        aeron_counter_ordered_increment(image->loss_gap_fills_counter, 1);
+                        if (aeron_term_gap_filler_try_fill_gap(
+                            image->log_meta_data, buffer, term_id, ranges[i].term_offset, ranges[i].length))
+                        {
+                            aeron_counter_ordered_increment(image->loss_gap_fills_counter, 1);
+                        }
                     }
 
                     work_count = 1;
@@ -521,6 +605,11 @@ int aeron_publication_image_initiate_rttm(aeron_publication_image_t *image, int6
                 0,
                 true);
 
+            if (send_rttm_result >= 0)
+            {
+                image->congestion_control->on_rttm_sent(image->congestion_control->state, now_ns);
+            }
+
             work_count = send_rttm_result < 0 ? send_rttm_result : 1;
         }
     }
@@ -687,6 +776,9 @@ extern bool aeron_publication_image_is_flow_control_over_run(
 extern void aeron_publication_image_schedule_status_message(
     aeron_publication_image_t *image, int64_t now_ns, int64_t sm_position, int32_t window_length);
 
+extern void aeron_publication_image_signal_rebuild(
+    aeron_publication_image_t *image, aeron_spsc_concurrent_array_queue_t *image_rebuild_queue);
+
 extern bool aeron_publication_image_is_drained(aeron_publication_image_t *image);
 
 extern bool aeron_publication_image_is_accepting_subscriptions(aeron_publication_image_t *image);
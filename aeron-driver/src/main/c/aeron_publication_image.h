@@ -43,11 +43,12 @@ typedef struct aeron_publication_image_stct
         int64_t clean_position;
         int64_t time_of_last_status_change_ns;
         int64_t liveness_timeout_ns;
+        bool is_rebuild_pending;
     }
     conductor_fields;
 
     uint8_t conductor_fields_pad[
-        (2 * AERON_CACHE_LINE_LENGTH) - sizeof(struct aeron_publication_image_conductor_fields_stct)];
+        (4 * AERON_CACHE_LINE_LENGTH) - sizeof(struct aeron_publication_image_conductor_fields_stct)];
 
     struct sockaddr_storage control_address;
     struct sockaddr_storage source_address;
@@ -60,7 +61,7 @@ typedef struct aeron_publication_image_stct
 
     aeron_receive_channel_endpoint_t *endpoint;
     aeron_congestion_control_strategy_t *congestion_control;
-    aeron_clock_func_t nano_clock;
+    aeron_clock_cache_t *cached_clock;
     aeron_clock_func_t epoch_clock;
 
     aeron_loss_reporter_t *loss_reporter;
@@ -77,9 +78,10 @@ typedef struct aeron_publication_image_stct
     int32_t term_length_mask;
     size_t log_file_name_length;
     size_t position_bits_to_shift;
-    aeron_map_raw_log_close_func_t map_raw_log_close_func;
+    aeron_raw_log_pool_t *raw_log_pool;
 
     int64_t last_packet_timestamp_ns;
+    int64_t rebuild_signal_hwm_position;
 
     int64_t last_sm_change_number;
     int64_t last_sm_position;
@@ -95,8 +97,12 @@ typedef struct aeron_publication_image_stct
     volatile int64_t begin_loss_change;
     volatile int64_t end_loss_change;
     int32_t loss_term_id;
-    int32_t loss_term_offset;
-    size_t loss_length;
+    size_t loss_range_count;
+    aeron_nak_range_t loss_ranges[AERON_LOSS_DETECTOR_MAX_GAPS];
+
+    int32_t pending_loss_term_id;
+    size_t pending_loss_range_count;
+    aeron_nak_range_t pending_loss_ranges[AERON_LOSS_DETECTOR_MAX_GAPS];
 
     bool is_end_of_stream;
 
@@ -137,7 +143,7 @@ void aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, i
 
 void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
-void aeron_publication_image_track_rebuild(
+bool aeron_publication_image_track_rebuild(
     aeron_publication_image_t *image, int64_t now_ns, int64_t status_message_timeout);
 
 int aeron_publication_image_insert_packet(
@@ -204,6 +210,22 @@ inline void aeron_publication_image_schedule_status_message(
     image->last_status_message_timestamp = now_ns;
 }
 
+/*
+ * Called by the receiver once per duty cycle. Hands the image to the conductor for rebuild tracking when the high
+ * water mark has moved since it was last handed over. If the queue is full it is retried on the next duty cycle.
+ */
+inline void aeron_publication_image_signal_rebuild(
+    aeron_publication_image_t *image, aeron_spsc_concurrent_array_queue_t *image_rebuild_queue)
+{
+    const int64_t hwm_position = aeron_counter_get(image->rcv_hwm_position.value_addr);
+
+    if (hwm_position != image->rebuild_signal_hwm_position &&
+        AERON_OFFER_SUCCESS == aeron_spsc_concurrent_array_queue_offer(image_rebuild_queue, image))
+    {
+        image->rebuild_signal_hwm_position = hwm_position;
+    }
+}
+
 inline bool aeron_publication_image_is_drained(aeron_publication_image_t *image)
 {
     int64_t rebuild_position = aeron_counter_get(image->rcv_pos_position.value_addr);
@@ -0,0 +1,263 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
+#include "aeron_raw_log_pool.h"
+
+int aeron_raw_log_pool_init(
+    aeron_raw_log_pool_t *pool,
+    const char *aeron_dir,
+    size_t capacity_per_term_length,
+    size_t file_page_size,
+    aeron_map_raw_log_func_t map_raw_log_func,
+    aeron_map_raw_log_close_func_t map_raw_log_close_func)
+{
+    pool->entries.array = NULL;
+    pool->entries.length = 0;
+    pool->entries.capacity = 0;
+    snprintf(pool->pool_dir, sizeof(pool->pool_dir) - 1, "%s/" AERON_RAW_LOG_POOL_DIR, aeron_dir);
+    pool->capacity_per_term_length = capacity_per_term_length;
+    pool->file_page_size = file_page_size;
+    pool->next_file_id = 0;
+    pool->map_raw_log_func = map_raw_log_func;
+    pool->map_raw_log_close_func = map_raw_log_close_func;
+
+    return 0;
+}
+
+static void aeron_raw_log_pool_entry_delete(aeron_raw_log_pool_t *pool, aeron_raw_log_pool_entry_t *entry)
+{
+    pool->map_raw_log_close_func(&entry->mapped_raw_log, entry->file_name);
+    aeron_free(entry->file_name);
+}
+
+int aeron_raw_log_pool_close(aeron_raw_log_pool_t *pool)
+{
+    for (size_t i = 0, length = pool->entries.length; i < length; i++)
+    {
+        aeron_raw_log_pool_entry_delete(pool, &pool->entries.array[i]);
+    }
+
+    aeron_free(pool->entries.array);
+    pool->entries.array = NULL;
+    pool->entries.length = 0;
+    pool->entries.capacity = 0;
+
+    return 0;
+}
+
+static size_t aeron_raw_log_pool_count(aeron_raw_log_pool_t *pool, uint64_t term_length, bool prefaulted_only)
+{
+    size_t count = 0;
+
+    for (size_t i = 0, length = pool->entries.length; i < length; i++)
+    {
+        aeron_raw_log_pool_entry_t *entry = &pool->entries.array[i];
+
+        if (entry->mapped_raw_log.term_length == term_length &&
+            (!prefaulted_only || entry->prefaulted_length == entry->mapped_raw_log.mapped_file.length))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+size_t aeron_raw_log_pool_available(aeron_raw_log_pool_t *pool, uint64_t term_length)
+{
+    return aeron_raw_log_pool_count(pool, term_length, true);
+}
+
+static int aeron_raw_log_pool_add_entry(
+    aeron_raw_log_pool_t *pool, aeron_mapped_raw_log_t *mapped_raw_log, char *file_name, size_t prefaulted_length)
+{
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, pool->entries, aeron_raw_log_pool_entry_t);
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    aeron_raw_log_pool_entry_t *entry = &pool->entries.array[pool->entries.length++];
+
+    memcpy(&entry->mapped_raw_log, mapped_raw_log, sizeof(aeron_mapped_raw_log_t));
+    entry->file_name = file_name;
+    entry->prefaulted_length = prefaulted_length;
+
+    return 0;
+}
+
+static char *aeron_raw_log_pool_next_file_name(aeron_raw_log_pool_t *pool, uint64_t term_length)
+{
+    char path[AERON_MAX_PATH];
+    char *file_name = NULL;
+    int path_length = snprintf(
+        path, sizeof(path), "%s/%" PRIx64 "-%" PRIx64 ".logbuffer", pool->pool_dir, term_length, pool->next_file_id++);
+
+    if (path_length < 0 || (size_t)path_length >= sizeof(path))
+    {
+        aeron_set_err(EINVAL, "raw log pool path too long: %s", pool->pool_dir);
+        return NULL;
+    }
+
+    if (aeron_alloc((void **)&file_name, (size_t)path_length + 1) < 0)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not allocate raw log pool file name");
+        return NULL;
+    }
+
+    memcpy(file_name, path, (size_t)path_length + 1);
+
+    return file_name;
+}
+
+int aeron_raw_log_pool_preallocate(aeron_raw_log_pool_t *pool, uint64_t term_length)
+{
+    for (size_t i = aeron_raw_log_pool_count(pool, term_length, false); i < pool->capacity_per_term_length; i++)
+    {
+        aeron_mapped_raw_log_t mapped_raw_log;
+        char *file_name = aeron_raw_log_pool_next_file_name(pool, term_length);
+
+        if (NULL == file_name)
+        {
+            return -1;
+        }
+
+        if (pool->map_raw_log_func(&mapped_raw_log, file_name, false, term_length, pool->file_page_size) < 0)
+        {
+            aeron_free(file_name);
+            return -1;
+        }
+
+        if (aeron_raw_log_pool_add_entry(pool, &mapped_raw_log, file_name, mapped_raw_log.mapped_file.length) < 0)
+        {
+            pool->map_raw_log_close_func(&mapped_raw_log, file_name);
+            aeron_free(file_name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_raw_log_pool_acquire(
+    aeron_raw_log_pool_t *pool,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length)
+{
+    for (size_t i = 0, length = pool->entries.length; i < length; i++)
+    {
+        aeron_raw_log_pool_entry_t *entry = &pool->entries.array[i];
+
+        if (entry->mapped_raw_log.term_length != term_length ||
+            entry->prefaulted_length != entry->mapped_raw_log.mapped_file.length)
+        {
+            continue;
+        }
+
+        if (rename(entry->file_name, path) < 0)
+        {
+            /* a log that cannot be moved into place is of no further use to the pool */
+            aeron_raw_log_pool_entry_delete(pool, entry);
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)pool->entries.array, sizeof(aeron_raw_log_pool_entry_t), i, --pool->entries.length);
+            break;
+        }
+
+        memcpy(mapped_raw_log, &entry->mapped_raw_log, sizeof(aeron_mapped_raw_log_t));
+        aeron_free(entry->file_name);
+        aeron_array_fast_unordered_remove(
+            (uint8_t *)pool->entries.array, sizeof(aeron_raw_log_pool_entry_t), i, --pool->entries.length);
+
+        return 0;
+    }
+
+    return pool->map_raw_log_func(mapped_raw_log, path, use_sparse_files, term_length, pool->file_page_size);
+}
+
+static void aeron_raw_log_pool_add_spare(aeron_raw_log_pool_t *pool, uint64_t term_length)
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    char *file_name = aeron_raw_log_pool_next_file_name(pool, term_length);
+
+    if (NULL == file_name)
+    {
+        return;
+    }
+
+    /* created sparse so the release stays cheap, do_work then faults the pages in */
+    if (pool->map_raw_log_func(&mapped_raw_log, file_name, true, term_length, pool->file_page_size) < 0)
+    {
+        aeron_free(file_name);
+        return;
+    }
+
+    if (aeron_raw_log_pool_add_entry(pool, &mapped_raw_log, file_name, 0) < 0)
+    {
+        pool->map_raw_log_close_func(&mapped_raw_log, file_name);
+        aeron_free(file_name);
+    }
+}
+
+int aeron_raw_log_pool_release(aeron_raw_log_pool_t *pool, aeron_mapped_raw_log_t *mapped_raw_log, const char *path)
+{
+    const bool is_pooled = NULL != mapped_raw_log->mapped_file.addr &&
+        aeron_raw_log_pool_count(pool, mapped_raw_log->term_length, false) < pool->capacity_per_term_length;
+    const uint64_t term_length = mapped_raw_log->term_length;
+
+    /* the released file may still be mapped by clients so it is never handed out again */
+    const int result = pool->map_raw_log_close_func(mapped_raw_log, path);
+
+    if (is_pooled)
+    {
+        aeron_raw_log_pool_add_spare(pool, term_length);
+    }
+
+    return result;
+}
+
+int aeron_raw_log_pool_do_work(aeron_raw_log_pool_t *pool)
+{
+    for (size_t i = 0, length = pool->entries.length; i < length; i++)
+    {
+        aeron_raw_log_pool_entry_t *entry = &pool->entries.array[i];
+        const size_t log_length = entry->mapped_raw_log.mapped_file.length;
+
+        if (entry->prefaulted_length < log_length)
+        {
+            size_t remaining = log_length - entry->prefaulted_length;
+            size_t chunk_length = remaining < AERON_RAW_LOG_POOL_PREFAULT_CHUNK_LENGTH ?
+                remaining : AERON_RAW_LOG_POOL_PREFAULT_CHUNK_LENGTH;
+
+            memset((uint8_t *)entry->mapped_raw_log.mapped_file.addr + entry->prefaulted_length, 0, chunk_length);
+            entry->prefaulted_length += chunk_length;
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_RAW_LOG_POOL_H
+#define AERON_RAW_LOG_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "aeron_driver_common.h"
+#include "util/aeron_fileutil.h"
+
+#define AERON_RAW_LOG_POOL_DIR "pool"
+#define AERON_RAW_LOG_POOL_PREFAULT_CHUNK_LENGTH (1024 * 1024)
+
+typedef struct aeron_raw_log_pool_entry_stct
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    char *file_name;
+    size_t prefaulted_length;
+}
+aeron_raw_log_pool_entry_t;
+
+/*
+ * Pool of spare mapped and pre-faulted raw logs kept in the pool directory of the aeron dir and keyed by term length.
+ * Acquiring a fully pre-faulted spare renames it to the requested path so clients map it as a new file. Only used on
+ * the conductor thread.
+ *
+ * Invariant: a log handed out by acquire is always a file the pool created itself and that no client has mapped.
+ * Released logs are unlinked and never reused, because a timed out client, a lingering image or a stalled publisher
+ * can still have the old file mapped and would otherwise see, or corrupt, the next stream through the same inode.
+ * Each released log is instead replaced with a new spare which is pre-faulted a chunk at a time from the conductor
+ * duty cycle.
+ */
+typedef struct aeron_raw_log_pool_stct
+{
+    struct aeron_raw_log_pool_entries_stct
+    {
+        aeron_raw_log_pool_entry_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    entries;
+
+    char pool_dir[AERON_MAX_PATH];
+    size_t capacity_per_term_length;
+    size_t file_page_size;
+    int64_t next_file_id;
+    aeron_map_raw_log_func_t map_raw_log_func;
+    aeron_map_raw_log_close_func_t map_raw_log_close_func;
+}
+aeron_raw_log_pool_t;
+
+int aeron_raw_log_pool_init(
+    aeron_raw_log_pool_t *pool,
+    const char *aeron_dir,
+    size_t capacity_per_term_length,
+    size_t file_page_size,
+    aeron_map_raw_log_func_t map_raw_log_func,
+    aeron_map_raw_log_close_func_t map_raw_log_close_func);
+
+int aeron_raw_log_pool_close(aeron_raw_log_pool_t *pool);
+
+/*
+ * Fill the pool up to capacity with newly created, non-sparse logs of the given term length.
+ */
+int aeron_raw_log_pool_preallocate(aeron_raw_log_pool_t *pool, uint64_t term_length);
+
+/*
+ * Map a raw log at path, taking a pre-faulted spare of the same term length when one is available and otherwise
+ * creating it with the map_raw_log_func.
+ */
+int aeron_raw_log_pool_acquire(
+    aeron_raw_log_pool_t *pool,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length);
+
+/*
+ * Close and remove a raw log with the map_raw_log_close_func and, when the pool holds fewer than capacity logs of its
+ * term length, create a new spare in its place to be pre-faulted by aeron_raw_log_pool_do_work.
+ */
+int aeron_raw_log_pool_release(aeron_raw_log_pool_t *pool, aeron_mapped_raw_log_t *mapped_raw_log, const char *path);
+
+/*
+ * Pre-fault up to AERON_RAW_LOG_POOL_PREFAULT_CHUNK_LENGTH bytes of a new spare log. Returns the work count.
+ */
+int aeron_raw_log_pool_do_work(aeron_raw_log_pool_t *pool);
+
+size_t aeron_raw_log_pool_available(aeron_raw_log_pool_t *pool, uint64_t term_length);
+
+#endif //AERON_RAW_LOG_POOL_H
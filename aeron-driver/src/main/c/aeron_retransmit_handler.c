@@ -15,6 +15,8 @@
  */
 
 #include <string.h>
+#include <inttypes.h>
+#include "aeron_alloc.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "protocol/aeron_udp_protocol.h"
 #include "util/aeron_error.h"
@@ -23,23 +25,42 @@
 int aeron_retransmit_handler_init(
     aeron_retransmit_handler_t *handler,
     int64_t *invalid_packets_counter,
+    int64_t *retransmit_overflow_counter,
     uint64_t delay_timeout_ns,
-    uint64_t linger_timeout_ns)
+    uint64_t linger_timeout_ns,
+    size_t max_resend)
 {
+    if (max_resend < 1 || max_resend > AERON_RETRANSMIT_HANDLER_MAX_RESEND_MAX)
+    {
+        aeron_set_err(
+            EINVAL, "retransmit handler max resend must be >= 1 and <= %d: %" PRIu64,
+            AERON_RETRANSMIT_HANDLER_MAX_RESEND_MAX, (uint64_t)max_resend);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&handler->retransmit_action_pool, max_resend * sizeof(aeron_retransmit_action_t)) < 0)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not allocate retransmit action pool");
+        return -1;
+    }
+
     if (aeron_int64_to_ptr_hash_map_init(
         &handler->active_retransmits_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         int errcode = errno;
 
+        aeron_free(handler->retransmit_action_pool);
         aeron_set_err(errcode, "could not init retransmit handler map: %s", strerror(errcode));
         return -1;
     }
 
+    handler->retransmit_action_pool_capacity = max_resend;
     handler->invalid_packets_counter = invalid_packets_counter;
+    handler->retransmit_overflow_counter = retransmit_overflow_counter;
     handler->delay_timeout_ns = delay_timeout_ns;
     handler->linger_timeout_ns = linger_timeout_ns;
 
-    for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
+    for (size_t i = 0; i < max_resend; i++)
     {
         handler->retransmit_action_pool[i].state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
     }
@@ -50,6 +71,8 @@ int aeron_retransmit_handler_init(
 int aeron_retransmit_handler_close(aeron_retransmit_handler_t *handler)
 {
     aeron_int64_to_ptr_hash_map_delete(&handler->active_retransmits_map);
+    aeron_free(handler->retransmit_action_pool);
+    handler->retransmit_action_pool = NULL;
     return 0;
 }
 
@@ -67,7 +90,7 @@ bool aeron_retransmit_handler_is_invalid(aeron_retransmit_handler_t *handler, in
 
 aeron_retransmit_action_t *aeron_retransmit_handler_assign_action(aeron_retransmit_handler_t *handler)
 {
-    for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
+    for (size_t i = 0; i < handler->retransmit_action_pool_capacity; i++)
     {
         if (AERON_RETRANSMIT_ACTION_STATE_INACTIVE == handler->retransmit_action_pool[i].state)
         {
@@ -94,8 +117,16 @@ int aeron_retransmit_handler_on_nak(
     {
         const int64_t key = aeron_int64_to_ptr_hash_map_compound_key(term_id, term_offset);
 
-        if (NULL == aeron_int64_to_ptr_hash_map_get(&handler->active_retransmits_map, key) &&
-            handler->active_retransmits_map.size < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS)
+        if (NULL != aeron_int64_to_ptr_hash_map_get(&handler->active_retransmits_map, key))
+        {
+            return 0;
+        }
+
+        if (handler->active_retransmits_map.size >= handler->retransmit_action_pool_capacity)
+        {
+            aeron_counter_increment(handler->retransmit_overflow_counter, 1);
+        }
+        else
         {
             aeron_retransmit_action_t *action = aeron_retransmit_handler_assign_action(handler);
 
@@ -136,6 +167,45 @@ int aeron_retransmit_handler_on_nak(
     return result;
 }
 
+int aeron_retransmit_handler_on_nak_list(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    const aeron_nak_range_t *ranges,
+    size_t range_count,
+    size_t term_length,
+    int64_t now_ns,
+    aeron_retransmit_handler_resend_func_t resend,
+    void *resend_clientd)
+{
+    for (size_t i = 0; i < range_count; i++)
+    {
+        const int32_t length = ranges[i].length;
+
+        if (length <= 0)
+        {
+            aeron_counter_increment(handler->invalid_packets_counter, 1);
+            continue;
+        }
+
+        int range_result = aeron_retransmit_handler_on_nak(
+            handler,
+            term_id,
+            ranges[i].term_offset,
+            (size_t)length,
+            term_length,
+            now_ns,
+            resend,
+            resend_clientd);
+
+        if (range_result < 0)
+        {
+            return range_result;
+        }
+    }
+
+    return 0;
+}
+
 int aeron_retransmit_handler_process_timeouts(
     aeron_retransmit_handler_t *handler,
     int64_t now_ns,
@@ -147,7 +217,7 @@ int aeron_retransmit_handler_process_timeouts(
 
     if (num_active_actions > 0)
     {
-        for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS && num_active_actions > 0; i++)
+        for (size_t i = 0; i < handler->retransmit_action_pool_capacity && num_active_actions > 0; i++)
         {
             aeron_retransmit_action_t *action = &handler->retransmit_action_pool[i];
 
@@ -21,6 +21,7 @@
 #include <stddef.h>
 #include "collections/aeron_int64_to_ptr_hash_map.h"
 #include "aeron_driver_common.h"
+#include "protocol/aeron_udp_protocol.h"
 #include "aeronmd.h"
 
 typedef enum aeron_retransmit_action_state_enum
@@ -41,27 +42,32 @@ typedef struct aeron_retransmit_action_stct
 }
 aeron_retransmit_action_t;
 
-#define AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS (16)
+#define AERON_RETRANSMIT_HANDLER_MAX_RESEND_DEFAULT (16)
+#define AERON_RETRANSMIT_HANDLER_MAX_RESEND_MAX (1024)
 
 typedef int (*aeron_retransmit_handler_resend_func_t)(
     void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
 typedef struct aeron_retransmit_handler_stct
 {
-    aeron_retransmit_action_t retransmit_action_pool[AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS];
+    aeron_retransmit_action_t *retransmit_action_pool;
+    size_t retransmit_action_pool_capacity;
     aeron_int64_to_ptr_hash_map_t active_retransmits_map;
     uint64_t delay_timeout_ns;
     uint64_t linger_timeout_ns;
 
     int64_t *invalid_packets_counter;
+    int64_t *retransmit_overflow_counter;
 }
 aeron_retransmit_handler_t;
 
 int aeron_retransmit_handler_init(
     aeron_retransmit_handler_t *handler,
     int64_t *invalid_packets_counter,
+    int64_t *retransmit_overflow_counter,
     uint64_t delay_timeout_ns,
-    uint64_t linger_timeout_ns);
+    uint64_t linger_timeout_ns,
+    size_t max_resend);
 
 int aeron_retransmit_handler_close(aeron_retransmit_handler_t *handler);
 
@@ -75,6 +81,16 @@ int aeron_retransmit_handler_on_nak(
     aeron_retransmit_handler_resend_func_t resend,
     void *resend_clientd);
 
+int aeron_retransmit_handler_on_nak_list(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    const aeron_nak_range_t *ranges,
+    size_t range_count,
+    size_t term_length,
+    int64_t now_ns,
+    aeron_retransmit_handler_resend_func_t resend,
+    void *resend_clientd);
+
 int aeron_retransmit_handler_process_timeouts(
     aeron_retransmit_handler_t *handler,
     int64_t now_ns,
@@ -46,7 +46,11 @@ static aeron_system_counter_t system_counters[] =
         { "Possible TTL Asymmetry", AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY },
         { "ControllableIdleStrategy status", AERON_SYSTEM_COUNTER_CONTROLLABLE_IDLE_STRATEGY },
         { "Loss gap fills", AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS},
-        { "Client liveness timeouts", AERON_SYSTEM_COUNTER_CLIENT_TIMEOUTS}
+        { "Client liveness timeouts", AERON_SYSTEM_COUNTER_CLIENT_TIMEOUTS},
+        { "Network publication send batches", AERON_SYSTEM_COUNTER_SEND_BATCHES },
+        { "Network publication datagrams sent in batches", AERON_SYSTEM_COUNTER_SEND_BATCH_MESSAGES },
+        { "Network publication send batches at max messages per send", AERON_SYSTEM_COUNTER_SEND_BATCHES_AT_LIMIT },
+        { "Retransmits not serviced due to full retransmit action pool", AERON_SYSTEM_COUNTER_RETRANSMIT_OVERFLOW }
     };
 
 static size_t num_system_counters = sizeof(system_counters) / sizeof(aeron_system_counter_t);
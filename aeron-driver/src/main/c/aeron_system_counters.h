@@ -46,7 +46,11 @@ typedef enum aeron_system_counter_enum_stct
     AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY = 21,
     AERON_SYSTEM_COUNTER_CONTROLLABLE_IDLE_STRATEGY = 22,
     AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS = 23,
-    AERON_SYSTEM_COUNTER_CLIENT_TIMEOUTS = 24
+    AERON_SYSTEM_COUNTER_CLIENT_TIMEOUTS = 24,
+    AERON_SYSTEM_COUNTER_SEND_BATCHES = 25,
+    AERON_SYSTEM_COUNTER_SEND_BATCH_MESSAGES = 26,
+    AERON_SYSTEM_COUNTER_SEND_BATCHES_AT_LIMIT = 27,
+    AERON_SYSTEM_COUNTER_RETRANSMIT_OVERFLOW = 28
 }
 aeron_system_counter_enum_t;
 
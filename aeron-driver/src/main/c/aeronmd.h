@@ -154,6 +154,10 @@ bool aeron_driver_context_get_spies_simulate_connection(aeron_driver_context_t *
 
 /**
  * Page size for alignment of all files.
+ *
+ * When the aeron dir is on a hugetlbfs mount this must be a multiple of the mount's huge page size so that the CnC
+ * file and log buffers are backed by huge pages. A page size larger than the OS page size also advises log buffer
+ * mappings to use transparent huge pages, e.g. on a tmpfs mounted with huge=advise.
  */
 #define AERON_FILE_PAGE_SIZE_ENV_VAR "AERON_FILE_PAGE_SIZE"
 
@@ -254,6 +258,7 @@ typedef int (*aeron_flow_control_strategy_supplier_func_t)(
 #define AERON_MULTICAST_MIN_FLOW_CONTROL_STRATEGY_NAME "multicast_min"
 #define AERON_MULTICAST_MAX_FLOW_CONTROL_STRATEGY_NAME "multicast_max"
 #define AERON_UNICAST_MAX_FLOW_CONTROL_STRATEGY_NAME "unicast_max"
+#define AERON_MULTICAST_TAGGED_FLOW_CONTROL_STRATEGY_NAME "multicast_tagged"
 
 /**
  * Return a flow control strategy supplier function pointer associated with the given name. This only will find
@@ -325,6 +330,22 @@ int aeron_driver_context_set_congestioncontrol_supplier(
 aeron_congestion_control_strategy_supplier_func_t aeron_driver_context_get_congestioncontrol_supplier(
     aeron_driver_context_t *context);
 
+/**
+ * Initial RTT estimate used by the cubic congestion control strategy (aeron_cubic_congestion_control_strategy_supplier)
+ * until the first measurement arrives. Also the interval between window increases.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_INITIALRTT"
+
+/**
+ * Should the cubic congestion control strategy measure RTT with RTT measurement frames.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_MEASURERTT"
+
+/**
+ * Should the cubic congestion control strategy use the TCP friendly region of the window growth function.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_TCPMODE"
+
 /**
  * Length (in bytes) of the buffer for the loss report log.
  */
@@ -437,6 +458,86 @@ const char *aeron_driver_context_get_sharednetwork_idle_strategy_init_args(aeron
 int aeron_driver_context_set_shared_idle_strategy_init_args(aeron_driver_context_t *context, const char *value);
 const char *aeron_driver_context_get_shared_idle_strategy_init_args(aeron_driver_context_t *context);
 
+/**
+ * CPUs to pin the Conductor for DEDICATED or SHARED_NETWORK Threading Mode thread to, as a list such as "2" or "0-3,8".
+ */
+#define AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR "AERON_CONDUCTOR_CPU_AFFINITY"
+
+int aeron_driver_context_set_conductor_cpu_affinity(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_conductor_cpu_affinity(aeron_driver_context_t *context);
+
+/**
+ * NUMA node preferred for memory first touched by the Conductor for DEDICATED or SHARED_NETWORK Threading Mode thread. Unset or -1 keeps the default policy.
+ */
+#define AERON_CONDUCTOR_NUMA_NODE_ENV_VAR "AERON_CONDUCTOR_NUMA_NODE"
+
+int aeron_driver_context_set_conductor_numa_node(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_conductor_numa_node(aeron_driver_context_t *context);
+
+/**
+ * CPUs to pin the Sender for DEDICATED Threading Mode thread to, as a list such as "2" or "0-3,8".
+ */
+#define AERON_SENDER_CPU_AFFINITY_ENV_VAR "AERON_SENDER_CPU_AFFINITY"
+
+int aeron_driver_context_set_sender_cpu_affinity(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_sender_cpu_affinity(aeron_driver_context_t *context);
+
+/**
+ * NUMA node preferred for memory first touched by the Sender for DEDICATED Threading Mode thread. Unset or -1 keeps the default policy.
+ */
+#define AERON_SENDER_NUMA_NODE_ENV_VAR "AERON_SENDER_NUMA_NODE"
+
+int aeron_driver_context_set_sender_numa_node(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_sender_numa_node(aeron_driver_context_t *context);
+
+/**
+ * CPUs to pin the Receiver for DEDICATED Threading Mode thread to, as a list such as "2" or "0-3,8".
+ */
+#define AERON_RECEIVER_CPU_AFFINITY_ENV_VAR "AERON_RECEIVER_CPU_AFFINITY"
+
+int aeron_driver_context_set_receiver_cpu_affinity(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_receiver_cpu_affinity(aeron_driver_context_t *context);
+
+/**
+ * NUMA node preferred for memory first touched by the Receiver for DEDICATED Threading Mode thread. Unset or -1 keeps the default policy.
+ */
+#define AERON_RECEIVER_NUMA_NODE_ENV_VAR "AERON_RECEIVER_NUMA_NODE"
+
+int aeron_driver_context_set_receiver_numa_node(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_receiver_numa_node(aeron_driver_context_t *context);
+
+/**
+ * CPUs to pin the Sender and Receiver for SHARED_NETWORK Threading Mode thread to, as a list such as "2" or "0-3,8".
+ */
+#define AERON_SHAREDNETWORK_CPU_AFFINITY_ENV_VAR "AERON_SHAREDNETWORK_CPU_AFFINITY"
+
+int aeron_driver_context_set_sharednetwork_cpu_affinity(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_sharednetwork_cpu_affinity(aeron_driver_context_t *context);
+
+/**
+ * NUMA node preferred for memory first touched by the Sender and Receiver for SHARED_NETWORK Threading Mode thread. Unset or -1 keeps the default policy.
+ */
+#define AERON_SHAREDNETWORK_NUMA_NODE_ENV_VAR "AERON_SHAREDNETWORK_NUMA_NODE"
+
+int aeron_driver_context_set_sharednetwork_numa_node(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_sharednetwork_numa_node(aeron_driver_context_t *context);
+
+/**
+ * CPUs to pin the Conductor, Sender, and Receiver for SHARED Threading Mode thread to, as a list such as "2" or "0-3,8".
+ */
+#define AERON_SHARED_CPU_AFFINITY_ENV_VAR "AERON_SHARED_CPU_AFFINITY"
+
+int aeron_driver_context_set_shared_cpu_affinity(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_shared_cpu_affinity(aeron_driver_context_t *context);
+
+/**
+ * NUMA node preferred for memory first touched by the Conductor, Sender, and Receiver for SHARED Threading Mode thread. Unset or -1 keeps the default policy.
+ */
+#define AERON_SHARED_NUMA_NODE_ENV_VAR "AERON_SHARED_NUMA_NODE"
+
+int aeron_driver_context_set_shared_numa_node(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_shared_numa_node(aeron_driver_context_t *context);
+
 /**
  * Function name to call on start of each agent.
  */
@@ -462,6 +563,18 @@ uint64_t aeron_driver_context_get_counters_free_to_reuse_timeout_ns(aeron_driver
  */
 #define AERON_MIN_MULTICAST_FLOW_CONTROL_RECEIVER_TIMEOUT_ENV_VAR "AERON_MIN_MULTICAST_FLOW_CONTROL_RECEIVER_TIMEOUT"
 
+/**
+ * Group tag of the receivers tracked by the tagged flow control strategy. Status messages from receivers
+ * without this tag are ignored. Can be overridden per publication with fc=tagged,g:<tag>.
+ */
+#define AERON_FLOW_CONTROL_GROUP_TAG_ENV_VAR "AERON_FLOW_CONTROL_GROUP_TAG"
+
+/**
+ * Number of receivers the min and tagged flow control strategies require before a publication is connected and
+ * allowed to advance. Can be overridden per publication with fc=min,g:/<size> or fc=tagged,g:<tag>/<size>.
+ */
+#define AERON_FLOW_CONTROL_GROUP_MIN_SIZE_ENV_VAR "AERON_FLOW_CONTROL_GROUP_MIN_SIZE"
+
 /**
  * Function name to call for termination validation.
  */
@@ -573,6 +686,110 @@ uint64_t aeron_driver_context_get_retransmit_unicast_delay_ns(aeron_driver_conte
 int aeron_driver_context_set_retransmit_unicast_linger_ns(aeron_driver_context_t *context, uint64_t value);
 uint64_t aeron_driver_context_get_retransmit_unicast_linger_ns(aeron_driver_context_t *context);
 
+/**
+ * Maximum number of datagrams a network publication will send in a single sendmmsg batch per duty cycle.
+ */
+#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_ENV_VAR "AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND"
+
+int aeron_driver_context_set_network_publication_max_messages_per_send(
+    aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_network_publication_max_messages_per_send(aeron_driver_context_t *context);
+
+/**
+ * Number of datagrams the Receiver will attempt to read from each transport in a single recvmmsg call.
+ */
+#define AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR "AERON_RECEIVER_IO_VECTOR_CAPACITY"
+
+int aeron_driver_context_set_receiver_io_vector_capacity(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_receiver_io_vector_capacity(aeron_driver_context_t *context);
+
+/**
+ * Number of control messages the Sender will attempt to read from each transport in a single recvmmsg call.
+ */
+#define AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR "AERON_SENDER_IO_VECTOR_CAPACITY"
+
+int aeron_driver_context_set_sender_io_vector_capacity(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_sender_io_vector_capacity(aeron_driver_context_t *context);
+
+/**
+ * Use UDP generic segmentation offload (UDP_SEGMENT) to send runs of equally sized frames as a single large buffer
+ * that the kernel or NIC splits into datagrams. Falls back to regular sends where it is not supported.
+ */
+#define AERON_SOCKET_UDP_GSO_ENV_VAR "AERON_SOCKET_UDP_GSO"
+
+int aeron_driver_context_set_socket_udp_gso(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_udp_gso(aeron_driver_context_t *context);
+
+/**
+ * Use UDP generic receive offload (UDP_GRO) so that the kernel may deliver several datagrams in a single receive.
+ * Falls back to regular receives where it is not supported.
+ */
+#define AERON_SOCKET_UDP_GRO_ENV_VAR "AERON_SOCKET_UDP_GRO"
+
+int aeron_driver_context_set_socket_udp_gro(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_udp_gro(aeron_driver_context_t *context);
+
+/**
+ * Receive on the Sender and Receiver through io_uring multishot receives into kernel provided buffers rather than one
+ * recvmmsg per ready transport. Falls back to epoll/poll where io_uring is not available.
+ */
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_ENV_VAR "AERON_UDP_TRANSPORT_POLLER_IO_URING"
+
+int aeron_driver_context_set_udp_transport_poller_io_uring(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_udp_transport_poller_io_uring(aeron_driver_context_t *context);
+
+/**
+ * Number of provided buffers in each io_uring poller ring. Must be a power of 2, values from the environment are
+ * rounded up to the next power of 2.
+ */
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT_ENV_VAR "AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT"
+
+int aeron_driver_context_set_udp_transport_poller_io_uring_buffer_count(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_udp_transport_poller_io_uring_buffer_count(aeron_driver_context_t *context);
+
+/**
+ * Number of spare log buffers per term length the driver keeps mapped and pre-faulted for new publications and
+ * images. Spares for the default network and IPC term lengths are created up front. A released log is deleted, as
+ * clients may still have it mapped, and replaced by a new spare pre-faulted in the background by the conductor.
+ * 0 disables.
+ */
+#define AERON_RAW_LOG_POOL_CAPACITY_ENV_VAR "AERON_RAW_LOG_POOL_CAPACITY"
+
+int aeron_driver_context_set_raw_log_pool_capacity(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_raw_log_pool_capacity(aeron_driver_context_t *context);
+
+/**
+ * Maximum number of gaps in a term an image tracks and NAKs at once. With more than 1 the gaps found in the same
+ * scan are also sent as a single NAK_LIST frame, which only a C media driver sender understands. The first gap
+ * always goes as a classic NAK as well, so other senders still repair it. 1 keeps one NAK per gap.
+ */
+#define AERON_NAK_MAX_RANGES_ENV_VAR "AERON_NAK_MAX_RANGES"
+
+int aeron_driver_context_set_nak_max_ranges(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_nak_max_ranges(aeron_driver_context_t *context);
+
+/**
+ * Maximum number of retransmits a network publication has in flight, delayed or lingering, at once. NAKs arriving
+ * while all are in use are not serviced and are counted by the retransmit overflow system counter.
+ */
+#define AERON_MAX_RESEND_ENV_VAR "AERON_MAX_RESEND"
+
+int aeron_driver_context_set_max_resend(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_max_resend(aeron_driver_context_t *context);
+
+/**
+ * Name of the media transport bindings to use for UDP channels. "default" selects the socket implementation, any
+ * other name is looked up as an aeron_udp_channel_transport_bindings_t symbol in the executable or loaded libraries.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA"
+
+typedef struct aeron_udp_channel_transport_bindings_stct aeron_udp_channel_transport_bindings_t;
+
+int aeron_driver_context_set_udp_channel_transport_bindings(
+    aeron_driver_context_t *context, aeron_udp_channel_transport_bindings_t *value);
+aeron_udp_channel_transport_bindings_t *aeron_driver_context_get_udp_channel_transport_bindings(
+    aeron_driver_context_t *context);
+
 #define AERON_IPC_CHANNEL "aeron:ipc"
 #define AERON_IPC_CHANNEL_LEN strlen(AERON_IPC_CHANNEL)
 #define AERON_SPY_PREFIX "aeron-spy:"
@@ -528,6 +528,9 @@ static const char *dissect_command_type_id(int64_t cmd_type_id)
         case AERON_COMMAND_TERMINATE_DRIVER:
             return "TERMINATE_DRIVER";
 
+        case AERON_COMMAND_BATCH:
+            return "BATCH";
+
         default:
             return "unknown command";
     }
@@ -655,6 +658,18 @@ static const char *dissect_cmd_in(int64_t cmd_id, const void *message, size_t le
             break;
         }
 
+        case AERON_COMMAND_BATCH:
+        {
+            aeron_batch_message_t *command = (aeron_batch_message_t *)message;
+
+            snprintf(buffer, sizeof(buffer) - 1, "%s [%" PRId64 ":%" PRId64 "] %d",
+                dissect_command_type_id(cmd_id),
+                command->correlated.client_id,
+                command->correlated.correlation_id,
+                command->entry_count);
+            break;
+        }
+
         default:
             break;
     }
@@ -867,6 +882,20 @@ static const char *dissect_frame(const void *message, size_t length)
             break;
         }
 
+        case AERON_HDR_TYPE_NAK_LIST:
+        {
+            aeron_nak_list_header_t *nak_list = (aeron_nak_list_header_t *)message;
+
+            snprintf(buffer, sizeof(buffer) - 1, "NAK_LIST 0x%x len %d %d:%d:%d ranges %d",
+                hdr->flags,
+                hdr->frame_length,
+                nak_list->session_id,
+                nak_list->stream_id,
+                nak_list->term_id,
+                nak_list->range_count);
+            break;
+        }
+
         case AERON_HDR_TYPE_SETUP:
         {
             aeron_setup_header_t *setup = (aeron_setup_header_t *)message;
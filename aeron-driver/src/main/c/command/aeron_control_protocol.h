@@ -34,6 +34,7 @@
 #define AERON_COMMAND_ADD_RCV_DESTINATION (0x0C)
 #define AERON_COMMAND_REMOVE_RCV_DESTINATION (0x0D)
 #define AERON_COMMAND_TERMINATE_DRIVER (0x0E)
+#define AERON_COMMAND_BATCH (0x0F)
 
 #define AERON_RESPONSE_ON_ERROR (0x0F01)
 #define AERON_RESPONSE_ON_AVAILABLE_IMAGE (0x0F02)
@@ -45,6 +46,9 @@
 #define AERON_RESPONSE_ON_COUNTER_READY (0x0F08)
 #define AERON_RESPONSE_ON_UNAVAILABLE_COUNTER (0x0F09)
 #define AERON_RESPONSE_ON_CLIENT_TIMEOUT (0x0F0A)
+#define AERON_RESPONSE_ON_BATCH (0x0F0B)
+
+#define AERON_BATCH_ENTRY_ALIGNMENT (8)
 
 /* error codes */
 #define AERON_ERROR_CODE_GENERIC_ERROR (0)
@@ -177,6 +181,25 @@ typedef struct aeron_terminate_driver_command_stct
 }
 aeron_terminate_driver_command_t;
 
+/*
+ * Batch of commands or responses packed into one record. Each entry starts with an aeron_batch_entry_t and is
+ * aligned to AERON_BATCH_ENTRY_ALIGNMENT from the start of the message.
+ */
+typedef struct aeron_batch_message_stct
+{
+    aeron_correlated_command_t correlated;
+    int32_t entry_count;
+    int32_t reserved;
+}
+aeron_batch_message_t;
+
+typedef struct aeron_batch_entry_stct
+{
+    int32_t msg_type_id;
+    int32_t length;
+}
+aeron_batch_entry_t;
+
 #pragma pack(pop)
 
 #endif //AERON_CONTROL_PROTOCOL_H
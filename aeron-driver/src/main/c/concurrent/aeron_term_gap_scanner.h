@@ -23,6 +23,7 @@
 #include "util/aeron_bitutil.h"
 #include "aeron_atomic.h"
 #include "aeron_logbuffer_descriptor.h"
+#include "aeron_term_scanner.h"
 
 typedef void (*aeron_term_gap_scanner_on_gap_detected_func_t)(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
@@ -37,6 +38,9 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
     void *clientd)
 {
     int32_t offset = term_offset;
+#if defined(AERON_TERM_SCANNER_SIMD)
+    bool try_skip = true;
+#endif
 
     do
     {
@@ -49,7 +53,16 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
             break;
         }
 
-        offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        offset += aligned_frame_length;
+
+#if defined(AERON_TERM_SCANNER_SIMD)
+        if (try_skip && offset + (AERON_TERM_SCANNER_SIMD_FRAMES * aligned_frame_length) <= limit_offset)
+        {
+            offset = aeron_term_scanner_skip_uniform_frames(buffer, offset, limit_offset, frame_length, false);
+            try_skip = false;
+        }
+#endif
     }
     while (offset < limit_offset);
 
@@ -57,6 +70,9 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
     if (offset < limit_offset)
     {
         const int32_t limit = limit_offset - AERON_ALIGNED_HEADER_LENGTH;
+#if defined(AERON_TERM_SCANNER_SIMD)
+        offset = aeron_term_scanner_skip_empty_frames(buffer, offset, limit);
+#endif
         while (offset < limit)
         {
             offset += AERON_LOGBUFFER_FRAME_ALIGNMENT;
@@ -18,3 +18,128 @@
 
 extern size_t aeron_term_scanner_scan_for_availability(
     const uint8_t *buffer, size_t term_length_left, size_t max_length, size_t *padding);
+
+#if defined(AERON_TERM_SCANNER_SIMD)
+
+#include <immintrin.h>
+
+static bool aeron_term_scanner_simd_enabled = true;
+
+__attribute__((target("avx2")))
+static int32_t aeron_term_scanner_skip_uniform_frames_avx2(
+    const uint8_t *buffer, int32_t offset, int32_t limit_offset, int32_t frame_length, bool exclude_padding)
+{
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int32_t group_length = AERON_TERM_SCANNER_SIMD_FRAMES * aligned_frame_length;
+    const __m128i frame_offsets = _mm_setr_epi32(
+        0, aligned_frame_length, 2 * aligned_frame_length, 3 * aligned_frame_length);
+    /* each lane holds the first 8 bytes of a header, frame length in the low half and type in the top 16 bits */
+    const __m256i length_mask = _mm256_set1_epi64x(0xFFFFFFFFLL);
+    const __m256i expected_length = _mm256_set1_epi64x((long long)(uint32_t)frame_length);
+    const __m256i type_mask = _mm256_set1_epi64x((long long)(0xFFFFULL << 48));
+    const __m256i pad_type = _mm256_set1_epi64x((long long)((uint64_t)AERON_HDR_TYPE_PAD << 48));
+    const __m256i all_set = _mm256_set1_epi64x(-1);
+
+    while (offset + group_length <= limit_offset)
+    {
+        const __m256i headers = _mm256_i32gather_epi64((const long long *)(buffer + offset), frame_offsets, 1);
+        const __m256i is_expected_length = _mm256_cmpeq_epi64(_mm256_and_si256(headers, length_mask), expected_length);
+
+        if (!_mm256_testc_si256(is_expected_length, all_set))
+        {
+            break;
+        }
+
+        if (exclude_padding)
+        {
+            const __m256i is_pad = _mm256_cmpeq_epi64(_mm256_and_si256(headers, type_mask), pad_type);
+            if (!_mm256_testz_si256(is_pad, is_pad))
+            {
+                break;
+            }
+        }
+
+        offset += group_length;
+    }
+
+    __asm__ volatile("" ::: "memory");
+
+    return offset;
+}
+
+__attribute__((target("avx2")))
+static int32_t aeron_term_scanner_skip_empty_frames_avx2(const uint8_t *buffer, int32_t offset, int32_t limit)
+{
+    const int32_t group_length = 8 * AERON_LOGBUFFER_FRAME_ALIGNMENT;
+    const __m256i slot_offsets = _mm256_setr_epi32(
+        AERON_LOGBUFFER_FRAME_ALIGNMENT,
+        2 * AERON_LOGBUFFER_FRAME_ALIGNMENT,
+        3 * AERON_LOGBUFFER_FRAME_ALIGNMENT,
+        4 * AERON_LOGBUFFER_FRAME_ALIGNMENT,
+        5 * AERON_LOGBUFFER_FRAME_ALIGNMENT,
+        6 * AERON_LOGBUFFER_FRAME_ALIGNMENT,
+        7 * AERON_LOGBUFFER_FRAME_ALIGNMENT,
+        8 * AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    while (offset + (group_length - AERON_LOGBUFFER_FRAME_ALIGNMENT) < limit)
+    {
+        const __m256i frame_lengths = _mm256_i32gather_epi32((const int *)(buffer + offset), slot_offsets, 1);
+        if (!_mm256_testz_si256(frame_lengths, frame_lengths))
+        {
+            break;
+        }
+
+        offset += group_length;
+    }
+
+    __asm__ volatile("" ::: "memory");
+
+    return offset;
+}
+
+static inline bool aeron_term_scanner_simd_is_available(void)
+{
+    bool enabled;
+    AERON_GET_VOLATILE(enabled, aeron_term_scanner_simd_enabled);
+
+    return enabled && __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+int32_t aeron_term_scanner_skip_uniform_frames(
+    const uint8_t *buffer, int32_t offset, int32_t limit_offset, int32_t frame_length, bool exclude_padding)
+{
+#if defined(AERON_TERM_SCANNER_SIMD)
+    if (aeron_term_scanner_simd_is_available())
+    {
+        return aeron_term_scanner_skip_uniform_frames_avx2(
+            buffer, offset, limit_offset, frame_length, exclude_padding);
+    }
+#endif
+
+    return offset;
+}
+
+int32_t aeron_term_scanner_skip_empty_frames(const uint8_t *buffer, int32_t offset, int32_t limit)
+{
+#if defined(AERON_TERM_SCANNER_SIMD)
+    if (aeron_term_scanner_simd_is_available())
+    {
+        return aeron_term_scanner_skip_empty_frames_avx2(buffer, offset, limit);
+    }
+#endif
+
+    return offset;
+}
+
+bool aeron_term_scanner_simd_enable(bool enabled)
+{
+#if defined(AERON_TERM_SCANNER_SIMD)
+    AERON_PUT_VOLATILE(aeron_term_scanner_simd_enabled, enabled);
+
+    return aeron_term_scanner_simd_is_available();
+#else
+    return false;
+#endif
+}
@@ -19,17 +19,47 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include "util/aeron_bitutil.h"
 #include "protocol/aeron_udp_protocol.h"
 #include "aeron_atomic.h"
 #include "aeron_logbuffer_descriptor.h"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(AERON_TERM_SCANNER_NO_SIMD)
+#define AERON_TERM_SCANNER_SIMD
+#endif
+
+/* frames compared at once when skipping runs of frames with vector loads */
+#define AERON_TERM_SCANNER_SIMD_FRAMES (4)
+
+/*
+ * Skip whole groups of AERON_TERM_SCANNER_SIMD_FRAMES frames from offset which all have a frame length of
+ * frame_length, and a type other than padding if exclude_padding is set, without going beyond limit_offset. Returns
+ * the offset after the last group skipped, which is offset when nothing was skipped or vector loads are unavailable.
+ */
+int32_t aeron_term_scanner_skip_uniform_frames(
+    const uint8_t *buffer, int32_t offset, int32_t limit_offset, int32_t frame_length, bool exclude_padding);
+
+/*
+ * Skip aligned slots after offset that hold no frame length in the same steps the gap scanners take one slot at a
+ * time, for as long as the slot before each stays below limit. Returns the offset of the last empty slot stepped to.
+ */
+int32_t aeron_term_scanner_skip_empty_frames(const uint8_t *buffer, int32_t offset, int32_t limit);
+
+/*
+ * Allow or prevent the use of vector loads by the scanners. Returns true if they will be used.
+ */
+bool aeron_term_scanner_simd_enable(bool enabled);
+
 inline size_t aeron_term_scanner_scan_for_availability(
     const uint8_t *buffer, size_t term_length_left, size_t max_length, size_t *padding)
 {
     const size_t limit = max_length < term_length_left ? max_length : term_length_left;
     size_t available = 0;
     *padding = 0;
+#if defined(AERON_TERM_SCANNER_SIMD)
+    bool try_skip = true;
+#endif
 
     do
     {
@@ -58,6 +88,16 @@ inline size_t aeron_term_scanner_scan_for_availability(
             *padding = 0;
             break;
         }
+
+#if defined(AERON_TERM_SCANNER_SIMD)
+        if (try_skip && 0 == *padding &&
+            available + (AERON_TERM_SCANNER_SIMD_FRAMES * (size_t)aligned_frame_length) <= limit)
+        {
+            available = (size_t)aeron_term_scanner_skip_uniform_frames(
+                buffer, (int32_t)available, (int32_t)limit, frame_length, true);
+            try_skip = false;
+        }
+#endif
     }
     while (0 == *padding && available < limit);
 
@@ -16,6 +16,7 @@
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 #include "aeron_socket.h"
 #include "aeron_system_counters.h"
 #include "util/aeron_netutil.h"
@@ -63,9 +64,10 @@ int aeron_receive_channel_endpoint_create(
     _endpoint->conductor_fields.managed_resource.registration_id = -1;
     _endpoint->conductor_fields.status = AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_ACTIVE;
     _endpoint->transport.fd = -1;
+    _endpoint->transport_bindings = context->udp_channel_transport_bindings;
     _endpoint->channel_status.counter_id = -1;
 
-    if (aeron_udp_channel_transport_init(
+    if (_endpoint->transport_bindings->init_func(
         &_endpoint->transport,
         &channel->remote_data,
         &channel->local_data,
@@ -78,12 +80,17 @@ int aeron_receive_channel_endpoint_create(
         return -1;
     }
 
-    if (aeron_udp_channel_transport_get_so_rcvbuf(&_endpoint->transport, &_endpoint->so_rcvbuf) < 0)
+    if (_endpoint->transport_bindings->get_so_rcvbuf_func(&_endpoint->transport, &_endpoint->so_rcvbuf) < 0)
     {
         aeron_receive_channel_endpoint_delete(NULL, _endpoint);
         return -1;
     }
 
+    if (context->socket_udp_gro && NULL != _endpoint->transport_bindings->try_enable_gro_func)
+    {
+        _endpoint->transport_bindings->try_enable_gro_func(&_endpoint->transport);
+    }
+
     _endpoint->transport.dispatch_clientd = _endpoint;
     _endpoint->has_receiver_released = false;
 
@@ -91,6 +98,8 @@ int aeron_receive_channel_endpoint_create(
     _endpoint->channel_status.value_addr = status_indicator->value_addr;
 
     _endpoint->receiver_id = context->receiver_id;
+    _endpoint->group_tag = channel->group_tag;
+    _endpoint->has_group_tag = channel->has_group_tag;
     _endpoint->receiver_proxy = context->receiver_proxy;
 
     _endpoint->short_sends_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS);
@@ -122,7 +131,7 @@ int aeron_receive_channel_endpoint_delete(
     aeron_int64_to_ptr_hash_map_delete(&endpoint->stream_id_to_refcnt_map);
     aeron_data_packet_dispatcher_close(&endpoint->dispatcher);
     aeron_udp_channel_delete(endpoint->conductor_fields.udp_channel);
-    aeron_udp_channel_transport_close(&endpoint->transport);
+    endpoint->transport_bindings->close_func(&endpoint->transport);
     aeron_free(endpoint);
 
     return 0;
@@ -130,7 +139,7 @@ int aeron_receive_channel_endpoint_delete(
 
 int aeron_receive_channel_endpoint_sendmsg(aeron_receive_channel_endpoint_t *endpoint, struct msghdr *msghdr)
 {
-    return aeron_udp_channel_transport_sendmsg(&endpoint->transport, msghdr);
+    return endpoint->transport_bindings->sendmsg_func(&endpoint->transport, msghdr);
 }
 
 int aeron_receive_channel_endpoint_send_sm(
@@ -143,12 +152,15 @@ int aeron_receive_channel_endpoint_send_sm(
     int32_t receiver_window,
     uint8_t flags)
 {
-    uint8_t buffer[sizeof(aeron_status_message_header_t)];
+    uint8_t buffer[sizeof(aeron_status_message_header_t) + AERON_STATUS_MESSAGE_GROUP_TAG_LENGTH];
     aeron_status_message_header_t *sm_header = (aeron_status_message_header_t *) buffer;
+    const size_t frame_length = endpoint->has_group_tag ?
+        sizeof(aeron_status_message_header_t) + AERON_STATUS_MESSAGE_GROUP_TAG_LENGTH :
+        sizeof(aeron_status_message_header_t);
     struct iovec iov[1];
     struct msghdr msghdr;
 
-    sm_header->frame_header.frame_length = sizeof(aeron_status_message_header_t);
+    sm_header->frame_header.frame_length = (int32_t)frame_length;
     sm_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
     sm_header->frame_header.flags = flags;
     sm_header->frame_header.type = AERON_HDR_TYPE_SM;
@@ -159,8 +171,13 @@ int aeron_receive_channel_endpoint_send_sm(
     sm_header->receiver_window = receiver_window;
     sm_header->receiver_id = endpoint->receiver_id;
 
+    if (endpoint->has_group_tag)
+    {
+        memcpy(buffer + sizeof(aeron_status_message_header_t), &endpoint->group_tag, sizeof(endpoint->group_tag));
+    }
+
     iov[0].iov_base = buffer;
-    iov[0].iov_len = sizeof(aeron_status_message_header_t);
+    iov[0].iov_len = frame_length;
     msghdr.msg_iov = iov;
     msghdr.msg_iovlen = 1;
     msghdr.msg_flags = 0;
@@ -227,6 +244,55 @@ int aeron_receive_channel_endpoint_send_nak(
     return bytes_sent;
 }
 
+int aeron_receive_channel_endpoint_send_nak_list(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    int32_t term_id,
+    const aeron_nak_range_t *ranges,
+    size_t range_count)
+{
+    uint8_t buffer[sizeof(aeron_nak_list_header_t) + (AERON_NAK_LIST_MAX_RANGES * sizeof(aeron_nak_range_t))];
+    aeron_nak_list_header_t *nak_list_header = (aeron_nak_list_header_t *) buffer;
+    struct iovec iov[1];
+    struct msghdr msghdr;
+
+    range_count = range_count < AERON_NAK_LIST_MAX_RANGES ? range_count : AERON_NAK_LIST_MAX_RANGES;
+    const size_t frame_length = sizeof(aeron_nak_list_header_t) + (range_count * sizeof(aeron_nak_range_t));
+
+    nak_list_header->frame_header.frame_length = (int32_t)frame_length;
+    nak_list_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    nak_list_header->frame_header.flags = 0;
+    nak_list_header->frame_header.type = AERON_HDR_TYPE_NAK_LIST;
+    nak_list_header->session_id = session_id;
+    nak_list_header->stream_id = stream_id;
+    nak_list_header->term_id = term_id;
+    nak_list_header->range_count = (int32_t)range_count;
+    memcpy(buffer + sizeof(aeron_nak_list_header_t), ranges, range_count * sizeof(aeron_nak_range_t));
+
+    iov[0].iov_base = buffer;
+    iov[0].iov_len = frame_length;
+    msghdr.msg_iov = iov;
+    msghdr.msg_iovlen = 1;
+    msghdr.msg_flags = 0;
+    msghdr.msg_name = addr;
+    msghdr.msg_namelen = AERON_ADDR_LEN(addr);
+    msghdr.msg_control = NULL;
+    msghdr.msg_controllen = 0;
+
+    int bytes_sent;
+    if ((bytes_sent = aeron_receive_channel_endpoint_sendmsg(endpoint, &msghdr)) != (int) iov[0].iov_len)
+    {
+        if (bytes_sent >= 0)
+        {
+            aeron_counter_increment(endpoint->short_sends_counter, 1);
+        }
+    }
+
+    return bytes_sent;
+}
+
 int aeron_receive_channel_endpoint_send_rttm(
     aeron_receive_channel_endpoint_t *endpoint,
     struct sockaddr_storage *addr,
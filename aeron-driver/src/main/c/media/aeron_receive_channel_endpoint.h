@@ -20,6 +20,7 @@
 #include "aeron_data_packet_dispatcher.h"
 #include "aeron_udp_channel.h"
 #include "aeron_udp_channel_transport.h"
+#include "aeron_udp_channel_transport_bindings.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_driver_context.h"
 #include "aeron_system_counters.h"
@@ -50,12 +51,15 @@ typedef struct aeron_receive_channel_endpoint_stct
     /* uint8_t conductor_fields_pad[(2 * AERON_CACHE_LINE_LENGTH) - sizeof(struct conductor_fields_stct)]; */
 
     aeron_udp_channel_transport_t transport;
+    aeron_udp_channel_transport_bindings_t *transport_bindings;
     aeron_data_packet_dispatcher_t dispatcher;
     aeron_int64_to_ptr_hash_map_t stream_id_to_refcnt_map;
     aeron_counter_t channel_status;
     aeron_driver_receiver_proxy_t *receiver_proxy;
     int64_t receiver_id;
+    int64_t group_tag;
     size_t so_rcvbuf;
+    bool has_group_tag;
     bool has_receiver_released;
 
     int64_t *short_sends_counter;
@@ -94,6 +98,15 @@ int aeron_receive_channel_endpoint_send_nak(
     int32_t term_offset,
     int32_t length);
 
+int aeron_receive_channel_endpoint_send_nak_list(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    int32_t term_id,
+    const aeron_nak_range_t *ranges,
+    size_t range_count);
+
 int aeron_receive_channel_endpoint_send_rttm(
     aeron_receive_channel_endpoint_t *endpoint,
     struct sockaddr_storage *addr,
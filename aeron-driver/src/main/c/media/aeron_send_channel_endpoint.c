@@ -70,7 +70,8 @@ int aeron_send_channel_endpoint_create(
         if (aeron_alloc((void **)&_endpoint->destination_tracker, sizeof(aeron_udp_destination_tracker_t)) < 0 ||
             aeron_udp_destination_tracker_init(
                 _endpoint->destination_tracker,
-                context->nano_clock,
+                context->udp_channel_transport_bindings,
+                &context->sender_cached_clock,
                 destination_timeout_ns) < 0)
         {
             return -1;
@@ -85,9 +86,10 @@ int aeron_send_channel_endpoint_create(
     _endpoint->conductor_fields.managed_resource.registration_id = -1;
     _endpoint->conductor_fields.status = AERON_SEND_CHANNEL_ENDPOINT_STATUS_ACTIVE;
     _endpoint->transport.fd = -1;
+    _endpoint->transport_bindings = context->udp_channel_transport_bindings;
     _endpoint->channel_status.counter_id = -1;
 
-    if (aeron_udp_channel_transport_init(
+    if (_endpoint->transport_bindings->init_func(
         &_endpoint->transport,
         (channel->multicast) ? &channel->remote_control : &channel->local_control,
         (channel->multicast) ? &channel->local_control : &channel->remote_control,
@@ -100,6 +102,11 @@ int aeron_send_channel_endpoint_create(
         return -1;
     }
 
+    if (context->socket_udp_gso && NULL != _endpoint->transport_bindings->try_enable_gso_func)
+    {
+        _endpoint->transport_bindings->try_enable_gso_func(&_endpoint->transport);
+    }
+
     if (aeron_int64_to_ptr_hash_map_init(
         &_endpoint->publication_dispatch_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
@@ -129,7 +136,7 @@ int aeron_send_channel_endpoint_delete(
 
     aeron_int64_to_ptr_hash_map_delete(&endpoint->publication_dispatch_map);
     aeron_udp_channel_delete(endpoint->conductor_fields.udp_channel);
-    aeron_udp_channel_transport_close(&endpoint->transport);
+    endpoint->transport_bindings->close_func(&endpoint->transport);
 
     if (NULL != endpoint->destination_tracker)
     {
@@ -173,7 +180,7 @@ int aeron_send_channel_sendmmsg(aeron_send_channel_endpoint_t *endpoint, struct
             mmsghdr[i].msg_hdr.msg_namelen = AERON_ADDR_LEN(&endpoint->conductor_fields.udp_channel->remote_data);
         }
 
-        result = aeron_udp_channel_transport_sendmmsg(&endpoint->transport, mmsghdr, vlen);
+        result = endpoint->transport_bindings->sendmmsg_func(&endpoint->transport, mmsghdr, vlen);
     }
     else
     {
@@ -193,7 +200,7 @@ int aeron_send_channel_sendmsg(aeron_send_channel_endpoint_t *endpoint, struct m
         msghdr->msg_name = &endpoint->conductor_fields.udp_channel->remote_data;
         msghdr->msg_namelen = AERON_ADDR_LEN(&endpoint->conductor_fields.udp_channel->remote_data);
 
-        result = aeron_udp_channel_transport_sendmsg(&endpoint->transport, msghdr);
+        result = endpoint->transport_bindings->sendmsg_func(&endpoint->transport, msghdr);
     }
     else
     {
@@ -253,6 +260,18 @@ void aeron_send_channel_endpoint_dispatch(
             }
             break;
 
+        case AERON_HDR_TYPE_NAK_LIST:
+            if (aeron_send_channel_endpoint_is_valid_nak_list(buffer, length))
+            {
+                aeron_send_channel_endpoint_on_nak_list(endpoint, buffer, length, addr);
+                aeron_counter_ordered_increment(sender->nak_messages_received_counter, 1);
+            }
+            else
+            {
+                aeron_counter_increment(sender->invalid_frames_counter, 1);
+            }
+            break;
+
         case AERON_HDR_TYPE_SM:
             if (length >= sizeof(aeron_status_message_header_t))
             {
@@ -296,6 +315,25 @@ void aeron_send_channel_endpoint_on_nak(
     }
 }
 
+void aeron_send_channel_endpoint_on_nak_list(
+    aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    aeron_nak_list_header_t *nak_list_header = (aeron_nak_list_header_t *)buffer;
+    int64_t key_value =
+        aeron_int64_to_ptr_hash_map_compound_key(nak_list_header->stream_id, nak_list_header->session_id);
+    aeron_network_publication_t *publication =
+        aeron_int64_to_ptr_hash_map_get(&endpoint->publication_dispatch_map, key_value);
+
+    if (NULL != publication)
+    {
+        aeron_network_publication_on_nak_list(
+            publication,
+            nak_list_header->term_id,
+            (aeron_nak_range_t *)(buffer + sizeof(aeron_nak_list_header_t)),
+            (size_t)nak_list_header->range_count);
+    }
+}
+
 void aeron_send_channel_endpoint_publication_trigger_send_setup_frame(
     void *clientd, int64_t key, void *value)
 {
@@ -363,8 +401,12 @@ extern bool aeron_send_channel_endpoint_has_sender_released(aeron_send_channel_e
 extern int aeron_send_channel_endpoint_add_destination(
     aeron_send_channel_endpoint_t *endpoint, struct sockaddr_storage *addr);
 
+extern int aeron_send_channel_endpoint_check_destinations(aeron_send_channel_endpoint_t *endpoint);
+
 extern int aeron_send_channel_endpoint_remove_destination(
     aeron_send_channel_endpoint_t *endpoint, struct sockaddr_storage *addr);
 
+extern bool aeron_send_channel_endpoint_is_valid_nak_list(const uint8_t *buffer, size_t length);
+
 extern bool aeron_send_channel_endpoint_tags_match(
     aeron_send_channel_endpoint_t *endpoint, aeron_udp_channel_t *channel);
@@ -18,11 +18,13 @@
 #define AERON_SEND_CHANNEL_ENDPOINT_H
 
 #include "collections/aeron_int64_to_ptr_hash_map.h"
+#include "protocol/aeron_udp_protocol.h"
 #include "util/aeron_netutil.h"
 #include "aeron_network_publication.h"
 #include "aeron_driver_context.h"
 #include "aeron_udp_channel.h"
 #include "aeron_udp_channel_transport.h"
+#include "aeron_udp_channel_transport_bindings.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_udp_destination_tracker.h"
 #include "aeron_driver_sender_proxy.h"
@@ -50,6 +52,7 @@ typedef struct aeron_send_channel_endpoint_stct
 
     bool has_sender_released;
     aeron_udp_channel_transport_t transport;
+    aeron_udp_channel_transport_bindings_t *transport_bindings;
     aeron_counter_t channel_status;
     aeron_udp_destination_tracker_t *destination_tracker;
     aeron_driver_sender_proxy_t *sender_proxy;
@@ -83,6 +86,9 @@ void aeron_send_channel_endpoint_dispatch(
 void aeron_send_channel_endpoint_on_nak(
     aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
+void aeron_send_channel_endpoint_on_nak_list(
+    aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
+
 void aeron_send_channel_endpoint_on_status_message(
     aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
@@ -108,10 +114,31 @@ inline int aeron_send_channel_endpoint_add_destination(
     return aeron_udp_destination_tracker_add_destination(endpoint->destination_tracker, 0, INT64_MAX, addr);
 }
 
+inline int aeron_send_channel_endpoint_check_destinations(aeron_send_channel_endpoint_t *endpoint)
+{
+    aeron_udp_destination_tracker_t *tracker = endpoint->destination_tracker;
+
+    return aeron_udp_destination_tracker_check_for_expiry(tracker, aeron_clock_cached_nano_time(tracker->cached_clock));
+}
+
 inline int aeron_send_channel_endpoint_remove_destination(
     aeron_send_channel_endpoint_t *endpoint, struct sockaddr_storage *addr)
 {
     return aeron_udp_destination_tracker_remove_destination(endpoint->destination_tracker, addr);
 }
 
+inline bool aeron_send_channel_endpoint_is_valid_nak_list(const uint8_t *buffer, size_t length)
+{
+    if (length < sizeof(aeron_nak_list_header_t))
+    {
+        return false;
+    }
+
+    const int32_t range_count = ((const aeron_nak_list_header_t *)buffer)->range_count;
+
+    return range_count > 0 &&
+        range_count <= AERON_NAK_LIST_MAX_RANGES &&
+        length >= sizeof(aeron_nak_list_header_t) + ((size_t)range_count * sizeof(aeron_nak_range_t));
+}
+
 #endif //AERON_SEND_CHANNEL_ENDPOINT_H
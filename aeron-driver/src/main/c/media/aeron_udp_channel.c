@@ -230,6 +230,8 @@ int aeron_udp_channel_parse(size_t uri_length, const char *uri, aeron_udp_channe
     _channel->explicit_control = false;
     _channel->multicast = false;
     _channel->tag_id = AERON_URI_INVALID_TAG;
+    _channel->group_tag = 0;
+    _channel->has_group_tag = false;
 
     if (_channel->uri.type != AERON_URI_UDP)
     {
@@ -286,6 +288,23 @@ int aeron_udp_channel_parse(size_t uri_length, const char *uri, aeron_udp_channe
         }
     }
 
+    const char *group_tag_str = aeron_uri_find_param_value(
+        &_channel->uri.params.udp.additional_params, AERON_URI_GROUP_TAG_KEY);
+    if (NULL != group_tag_str)
+    {
+        char *end_ptr = NULL;
+
+        errno = 0;
+        _channel->group_tag = strtoll(group_tag_str, &end_ptr, 10);
+        if (0 != errno || end_ptr == group_tag_str || '\0' != *end_ptr)
+        {
+            aeron_set_err(EINVAL, "could not parse group tag string: %s", group_tag_str);
+            goto error_cleanup;
+        }
+
+        _channel->has_group_tag = true;
+    }
+
     if (aeron_is_addr_multicast(&endpoint_addr))
     {
         memcpy(&_channel->remote_data, &endpoint_addr, AERON_ADDR_LEN(&endpoint_addr));
@@ -31,12 +31,14 @@ typedef struct aeron_udp_channel_stct
     struct sockaddr_storage remote_control;
     struct sockaddr_storage local_control;
     int64_t tag_id;
+    int64_t group_tag;
     unsigned int interface_index;
     size_t uri_length;
     size_t canonical_length;
     uint8_t multicast_ttl;
     bool explicit_control;
     bool multicast;
+    bool has_group_tag;
 }
 aeron_udp_channel_t;
 
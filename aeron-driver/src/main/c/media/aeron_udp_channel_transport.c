@@ -36,6 +36,17 @@
 #include "aeron_udp_channel_transport.h"
 #include "concurrent/aeron_thread.h"
 
+#if defined(__linux__)
+#include <netinet/udp.h>
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT (103)
+#endif
+#if !defined(UDP_GRO)
+#define UDP_GRO (104)
+#endif
+#define AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_SUPPORTED
+#endif
+
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
 {
@@ -58,6 +69,9 @@ int aeron_udp_channel_transport_init(
     struct sockaddr_in6 *in6 = (struct sockaddr_in6 *)bind_addr;
 
     transport->fd = -1;
+    transport->bindings_clientd = NULL;
+    transport->gso_enabled = false;
+    transport->gro_enabled = false;
     if ((transport->fd = aeron_socket(bind_addr->ss_family, SOCK_DGRAM, 0)) < 0)
     {
         goto error;
@@ -250,10 +264,83 @@ int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport)
     return 0;
 }
 
+size_t aeron_udp_channel_transport_segment_length(
+    aeron_udp_channel_transport_t *transport, struct msghdr *message, size_t length)
+{
+#if defined(AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_SUPPORTED)
+    if (transport->gro_enabled && NULL != message->msg_control)
+    {
+        struct cmsghdr *cmsg;
+
+        for (cmsg = CMSG_FIRSTHDR(message); NULL != cmsg; cmsg = CMSG_NXTHDR(message, cmsg))
+        {
+            if (IPPROTO_UDP == cmsg->cmsg_level && UDP_GRO == cmsg->cmsg_type)
+            {
+                int gso_size;
+
+                memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+                return gso_size > 0 ? (size_t)gso_size : length;
+            }
+        }
+    }
+#endif
+
+    return length;
+}
+
+void aeron_udp_channel_transport_dispatch_segments(
+    aeron_udp_channel_transport_t *transport,
+    uint8_t *buffer,
+    size_t length,
+    size_t segment_length,
+    struct sockaddr_storage *addr,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    for (size_t offset = 0; offset < length; offset += segment_length)
+    {
+        const size_t remaining = length - offset;
+
+        recv_func(
+            clientd,
+            transport->dispatch_clientd,
+            buffer + offset,
+            remaining < segment_length ? remaining : segment_length,
+            addr);
+    }
+}
+
+inline static void aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msg,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    const size_t length = msg->msg_len;
+
+    aeron_udp_channel_transport_dispatch_segments(
+        transport,
+        msg->msg_hdr.msg_iov[0].iov_base,
+        length,
+        aeron_udp_channel_transport_segment_length(transport, &msg->msg_hdr, length),
+        msg->msg_hdr.msg_name,
+        recv_func,
+        clientd);
+
+    *bytes_rcved += length;
+    msg->msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+    if (NULL != msg->msg_hdr.msg_control)
+    {
+        msg->msg_hdr.msg_controllen = AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH;
+    }
+}
+
 int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *msgvec,
     size_t vlen,
+    int64_t *bytes_rcved,
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd)
 {
@@ -281,12 +368,7 @@ int aeron_udp_channel_transport_recvmmsg(
     {
         for (size_t i = 0, length = result; i < length; i++)
         {
-            recv_func(
-                clientd,
-                transport->dispatch_clientd,
-                msgvec[i].msg_hdr.msg_iov[0].iov_base,
-                msgvec[i].msg_len,
-                msgvec[i].msg_hdr.msg_name);
+            aeron_udp_channel_transport_dispatch(transport, &msgvec[i], bytes_rcved, recv_func, clientd);
         }
 
         return result;
@@ -316,12 +398,7 @@ int aeron_udp_channel_transport_recvmmsg(
         }
 
         msgvec[i].msg_len = (unsigned int)result;
-        recv_func(
-            clientd,
-            transport->dispatch_clientd,
-            msgvec[i].msg_hdr.msg_iov[0].iov_base,
-            msgvec[i].msg_len,
-            msgvec[i].msg_hdr.msg_name);
+        aeron_udp_channel_transport_dispatch(transport, &msgvec[i], bytes_rcved, recv_func, clientd);
         work_count++;
     }
 
@@ -383,6 +460,47 @@ int aeron_udp_channel_transport_sendmsg(
     return (int)sendmsg_result;
 }
 
+bool aeron_udp_channel_transport_try_enable_gso(aeron_udp_channel_transport_t *transport)
+{
+#if defined(AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_SUPPORTED)
+    int segment_length = 0;
+
+    /* a zero socket-level segment size leaves plain sends untouched and only probes for kernel support */
+    transport->gso_enabled =
+        setsockopt(transport->fd, IPPROTO_UDP, UDP_SEGMENT, &segment_length, sizeof(segment_length)) == 0;
+#endif
+
+    return transport->gso_enabled;
+}
+
+bool aeron_udp_channel_transport_try_enable_gro(aeron_udp_channel_transport_t *transport)
+{
+#if defined(AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_SUPPORTED)
+    int enable = 1;
+
+    transport->gro_enabled = setsockopt(transport->fd, IPPROTO_UDP, UDP_GRO, &enable, sizeof(enable)) == 0;
+#endif
+
+    return transport->gro_enabled;
+}
+
+void aeron_udp_channel_transport_set_gso_segment_length(
+    struct msghdr *message, uint8_t *control, size_t segment_length)
+{
+#if defined(AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_SUPPORTED)
+    uint16_t gso_size = (uint16_t)segment_length;
+
+    message->msg_control = control;
+    message->msg_controllen = CMSG_SPACE(sizeof(gso_size));
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(message);
+    cmsg->cmsg_level = IPPROTO_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(gso_size));
+    memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+#endif
+}
+
 int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf)
 {
     socklen_t len = sizeof(size_t);
@@ -21,10 +21,16 @@
 
 #include "aeron_driver_common.h"
 
+#define AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH (64)
+#define AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_SEGMENTS (64)
+
 typedef struct aeron_udp_channel_transport_stct
 {
     aeron_fd_t fd;
     void *dispatch_clientd;
+    void *bindings_clientd;
+    bool gso_enabled;
+    bool gro_enabled;
 }
 aeron_udp_channel_transport_t;
 
@@ -47,6 +53,7 @@ int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *msgvec,
     size_t vlen,
+    int64_t *bytes_rcved,
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd);
 
@@ -59,6 +66,51 @@ int aeron_udp_channel_transport_sendmsg(
     aeron_udp_channel_transport_t *transport,
     struct msghdr *message);
 
+/**
+ * Attempt to enable UDP generic segmentation offload (UDP_SEGMENT) on the transport. Where the platform or kernel
+ * does not support it the transport is left unchanged and will send one datagram per message.
+ *
+ * @param transport to enable GSO on.
+ * @return true if GSO is enabled.
+ */
+bool aeron_udp_channel_transport_try_enable_gso(aeron_udp_channel_transport_t *transport);
+
+/**
+ * Attempt to enable UDP generic receive offload (UDP_GRO) on the transport. Coalesced datagrams are split back into
+ * their original segments before dispatch. Receivers must supply AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH bytes of
+ * msg_control per message for the segment size to be reported.
+ *
+ * @param transport to enable GRO on.
+ * @return true if GRO is enabled.
+ */
+bool aeron_udp_channel_transport_try_enable_gro(aeron_udp_channel_transport_t *transport);
+
+/**
+ * Mark a message as a GSO send of segments of segment_length using the supplied control buffer, which must be at least
+ * AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH in length.
+ */
+void aeron_udp_channel_transport_set_gso_segment_length(
+    struct msghdr *message, uint8_t *control, size_t segment_length);
+
+/**
+ * Length of the segments within a received datagram of length bytes, which is only less than length when the kernel
+ * has coalesced several datagrams with GRO and reported the segment size in the control messages of message.
+ */
+size_t aeron_udp_channel_transport_segment_length(
+    aeron_udp_channel_transport_t *transport, struct msghdr *message, size_t length);
+
+/**
+ * Dispatch a received buffer to recv_func one segment at a time.
+ */
+void aeron_udp_channel_transport_dispatch_segments(
+    aeron_udp_channel_transport_t *transport,
+    uint8_t *buffer,
+    size_t length,
+    size_t segment_length,
+    struct sockaddr_storage *addr,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
 int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf);
 
 #endif //AERON_UDP_CHANNEL_TRANSPORT_H
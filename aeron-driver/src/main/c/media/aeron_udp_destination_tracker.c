@@ -33,13 +33,19 @@ struct mmsghdr
 #endif
 
 int aeron_udp_destination_tracker_init(
-    aeron_udp_destination_tracker_t *tracker, aeron_clock_func_t clock, int64_t timeout_ns)
+    aeron_udp_destination_tracker_t *tracker,
+    aeron_udp_channel_transport_bindings_t *transport_bindings,
+    aeron_clock_cache_t *cached_clock,
+    int64_t timeout_ns)
 {
-    tracker->nano_clock = clock;
+    tracker->transport_bindings = transport_bindings;
+    tracker->cached_clock = cached_clock;
     tracker->destination_timeout_ns = timeout_ns;
     tracker->destinations.array = NULL;
     tracker->destinations.length = 0;
     tracker->destinations.capacity = 0;
+    tracker->fanout.msgvec = NULL;
+    tracker->fanout.capacity = 0;
     tracker->is_manual_control_mode =
         timeout_ns == AERON_UDP_DESTINATION_TRACKER_MANUAL_DESTINATION_TIMEOUT_NS ? true : false;
 
@@ -51,56 +57,173 @@ int aeron_udp_destination_tracker_close(aeron_udp_destination_tracker_t *tracker
     if (NULL != tracker)
     {
         aeron_free(tracker->destinations.array);
+        aeron_free(tracker->fanout.msgvec);
+    }
+
+    return 0;
+}
+
+static int aeron_udp_destination_tracker_ensure_fanout_capacity(
+    aeron_udp_destination_tracker_t *tracker, size_t required_capacity)
+{
+    if (required_capacity > tracker->fanout.capacity)
+    {
+        if (aeron_reallocf((void **)&tracker->fanout.msgvec, required_capacity * sizeof(struct mmsghdr)) < 0)
+        {
+            tracker->fanout.capacity = 0;
+            return -1;
+        }
+
+        tracker->fanout.capacity = required_capacity;
     }
 
     return 0;
 }
 
+/*
+ * sendmmsg stops at the first message it fails to send, that message is stepped past and the rest of the vector is
+ * still sent so one failing destination cannot starve those after it. Failed messages are left with a msg_len of 0.
+ */
+static int aeron_udp_destination_tracker_send_fanout(
+    aeron_udp_destination_tracker_t *tracker, aeron_udp_channel_transport_t *transport, size_t total_messages)
+{
+    size_t index = 0, messages_sent = 0;
+    int error_result = 0;
+
+    while (index < total_messages)
+    {
+        const size_t remaining = total_messages - index;
+        const size_t chunk_length = remaining < AERON_UDP_DESTINATION_TRACKER_FANOUT_MAX_MESSAGES ?
+            remaining : AERON_UDP_DESTINATION_TRACKER_FANOUT_MAX_MESSAGES;
+
+        const int sendmmsg_result = tracker->transport_bindings->sendmmsg_func(
+            transport, &tracker->fanout.msgvec[index], chunk_length);
+
+        if (sendmmsg_result < 0)
+        {
+            error_result = sendmmsg_result;
+            index++;
+            continue;
+        }
+
+        messages_sent += (size_t)sendmmsg_result;
+        index += (size_t)sendmmsg_result;
+
+        if ((size_t)sendmmsg_result < chunk_length)
+        {
+            index++;
+        }
+    }
+
+    return 0 == messages_sent ? error_result : (int)messages_sent;
+}
+
 int aeron_udp_destination_tracker_sendmmsg(
     aeron_udp_destination_tracker_t *tracker,
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *mmsghdr, size_t vlen)
 {
-    int64_t now_ns = tracker->nano_clock();
-    int min_msgs_sent = (int)vlen;
+    const size_t num_destinations = tracker->destinations.length;
+    const size_t total_messages = num_destinations * vlen;
 
-    for (int last_index = (int)tracker->destinations.length - 1, i = last_index; i >= 0; i--)
+    if (0 == num_destinations)
     {
-        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
+        return (int)vlen;
+    }
 
-        if (now_ns > (entry->time_of_last_activity_ns + tracker->destination_timeout_ns))
+    if (aeron_udp_destination_tracker_ensure_fanout_capacity(tracker, total_messages) < 0)
+    {
+        return -1;
+    }
+
+    struct mmsghdr *fanout = tracker->fanout.msgvec;
+    for (size_t j = 0, k = 0; j < vlen; j++)
+    {
+        for (size_t i = 0; i < num_destinations; i++, k++)
         {
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)tracker->destinations.array,
-                sizeof(aeron_udp_destination_entry_t),
-                (size_t)i,
-                (size_t)last_index);
-            last_index--;
-            tracker->destinations.length--;
+            aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
+
+            fanout[k].msg_hdr = mmsghdr[j].msg_hdr;
+            fanout[k].msg_hdr.msg_name = &entry->addr;
+            fanout[k].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
+            fanout[k].msg_len = 0;
         }
-        else
+    }
+
+    const int messages_sent = aeron_udp_destination_tracker_send_fanout(tracker, transport, total_messages);
+    if (messages_sent < 0)
+    {
+        return messages_sent;
+    }
+
+    size_t frames_sent = 0;
+    for (size_t j = 0, k = 0; j < vlen; j++)
+    {
+        bool is_sent_to_all = true;
+
+        mmsghdr[j].msg_len = 0;
+        for (size_t i = 0; i < num_destinations; i++, k++)
         {
-            for (size_t j = 0; j < vlen; j++)
+            if (0 == fanout[k].msg_len)
             {
-                mmsghdr[j].msg_hdr.msg_name = &entry->addr;
-                mmsghdr[j].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
-                mmsghdr[j].msg_len = 0;
+                is_sent_to_all = false;
+            }
+            else if (0 == mmsghdr[j].msg_len)
+            {
+                mmsghdr[j].msg_len = fanout[k].msg_len;
             }
-
-            const int sendmmsg_result = aeron_udp_channel_transport_sendmmsg(transport, mmsghdr, vlen);
-
-            min_msgs_sent = sendmmsg_result < min_msgs_sent ? sendmmsg_result : min_msgs_sent;
         }
+
+        frames_sent += is_sent_to_all ? 1 : 0;
     }
 
-    return min_msgs_sent;
+    return (int)frames_sent;
 }
 
 int aeron_udp_destination_tracker_sendmsg(
     aeron_udp_destination_tracker_t *tracker, aeron_udp_channel_transport_t *transport, struct msghdr *msghdr)
 {
-    int64_t now_ns = tracker->nano_clock();
-    int min_bytes_sent = (int)msghdr->msg_iov->iov_len;
+    const size_t num_destinations = tracker->destinations.length;
+    const int length = (int)msghdr->msg_iov->iov_len;
+
+    if (0 == num_destinations)
+    {
+        return length;
+    }
+
+    if (aeron_udp_destination_tracker_ensure_fanout_capacity(tracker, num_destinations) < 0)
+    {
+        return -1;
+    }
+
+    struct mmsghdr *fanout = tracker->fanout.msgvec;
+    for (size_t i = 0; i < num_destinations; i++)
+    {
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
+
+        fanout[i].msg_hdr = *msghdr;
+        fanout[i].msg_hdr.msg_name = &entry->addr;
+        fanout[i].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
+        fanout[i].msg_len = 0;
+    }
+
+    const int messages_sent = aeron_udp_destination_tracker_send_fanout(tracker, transport, num_destinations);
+    if (messages_sent < 0)
+    {
+        return messages_sent;
+    }
+
+    return (size_t)messages_sent == num_destinations ? length : 0;
+}
+
+int aeron_udp_destination_tracker_check_for_expiry(aeron_udp_destination_tracker_t *tracker, int64_t now_ns)
+{
+    int removed = 0;
+
+    if (tracker->is_manual_control_mode)
+    {
+        return 0;
+    }
 
     for (int last_index = (int)tracker->destinations.length - 1, i = last_index; i >= 0; i--)
     {
@@ -115,19 +238,11 @@ int aeron_udp_destination_tracker_sendmsg(
                 (size_t)last_index);
             last_index--;
             tracker->destinations.length--;
-        }
-        else
-        {
-            msghdr->msg_name = &entry->addr;
-            msghdr->msg_namelen = AERON_ADDR_LEN(&entry->addr);
-
-            const int sendmsg_result = aeron_udp_channel_transport_sendmsg(transport, msghdr);
-
-            min_bytes_sent = sendmsg_result < min_bytes_sent ? sendmsg_result : min_bytes_sent;
+            removed++;
         }
     }
 
-    return min_bytes_sent;
+    return removed;
 }
 
 bool aeron_udp_destination_tracker_same_port(struct sockaddr_storage *lhs, struct sockaddr_storage *rhs)
@@ -160,7 +275,7 @@ int aeron_udp_destination_tracker_on_status_message(
     if (tracker->destination_timeout_ns > 0)
     {
         aeron_status_message_header_t *status_message_header = (aeron_status_message_header_t *)buffer;
-        const int64_t now_ns = tracker->nano_clock();
+        const int64_t now_ns = aeron_clock_cached_nano_time(tracker->cached_clock);
         const int64_t receiver_id = status_message_header->receiver_id;
         bool is_existing = false;
 
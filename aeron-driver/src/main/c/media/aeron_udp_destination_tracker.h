@@ -20,9 +20,12 @@
 #include "aeron_socket.h"
 #include "aeronmd.h"
 #include "aeron_udp_channel_transport.h"
+#include "aeron_udp_channel_transport_bindings.h"
+#include "util/aeron_clock.h"
 
 #define AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS (5 * 1000 * 1000 * 1000L)
 #define AERON_UDP_DESTINATION_TRACKER_MANUAL_DESTINATION_TIMEOUT_NS (0L)
+#define AERON_UDP_DESTINATION_TRACKER_FANOUT_MAX_MESSAGES (1024)
 
 typedef struct aeron_udp_destination_entry_stct
 {
@@ -42,21 +45,44 @@ typedef struct aeron_udp_destination_tracker_stct
     }
     destinations;
 
+    struct aeron_udp_destination_tracker_fanout_stct
+    {
+        struct mmsghdr *msgvec;
+        size_t capacity;
+    }
+    fanout;
+
     bool is_manual_control_mode;
-    aeron_clock_func_t nano_clock;
+    aeron_udp_channel_transport_bindings_t *transport_bindings;
+    aeron_clock_cache_t *cached_clock;
     int64_t destination_timeout_ns;
 }
 aeron_udp_destination_tracker_t;
 
 int aeron_udp_destination_tracker_init(
-    aeron_udp_destination_tracker_t *tracker, aeron_clock_func_t clock, int64_t timeout_ns);
+    aeron_udp_destination_tracker_t *tracker,
+    aeron_udp_channel_transport_bindings_t *transport_bindings,
+    aeron_clock_cache_t *cached_clock,
+    int64_t timeout_ns);
 int aeron_udp_destination_tracker_close(aeron_udp_destination_tracker_t *tracker);
 
+/*
+ * Every frame is sent to every destination from a single combined vector ordered frame by frame, so a batch costs one
+ * sendmmsg per AERON_UDP_DESTINATION_TRACKER_FANOUT_MAX_MESSAGES rather than one per destination. A destination that
+ * fails is skipped and the remaining destinations are still sent to. The result is the number of frames that reached
+ * all destinations, or -1 if nothing could be sent.
+ */
 int aeron_udp_destination_tracker_sendmmsg(
     aeron_udp_destination_tracker_t *tracker, aeron_udp_channel_transport_t *transport, struct mmsghdr *mmsghdr, size_t vlen);
 int aeron_udp_destination_tracker_sendmsg(
     aeron_udp_destination_tracker_t *tracker, aeron_udp_channel_transport_t *transport, struct msghdr *msghdr);
 
+/*
+ * Remove dynamic destinations which have not sent a status message within the timeout. Driven from the conductor
+ * timer via the sender proxy so the send path never scans for expiry.
+ */
+int aeron_udp_destination_tracker_check_for_expiry(aeron_udp_destination_tracker_t *tracker, int64_t now_ns);
+
 int aeron_udp_destination_tracker_on_status_message(
     aeron_udp_destination_tracker_t *tracker, const uint8_t *buffer, size_t len, struct sockaddr_storage *addr);
 
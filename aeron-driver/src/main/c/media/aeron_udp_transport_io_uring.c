@@ -0,0 +1,592 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <string.h>
+#include <inttypes.h>
+#include "util/aeron_error.h"
+#include "media/aeron_udp_transport_io_uring.h"
+
+#if defined(HAVE_IO_URING)
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include "aeron_alloc.h"
+#include "util/aeron_bitutil.h"
+#include "concurrent/aeron_atomic.h"
+#include "collections/aeron_int64_to_ptr_hash_map.h"
+
+#define AERON_UDP_TRANSPORT_IO_URING_ENTRIES (256)
+#define AERON_UDP_TRANSPORT_IO_URING_BUFFER_GROUP_ID (0)
+#define AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA (0)
+
+struct aeron_udp_transport_io_uring_stct
+{
+    int ring_fd;
+
+    struct aeron_udp_transport_io_uring_sq_stct
+    {
+        uint32_t *head;
+        uint32_t *tail;
+        uint32_t *ring_mask;
+        uint32_t *array;
+        uint32_t *flags;
+        struct io_uring_sqe *sqes;
+        uint32_t entries;
+        uint32_t pending;
+        void *ring_addr;
+        size_t ring_length;
+        size_t sqes_length;
+    }
+    sq;
+
+    struct aeron_udp_transport_io_uring_cq_stct
+    {
+        uint32_t *head;
+        uint32_t *tail;
+        uint32_t *ring_mask;
+        struct io_uring_cqe *cqes;
+        void *ring_addr;
+        size_t ring_length;
+    }
+    cq;
+
+    struct aeron_udp_transport_io_uring_buffers_stct
+    {
+        struct io_uring_buf_ring *ring;
+        size_t ring_length;
+        uint8_t *buffer;
+        size_t count;
+        size_t stride;
+        uint16_t tail;
+    }
+    buffers;
+
+    struct msghdr recvmsg_template;
+    aeron_int64_to_ptr_hash_map_t transport_by_user_data;
+    int64_t next_user_data;
+};
+
+static int aeron_udp_transport_io_uring_enter(aeron_udp_transport_io_uring_t *io_uring)
+{
+    while (io_uring->sq.pending > 0)
+    {
+        int result = (int)syscall(__NR_io_uring_enter, io_uring->ring_fd, io_uring->sq.pending, 0, 0, NULL, 0);
+        if (result < 0)
+        {
+            int err = errno;
+
+            if (EINTR == err || EAGAIN == err || EBUSY == err)
+            {
+                return 0;
+            }
+
+            aeron_set_err(err, "io_uring_enter: %s", strerror(err));
+            return -1;
+        }
+
+        io_uring->sq.pending -= (uint32_t)result;
+    }
+
+    return 0;
+}
+
+static struct io_uring_sqe *aeron_udp_transport_io_uring_next_sqe(aeron_udp_transport_io_uring_t *io_uring)
+{
+    uint32_t head, tail = *io_uring->sq.tail;
+
+    AERON_GET_VOLATILE(head, *io_uring->sq.head);
+    if (tail - head >= io_uring->sq.entries)
+    {
+        if (aeron_udp_transport_io_uring_enter(io_uring) < 0)
+        {
+            return NULL;
+        }
+
+        AERON_GET_VOLATILE(head, *io_uring->sq.head);
+        if (tail - head >= io_uring->sq.entries)
+        {
+            aeron_set_err(EBUSY, "%s", "io_uring submission queue is full");
+            return NULL;
+        }
+    }
+
+    const uint32_t index = tail & *io_uring->sq.ring_mask;
+    struct io_uring_sqe *sqe = &io_uring->sq.sqes[index];
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    io_uring->sq.array[index] = index;
+    AERON_PUT_ORDERED(*io_uring->sq.tail, tail + 1);
+    io_uring->sq.pending++;
+
+    return sqe;
+}
+
+static int aeron_udp_transport_io_uring_arm(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport, int64_t user_data)
+{
+    struct io_uring_sqe *sqe = aeron_udp_transport_io_uring_next_sqe(io_uring);
+    if (NULL == sqe)
+    {
+        return -1;
+    }
+
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = transport->fd;
+    sqe->addr = (uint64_t)(uintptr_t)&io_uring->recvmsg_template;
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = AERON_UDP_TRANSPORT_IO_URING_BUFFER_GROUP_ID;
+    sqe->user_data = (uint64_t)user_data;
+
+    return 0;
+}
+
+static void aeron_udp_transport_io_uring_recycle(aeron_udp_transport_io_uring_t *io_uring, uint16_t buffer_id)
+{
+    const size_t mask = io_uring->buffers.count - 1;
+    struct io_uring_buf *buf = &io_uring->buffers.ring->bufs[io_uring->buffers.tail & mask];
+
+    /* fields are written individually as the ring tail overlays the resv field of the first entry */
+    buf->addr = (uint64_t)(uintptr_t)(io_uring->buffers.buffer + (buffer_id * io_uring->buffers.stride));
+    buf->len = (uint32_t)io_uring->buffers.stride;
+    buf->bid = buffer_id;
+
+    io_uring->buffers.tail++;
+}
+
+int aeron_udp_transport_io_uring_init(
+    aeron_udp_transport_io_uring_t **io_uring, size_t buffer_count, size_t buffer_length)
+{
+    aeron_udp_transport_io_uring_t *_io_uring = NULL;
+    struct io_uring_params params;
+
+    if (!AERON_IS_POWER_OF_TWO(buffer_count) || buffer_count > AERON_UDP_TRANSPORT_IO_URING_BUFFER_COUNT_MAX)
+    {
+        aeron_set_err(
+            EINVAL, "io_uring buffer count must be a power of 2 and <= %d: %" PRIu64,
+            AERON_UDP_TRANSPORT_IO_URING_BUFFER_COUNT_MAX, (uint64_t)buffer_count);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_io_uring, sizeof(aeron_udp_transport_io_uring_t)) < 0)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not allocate io_uring poller");
+        return -1;
+    }
+
+    _io_uring->ring_fd = -1;
+    _io_uring->sq.ring_addr = MAP_FAILED;
+    _io_uring->sq.sqes = MAP_FAILED;
+    _io_uring->cq.ring_addr = MAP_FAILED;
+    _io_uring->buffers.ring = MAP_FAILED;
+    _io_uring->buffers.buffer = NULL;
+    _io_uring->next_user_data = AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA + 1;
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &_io_uring->transport_by_user_data, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        aeron_free(_io_uring);
+        aeron_set_err(ENOMEM, "%s", "could not allocate io_uring transport map");
+        return -1;
+    }
+
+    memset(&params, 0, sizeof(params));
+    if ((_io_uring->ring_fd = (int)syscall(__NR_io_uring_setup, AERON_UDP_TRANSPORT_IO_URING_ENTRIES, &params)) < 0)
+    {
+        aeron_set_err(errno, "io_uring_setup: %s", strerror(errno));
+        goto error;
+    }
+
+    _io_uring->sq.ring_length = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+    _io_uring->cq.ring_length = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (_io_uring->cq.ring_length > _io_uring->sq.ring_length)
+        {
+            _io_uring->sq.ring_length = _io_uring->cq.ring_length;
+        }
+        _io_uring->cq.ring_length = _io_uring->sq.ring_length;
+    }
+
+    _io_uring->sq.ring_addr = mmap(
+        NULL,
+        _io_uring->sq.ring_length,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        _io_uring->ring_fd,
+        IORING_OFF_SQ_RING);
+    if (MAP_FAILED == _io_uring->sq.ring_addr)
+    {
+        aeron_set_err(errno, "io_uring mmap sq ring: %s", strerror(errno));
+        goto error;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _io_uring->cq.ring_addr = _io_uring->sq.ring_addr;
+    }
+    else
+    {
+        _io_uring->cq.ring_addr = mmap(
+            NULL,
+            _io_uring->cq.ring_length,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            _io_uring->ring_fd,
+            IORING_OFF_CQ_RING);
+        if (MAP_FAILED == _io_uring->cq.ring_addr)
+        {
+            aeron_set_err(errno, "io_uring mmap cq ring: %s", strerror(errno));
+            goto error;
+        }
+    }
+
+    _io_uring->sq.sqes_length = params.sq_entries * sizeof(struct io_uring_sqe);
+    _io_uring->sq.sqes = mmap(
+        NULL,
+        _io_uring->sq.sqes_length,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        _io_uring->ring_fd,
+        IORING_OFF_SQES);
+    if (MAP_FAILED == _io_uring->sq.sqes)
+    {
+        aeron_set_err(errno, "io_uring mmap sqes: %s", strerror(errno));
+        goto error;
+    }
+
+    uint8_t *sq_ring = _io_uring->sq.ring_addr;
+    uint8_t *cq_ring = _io_uring->cq.ring_addr;
+
+    _io_uring->sq.head = (uint32_t *)(sq_ring + params.sq_off.head);
+    _io_uring->sq.tail = (uint32_t *)(sq_ring + params.sq_off.tail);
+    _io_uring->sq.ring_mask = (uint32_t *)(sq_ring + params.sq_off.ring_mask);
+    _io_uring->sq.array = (uint32_t *)(sq_ring + params.sq_off.array);
+    _io_uring->sq.flags = (uint32_t *)(sq_ring + params.sq_off.flags);
+    _io_uring->sq.entries = params.sq_entries;
+    _io_uring->sq.pending = 0;
+    _io_uring->cq.head = (uint32_t *)(cq_ring + params.cq_off.head);
+    _io_uring->cq.tail = (uint32_t *)(cq_ring + params.cq_off.tail);
+    _io_uring->cq.ring_mask = (uint32_t *)(cq_ring + params.cq_off.ring_mask);
+    _io_uring->cq.cqes = (struct io_uring_cqe *)(cq_ring + params.cq_off.cqes);
+
+    /* each provided buffer holds the io_uring_recvmsg_out header, source address and control messages ahead of data */
+    memset(&_io_uring->recvmsg_template, 0, sizeof(struct msghdr));
+    _io_uring->recvmsg_template.msg_namelen = sizeof(struct sockaddr_storage);
+    _io_uring->recvmsg_template.msg_controllen = AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH;
+
+    _io_uring->buffers.count = buffer_count;
+    _io_uring->buffers.stride = AERON_ALIGN(
+        sizeof(struct io_uring_recvmsg_out) +
+        _io_uring->recvmsg_template.msg_namelen +
+        _io_uring->recvmsg_template.msg_controllen +
+        buffer_length,
+        AERON_CACHE_LINE_LENGTH);
+    _io_uring->buffers.tail = 0;
+    _io_uring->buffers.ring_length = buffer_count * sizeof(struct io_uring_buf);
+
+    _io_uring->buffers.ring = mmap(
+        NULL, _io_uring->buffers.ring_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == _io_uring->buffers.ring)
+    {
+        aeron_set_err(errno, "io_uring mmap buffer ring: %s", strerror(errno));
+        goto error;
+    }
+
+    if (aeron_alloc((void **)&_io_uring->buffers.buffer, buffer_count * _io_uring->buffers.stride) < 0)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not allocate io_uring buffers");
+        goto error;
+    }
+
+    struct io_uring_buf_reg buf_reg;
+
+    memset(&buf_reg, 0, sizeof(buf_reg));
+    buf_reg.ring_addr = (uint64_t)(uintptr_t)_io_uring->buffers.ring;
+    buf_reg.ring_entries = (uint32_t)buffer_count;
+    buf_reg.bgid = AERON_UDP_TRANSPORT_IO_URING_BUFFER_GROUP_ID;
+
+    if (syscall(__NR_io_uring_register, _io_uring->ring_fd, IORING_REGISTER_PBUF_RING, &buf_reg, 1) < 0)
+    {
+        aeron_set_err(errno, "io_uring_register(IORING_REGISTER_PBUF_RING): %s", strerror(errno));
+        goto error;
+    }
+
+    for (size_t i = 0; i < buffer_count; i++)
+    {
+        aeron_udp_transport_io_uring_recycle(_io_uring, (uint16_t)i);
+    }
+    AERON_PUT_ORDERED(_io_uring->buffers.ring->tail, _io_uring->buffers.tail);
+
+    *io_uring = _io_uring;
+    return 0;
+
+    error:
+        aeron_udp_transport_io_uring_close(_io_uring);
+        return -1;
+}
+
+int aeron_udp_transport_io_uring_close(aeron_udp_transport_io_uring_t *io_uring)
+{
+    if (NULL != io_uring)
+    {
+        if (MAP_FAILED != io_uring->sq.sqes)
+        {
+            munmap(io_uring->sq.sqes, io_uring->sq.sqes_length);
+        }
+
+        if (MAP_FAILED != io_uring->cq.ring_addr && io_uring->cq.ring_addr != io_uring->sq.ring_addr)
+        {
+            munmap(io_uring->cq.ring_addr, io_uring->cq.ring_length);
+        }
+
+        if (MAP_FAILED != io_uring->sq.ring_addr)
+        {
+            munmap(io_uring->sq.ring_addr, io_uring->sq.ring_length);
+        }
+
+        if (io_uring->ring_fd >= 0)
+        {
+            close(io_uring->ring_fd);
+        }
+
+        if (MAP_FAILED != io_uring->buffers.ring)
+        {
+            munmap(io_uring->buffers.ring, io_uring->buffers.ring_length);
+        }
+
+        aeron_free(io_uring->buffers.buffer);
+        aeron_int64_to_ptr_hash_map_delete(&io_uring->transport_by_user_data);
+        aeron_free(io_uring);
+    }
+
+    return 0;
+}
+
+int aeron_udp_transport_io_uring_add(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport)
+{
+    const int64_t user_data = io_uring->next_user_data++;
+
+    if (aeron_int64_to_ptr_hash_map_put(&io_uring->transport_by_user_data, user_data, transport) < 0)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not add transport to io_uring poller");
+        return -1;
+    }
+
+    if (aeron_udp_transport_io_uring_arm(io_uring, transport, user_data) < 0)
+    {
+        aeron_int64_to_ptr_hash_map_remove(&io_uring->transport_by_user_data, user_data);
+        return -1;
+    }
+
+    return aeron_udp_transport_io_uring_enter(io_uring);
+}
+
+typedef struct aeron_udp_transport_io_uring_find_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    int64_t user_data;
+}
+aeron_udp_transport_io_uring_find_t;
+
+static void aeron_udp_transport_io_uring_find_user_data(void *clientd, int64_t key, void *value)
+{
+    aeron_udp_transport_io_uring_find_t *find = (aeron_udp_transport_io_uring_find_t *)clientd;
+
+    if (value == find->transport)
+    {
+        find->user_data = key;
+    }
+}
+
+int aeron_udp_transport_io_uring_remove(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_transport_io_uring_find_t find = { transport, AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA };
+
+    aeron_int64_to_ptr_hash_map_for_each(
+        &io_uring->transport_by_user_data, aeron_udp_transport_io_uring_find_user_data, &find);
+    if (AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA == find.user_data)
+    {
+        return 0;
+    }
+
+    /* completions still in flight for the removed transport no longer resolve and are dropped */
+    aeron_int64_to_ptr_hash_map_remove(&io_uring->transport_by_user_data, find.user_data);
+
+    struct io_uring_sqe *sqe = aeron_udp_transport_io_uring_next_sqe(io_uring);
+    if (NULL == sqe)
+    {
+        return -1;
+    }
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)find.user_data;
+    sqe->user_data = AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA;
+
+    return aeron_udp_transport_io_uring_enter(io_uring);
+}
+
+int aeron_udp_transport_io_uring_poll(
+    aeron_udp_transport_io_uring_t *io_uring,
+    size_t max_messages,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    const uint32_t cq_mask = *io_uring->cq.ring_mask;
+    const uint16_t buffers_tail = io_uring->buffers.tail;
+    uint32_t head = *io_uring->cq.head, tail;
+    int work_count = 0, result = 0;
+    uint32_t sq_flags;
+
+    AERON_GET_VOLATILE(sq_flags, *io_uring->sq.flags);
+    if (sq_flags & IORING_SQ_CQ_OVERFLOW)
+    {
+        /* completions that did not fit in the queue are held by the kernel until flushed */
+        syscall(__NR_io_uring_enter, io_uring->ring_fd, 0, 0, IORING_ENTER_GETEVENTS, NULL, 0);
+    }
+
+    AERON_GET_VOLATILE(tail, *io_uring->cq.tail);
+
+    for (; head != tail && (size_t)work_count < max_messages; head++)
+    {
+        struct io_uring_cqe *cqe = &io_uring->cq.cqes[head & cq_mask];
+        const int64_t user_data = (int64_t)cqe->user_data;
+
+        if (AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA == user_data)
+        {
+            continue;
+        }
+
+        aeron_udp_channel_transport_t *transport = aeron_int64_to_ptr_hash_map_get(
+            &io_uring->transport_by_user_data, user_data);
+
+        if (cqe->flags & IORING_CQE_F_BUFFER)
+        {
+            const uint16_t buffer_id = (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+            uint8_t *buffer = io_uring->buffers.buffer + (buffer_id * io_uring->buffers.stride);
+
+            if (NULL != transport && cqe->res >= 0)
+            {
+                struct io_uring_recvmsg_out *out = (struct io_uring_recvmsg_out *)buffer;
+                struct msghdr message;
+
+                message.msg_name = buffer + sizeof(struct io_uring_recvmsg_out);
+                message.msg_namelen = out->namelen;
+                message.msg_control = (uint8_t *)message.msg_name + io_uring->recvmsg_template.msg_namelen;
+                message.msg_controllen = out->controllen;
+
+                uint8_t *payload = (uint8_t *)message.msg_control + io_uring->recvmsg_template.msg_controllen;
+                const size_t payload_capacity = io_uring->buffers.stride - (size_t)(payload - buffer);
+                const size_t length = out->payloadlen < payload_capacity ? out->payloadlen : payload_capacity;
+
+                aeron_udp_channel_transport_dispatch_segments(
+                    transport,
+                    payload,
+                    length,
+                    aeron_udp_channel_transport_segment_length(transport, &message, length),
+                    message.msg_name,
+                    recv_func,
+                    clientd);
+
+                *bytes_rcved += length;
+                work_count++;
+            }
+
+            aeron_udp_transport_io_uring_recycle(io_uring, buffer_id);
+        }
+
+        if (NULL != transport)
+        {
+            if (cqe->res < 0 && -ENOBUFS != cqe->res && -ECANCELED != cqe->res && 0 == result)
+            {
+                aeron_set_err(-cqe->res, "io_uring recvmsg: %s", strerror(-cqe->res));
+                result = -1;
+            }
+
+            /* the kernel drops a multishot receive on error or when it runs out of buffers so rearm it */
+            if (!(cqe->flags & IORING_CQE_F_MORE) &&
+                aeron_udp_transport_io_uring_arm(io_uring, transport, user_data) < 0)
+            {
+                result = -1;
+            }
+        }
+    }
+
+    AERON_PUT_ORDERED(*io_uring->cq.head, head);
+
+    if (buffers_tail != io_uring->buffers.tail)
+    {
+        AERON_PUT_ORDERED(io_uring->buffers.ring->tail, io_uring->buffers.tail);
+    }
+
+    if (aeron_udp_transport_io_uring_enter(io_uring) < 0)
+    {
+        result = -1;
+    }
+
+    return result < 0 ? result : work_count;
+}
+
+#else
+
+int aeron_udp_transport_io_uring_init(
+    aeron_udp_transport_io_uring_t **io_uring, size_t buffer_count, size_t buffer_length)
+{
+    aeron_set_err(ENOTSUP, "%s", "io_uring is not supported on this platform");
+    return -1;
+}
+
+int aeron_udp_transport_io_uring_close(aeron_udp_transport_io_uring_t *io_uring)
+{
+    return 0;
+}
+
+int aeron_udp_transport_io_uring_add(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport)
+{
+    aeron_set_err(ENOTSUP, "%s", "io_uring is not supported on this platform");
+    return -1;
+}
+
+int aeron_udp_transport_io_uring_remove(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport)
+{
+    return 0;
+}
+
+int aeron_udp_transport_io_uring_poll(
+    aeron_udp_transport_io_uring_t *io_uring,
+    size_t max_messages,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_TRANSPORT_IO_URING_H
+#define AERON_UDP_TRANSPORT_IO_URING_H
+
+#include "media/aeron_udp_channel_transport.h"
+
+#define AERON_UDP_TRANSPORT_IO_URING_BUFFER_COUNT_MAX (32768)
+
+/*
+ * io_uring receive backend for the transport poller. Each transport has a multishot recvmsg armed against a ring of
+ * kernel provided buffers so datagrams for every endpoint are harvested from the completion queue without a syscall
+ * per endpoint. Only available on Linux when built against io_uring headers, otherwise init fails with ENOTSUP.
+ */
+typedef struct aeron_udp_transport_io_uring_stct aeron_udp_transport_io_uring_t;
+
+int aeron_udp_transport_io_uring_init(
+    aeron_udp_transport_io_uring_t **io_uring, size_t buffer_count, size_t buffer_length);
+int aeron_udp_transport_io_uring_close(aeron_udp_transport_io_uring_t *io_uring);
+
+int aeron_udp_transport_io_uring_add(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport);
+int aeron_udp_transport_io_uring_remove(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_transport_io_uring_poll(
+    aeron_udp_transport_io_uring_t *io_uring,
+    size_t max_messages,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
+#endif //AERON_UDP_TRANSPORT_IO_URING_H
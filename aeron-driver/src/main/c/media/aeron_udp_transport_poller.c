@@ -24,12 +24,17 @@
 #include "util/aeron_arrayutil.h"
 #include "aeron_alloc.h"
 #include "media/aeron_udp_transport_poller.h"
+#include "aeron_driver_context.h"
 
-int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller)
+int aeron_udp_transport_poller_init(
+    aeron_udp_transport_poller_t *poller, aeron_driver_context_t *context, size_t max_datagram_length)
 {
     poller->transports.array = NULL;
     poller->transports.length = 0;
     poller->transports.capacity = 0;
+    poller->io_uring = NULL;
+    poller->is_io_uring_unavailable = false;
+    poller->bindings_clientd = NULL;
 
 #if defined(HAVE_EPOLL)
     if ((poller->epoll_fd = epoll_create1(0)) < 0)
@@ -42,6 +47,13 @@ int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller)
     poller->pollfds = NULL;
 #endif
 
+    if (context->udp_transport_poller_io_uring &&
+        aeron_udp_transport_poller_enable_io_uring(
+            poller, context->udp_transport_poller_io_uring_buffer_count, max_datagram_length) < 0)
+    {
+        poller->is_io_uring_unavailable = true;
+    }
+
     return 0;
 }
 
@@ -54,9 +66,22 @@ int aeron_udp_transport_poller_close(aeron_udp_transport_poller_t *poller)
 #elif defined(HAVE_POLL)
     aeron_free(poller->pollfds);
 #endif
+    aeron_udp_transport_io_uring_close(poller->io_uring);
     return 0;
 }
 
+int aeron_udp_transport_poller_enable_io_uring(
+    aeron_udp_transport_poller_t *poller, size_t buffer_count, size_t buffer_length)
+{
+    if (poller->transports.length > 0)
+    {
+        aeron_set_err(EINVAL, "%s", "io_uring must be enabled before transports are added");
+        return -1;
+    }
+
+    return aeron_udp_transport_io_uring_init(&poller->io_uring, buffer_count, buffer_length);
+}
+
 int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
 {
     int ensure_capacity_result = 0;
@@ -70,6 +95,17 @@ int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_u
 
     poller->transports.array[index].transport = transport;
 
+    if (NULL != poller->io_uring)
+    {
+        if (aeron_udp_transport_io_uring_add(poller->io_uring, transport) < 0)
+        {
+            return -1;
+        }
+
+        poller->transports.length++;
+        return 0;
+    }
+
 #if defined(HAVE_EPOLL)
     size_t new_capacity = poller->transports.capacity;
 
@@ -135,6 +171,12 @@ int aeron_udp_transport_poller_remove(aeron_udp_transport_poller_t *poller, aero
             (size_t)index,
             (size_t)last_index);
 
+        if (NULL != poller->io_uring)
+        {
+            poller->transports.length--;
+            return aeron_udp_transport_io_uring_remove(poller->io_uring, transport);
+        }
+
 #if defined(HAVE_EPOLL)
         aeron_array_fast_unordered_remove(
             (uint8_t *)poller->epoll_events,
@@ -171,17 +213,25 @@ int aeron_udp_transport_poller_poll(
     aeron_udp_transport_poller_t *poller,
     struct mmsghdr *msgvec,
     size_t vlen,
+    int64_t *bytes_rcved,
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd)
 {
     int work_count = 0;
 
+    if (NULL != poller->io_uring)
+    {
+        const size_t max_messages = vlen * (poller->transports.length > 0 ? poller->transports.length : 1);
+
+        return aeron_udp_transport_io_uring_poll(poller->io_uring, max_messages, bytes_rcved, recv_func, clientd);
+    }
+
     if (poller->transports.length <= AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD)
     {
         for (size_t i = 0, length = poller->transports.length; i < length; i++)
         {
             int recv_result = aeron_udp_channel_transport_recvmmsg(
-                poller->transports.array[i].transport, msgvec, vlen, recv_func, clientd);
+                poller->transports.array[i].transport, msgvec, vlen, bytes_rcved, recv_func, clientd);
             if (recv_result < 0)
             {
                 return recv_result;
@@ -218,7 +268,7 @@ int aeron_udp_transport_poller_poll(
                 if (poller->epoll_events[i].events & EPOLLIN)
                 {
                     int recv_result = aeron_udp_channel_transport_recvmmsg(
-                        poller->epoll_events[i].data.ptr, msgvec, vlen, recv_func, clientd);
+                        poller->epoll_events[i].data.ptr, msgvec, vlen, bytes_rcved, recv_func, clientd);
 
                     if (recv_result < 0)
                     {
@@ -258,7 +308,7 @@ int aeron_udp_transport_poller_poll(
                 if (poller->pollfds[i].revents & POLLIN)
                 {
                     int recv_result = aeron_udp_channel_transport_recvmmsg(
-                        poller->transports.array[i].transport, msgvec, vlen, recv_func, clientd);
+                        poller->transports.array[i].transport, msgvec, vlen, bytes_rcved, recv_func, clientd);
 
                     if (recv_result < 0)
                     {
@@ -23,7 +23,9 @@
 #include <poll.h>
 #endif
 
+#include "aeronmd.h"
 #include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_transport_io_uring.h"
 
 #define AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD (5)
 
@@ -49,12 +51,31 @@ typedef struct aeron_udp_transport_poller_stct
 #elif defined(HAVE_POLL)
     struct pollfd *pollfds;
 #endif
+
+    aeron_udp_transport_io_uring_t *io_uring;
+    bool is_io_uring_unavailable;
+    void *bindings_clientd;
 }
 aeron_udp_transport_poller_t;
 
-int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller);
+/**
+ * Initialise a poller for datagrams of up to max_datagram_length, using io_uring if the context requests it. When
+ * io_uring is requested but unavailable the poller falls back to epoll/poll and sets is_io_uring_unavailable.
+ *
+ * @return 0 on success or -1 on error.
+ */
+int aeron_udp_transport_poller_init(
+    aeron_udp_transport_poller_t *poller, aeron_driver_context_t *context, size_t max_datagram_length);
 int aeron_udp_transport_poller_close(aeron_udp_transport_poller_t *poller);
 
+/**
+ * Switch the poller to receive through io_uring multishot receives into buffer_count provided buffers, each able to
+ * hold a datagram of buffer_length. Must be called before any transports are added. On failure the poller is left
+ * using epoll/poll.
+ */
+int aeron_udp_transport_poller_enable_io_uring(
+    aeron_udp_transport_poller_t *poller, size_t buffer_count, size_t buffer_length);
+
 int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport);
 int aeron_udp_transport_poller_remove(aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport);
 
@@ -62,6 +83,7 @@ int aeron_udp_transport_poller_poll(
     aeron_udp_transport_poller_t *poller,
     struct mmsghdr *msgvec,
     size_t vlen,
+    int64_t *bytes_rcved,
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd);
 
@@ -66,6 +66,23 @@ typedef struct aeron_nak_header_stct
 }
 aeron_nak_header_t;
 
+typedef struct aeron_nak_list_header_stct
+{
+    aeron_frame_header_t frame_header;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t term_id;
+    int32_t range_count;
+}
+aeron_nak_list_header_t;
+
+typedef struct aeron_nak_range_stct
+{
+    int32_t term_offset;
+    int32_t length;
+}
+aeron_nak_range_t;
+
 typedef struct aeron_status_message_header_stct
 {
     aeron_frame_header_t frame_header;
@@ -99,6 +116,7 @@ aeron_rttm_header_t;
 #define AERON_HDR_TYPE_ERR (0x04)
 #define AERON_HDR_TYPE_SETUP (0x05)
 #define AERON_HDR_TYPE_RTTM (0x06)
+#define AERON_HDR_TYPE_NAK_LIST (0x0E)
 #define AERON_HDR_TYPE_EXT (0xFFFF)
 
 #define AERON_DATA_HEADER_LENGTH (sizeof(aeron_data_header_t))
@@ -110,7 +128,10 @@ aeron_rttm_header_t;
 #define AERON_DATA_HEADER_DEFAULT_RESERVED_VALUE (0L)
 
 #define AERON_STATUS_MESSAGE_HEADER_SEND_SETUP_FLAG ((uint8_t)(0x80))
+#define AERON_STATUS_MESSAGE_GROUP_TAG_LENGTH (sizeof(int64_t))
 
 #define AERON_RTTM_HEADER_REPLY_FLAG ((uint8_t)(0x80))
 
+#define AERON_NAK_LIST_MAX_RANGES (64)
+
 #endif //AERON_UDP_PROTOCOL_H
@@ -363,6 +363,32 @@ int aeron_uri_get_mtu_length_param(aeron_uri_params_t *uri_params, aeron_uri_pub
     return 0;
 }
 
+int aeron_uri_get_max_messages_per_send_param(
+    aeron_uri_params_t *uri_params, aeron_uri_publication_params_t *params)
+{
+    const char *value_str;
+
+    if ((value_str = aeron_uri_find_param_value(uri_params, AERON_URI_MAX_MESSAGES_PER_SEND_KEY)) != NULL)
+    {
+        uint64_t value;
+
+        if (-1 == aeron_parse_size64(value_str, &value))
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_URI_MAX_MESSAGES_PER_SEND_KEY);
+            return -1;
+        }
+
+        if (aeron_driver_context_validate_max_messages_per_send(value) < 0)
+        {
+            return -1;
+        }
+
+        params->max_messages_per_send = value;
+    }
+
+    return 0;
+}
+
 int aeron_uri_linger_timeout_param(aeron_uri_params_t *uri_params, aeron_uri_publication_params_t *params)
 {
     const char *value_str;
@@ -394,6 +420,7 @@ int aeron_uri_publication_params(
     params->linger_timeout_ns = context->publication_linger_timeout_ns;
     params->term_length = AERON_URI_IPC == uri->type ? context->ipc_term_buffer_length : context->term_buffer_length;
     params->mtu_length = AERON_URI_IPC == uri->type ? context->ipc_mtu_length : context->mtu_length;
+    params->max_messages_per_send = context->network_publication_max_messages_per_send;
     params->initial_term_id = 0;
     params->term_offset = 0;
     params->term_id = 0;
@@ -418,6 +445,11 @@ int aeron_uri_publication_params(
         return -1;
     }
 
+    if (aeron_uri_get_max_messages_per_send_param(uri_params, params) < 0)
+    {
+        return -1;
+    }
+
     if (is_exclusive)
     {
         int count = 0;
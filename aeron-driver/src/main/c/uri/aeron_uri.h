@@ -56,6 +56,9 @@ aeron_uri_params_t;
 #define AERON_URI_TETHER_KEY "tether"
 #define AERON_URI_TAGS_KEY "tags"
 #define AERON_URI_SESSION_ID_KEY "session-id"
+#define AERON_URI_MAX_MESSAGES_PER_SEND_KEY "max-msgs-per-send"
+#define AERON_URI_FC_KEY "fc"
+#define AERON_URI_GROUP_TAG_KEY "gtag"
 
 typedef struct aeron_uri_publication_params_stct
 {
@@ -65,6 +68,7 @@ typedef struct aeron_uri_publication_params_stct
     size_t mtu_length;
     size_t term_length;
     size_t term_offset;
+    size_t max_messages_per_send;
     int32_t initial_term_id;
     int32_t term_id;
     uint64_t linger_timeout_ns;
@@ -0,0 +1,301 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "util/aeron_affinity.h"
+#include "util/aeron_error.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#define AERON_MPOL_DEFAULT (0)
+#define AERON_MPOL_PREFERRED (1)
+#define AERON_MPOL_MF_MOVE (1 << 1)
+#endif
+
+int aeron_cpu_set_parse(const char *str, aeron_cpu_set_t *cpu_set)
+{
+    const char *ptr = str;
+
+    memset(cpu_set, 0, sizeof(aeron_cpu_set_t));
+
+    if (NULL == str)
+    {
+        aeron_set_err(EINVAL, "%s", "CPU set must not be null");
+        return -1;
+    }
+
+    while ('\0' != *ptr)
+    {
+        char *end_ptr = NULL;
+
+        if (!isdigit((unsigned char)*ptr))
+        {
+            goto invalid;
+        }
+
+        unsigned long first = strtoul(ptr, &end_ptr, 10);
+        unsigned long last = first;
+        ptr = end_ptr;
+
+        if ('-' == *ptr)
+        {
+            ptr++;
+            if (!isdigit((unsigned char)*ptr))
+            {
+                goto invalid;
+            }
+
+            last = strtoul(ptr, &end_ptr, 10);
+            ptr = end_ptr;
+        }
+
+        if (first > last || last >= AERON_CPU_SET_MAX_CPUS)
+        {
+            goto invalid;
+        }
+
+        for (unsigned long cpu = first; cpu <= last; cpu++)
+        {
+            cpu_set->bits[cpu / 64] |= UINT64_C(1) << (cpu % 64);
+        }
+
+        if (',' == *ptr)
+        {
+            ptr++;
+            if ('\0' == *ptr)
+            {
+                goto invalid;
+            }
+        }
+        else if ('\0' != *ptr)
+        {
+            goto invalid;
+        }
+    }
+
+    if (aeron_cpu_set_is_empty(cpu_set))
+    {
+        goto invalid;
+    }
+
+    return 0;
+
+    invalid:
+    aeron_set_err(EINVAL, "invalid CPU set: %s", str);
+    return -1;
+}
+
+bool aeron_cpu_set_is_empty(const aeron_cpu_set_t *cpu_set)
+{
+    for (size_t i = 0; i < AERON_CPU_SET_MAX_CPUS / 64; i++)
+    {
+        if (0 != cpu_set->bits[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#if defined(__linux__)
+static void aeron_cpu_set_to_native(const aeron_cpu_set_t *cpu_set, cpu_set_t *native_set)
+{
+    CPU_ZERO(native_set);
+
+    for (size_t cpu = 0; cpu < AERON_CPU_SET_MAX_CPUS && cpu < CPU_SETSIZE; cpu++)
+    {
+        if (aeron_cpu_set_is_set(cpu_set, cpu))
+        {
+            CPU_SET(cpu, native_set);
+        }
+    }
+}
+#endif
+
+int aeron_thread_attr_set_cpu_affinity(pthread_attr_t *attr, const aeron_cpu_set_t *cpu_set)
+{
+#if defined(__linux__)
+    cpu_set_t native_set;
+    int result;
+
+    aeron_cpu_set_to_native(cpu_set, &native_set);
+    if ((result = pthread_attr_setaffinity_np(attr, sizeof(native_set), &native_set)) != 0)
+    {
+        aeron_set_err(result, "pthread_attr_setaffinity_np: %s", strerror(result));
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "%s", "CPU affinity is not supported on this platform");
+    return -1;
+#endif
+}
+
+int aeron_thread_set_cpu_affinity(const aeron_cpu_set_t *cpu_set)
+{
+#if defined(__linux__)
+    cpu_set_t native_set;
+    int result;
+
+    aeron_cpu_set_to_native(cpu_set, &native_set);
+    if ((result = pthread_setaffinity_np(pthread_self(), sizeof(native_set), &native_set)) != 0)
+    {
+        aeron_set_err(result, "pthread_setaffinity_np: %s", strerror(result));
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "%s", "CPU affinity is not supported on this platform");
+    return -1;
+#endif
+}
+
+int aeron_numa_set_preferred_node(int32_t node)
+{
+    if (node >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "invalid NUMA node: %d", node);
+        return -1;
+    }
+
+#if defined(__linux__)
+    unsigned long node_mask[AERON_NUMA_MAX_NODES / (8 * sizeof(unsigned long))];
+    const size_t bits_per_word = 8 * sizeof(unsigned long);
+    long result;
+
+    memset(node_mask, 0, sizeof(node_mask));
+
+    if (node < 0)
+    {
+        result = syscall(SYS_set_mempolicy, AERON_MPOL_DEFAULT, NULL, 0);
+    }
+    else
+    {
+        node_mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+        result = syscall(SYS_set_mempolicy, AERON_MPOL_PREFERRED, node_mask, AERON_NUMA_MAX_NODES + 1);
+    }
+
+    if (result < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "set_mempolicy node %d: %s", node, strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+#else
+    if (node < 0)
+    {
+        return 0;
+    }
+
+    aeron_set_err(ENOTSUP, "%s", "NUMA placement is not supported on this platform");
+    return -1;
+#endif
+}
+
+int aeron_numa_get_policy(aeron_numa_policy_t *policy)
+{
+    memset(policy, 0, sizeof(aeron_numa_policy_t));
+
+#if defined(__linux__)
+    if (syscall(SYS_get_mempolicy, &policy->mode, policy->node_mask, AERON_NUMA_MAX_NODES + 1, NULL, 0) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "get_mempolicy: %s", strerror(errcode));
+        return -1;
+    }
+#endif
+
+    return 0;
+}
+
+int aeron_numa_set_policy(const aeron_numa_policy_t *policy)
+{
+#if defined(__linux__)
+    if (syscall(SYS_set_mempolicy, policy->mode, policy->node_mask, AERON_NUMA_MAX_NODES + 1) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "set_mempolicy mode %d: %s", policy->mode, strerror(errcode));
+        return -1;
+    }
+#endif
+
+    return 0;
+}
+
+int aeron_numa_bind_preferred(void *addr, size_t length, int32_t node)
+{
+    if (node < 0 || NULL == addr)
+    {
+        return 0;
+    }
+
+    if (node >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "invalid NUMA node: %d", node);
+        return -1;
+    }
+
+#if defined(__linux__)
+    unsigned long node_mask[AERON_NUMA_MAX_NODES / (8 * sizeof(unsigned long))];
+    const size_t bits_per_word = 8 * sizeof(unsigned long);
+    const uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    const uintptr_t begin = ((uintptr_t)addr + page_size - 1) & ~(page_size - 1);
+    const uintptr_t end = ((uintptr_t)addr + length) & ~(page_size - 1);
+
+    if (end <= begin)
+    {
+        return 0;
+    }
+
+    memset(node_mask, 0, sizeof(node_mask));
+    node_mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+
+    if (syscall(
+        SYS_mbind, (void *)begin, end - begin, AERON_MPOL_PREFERRED, node_mask, AERON_NUMA_MAX_NODES + 1,
+        AERON_MPOL_MF_MOVE) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "mbind node %d: %s", node, strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "%s", "NUMA placement is not supported on this platform");
+    return -1;
+#endif
+}
+
+extern bool aeron_cpu_set_is_set(const aeron_cpu_set_t *cpu_set, size_t cpu);
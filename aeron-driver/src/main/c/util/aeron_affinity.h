@@ -0,0 +1,84 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AFFINITY_H
+#define AERON_AFFINITY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "concurrent/aeron_thread.h"
+
+#define AERON_CPU_SET_MAX_CPUS (1024)
+#define AERON_NUMA_MAX_NODES (1024)
+#define AERON_NUMA_NODE_NONE (-1)
+
+typedef struct aeron_cpu_set_stct
+{
+    uint64_t bits[AERON_CPU_SET_MAX_CPUS / 64];
+}
+aeron_cpu_set_t;
+
+typedef struct aeron_numa_policy_stct
+{
+    int mode;
+    unsigned long node_mask[AERON_NUMA_MAX_NODES / (8 * sizeof(unsigned long))];
+}
+aeron_numa_policy_t;
+
+/*
+ * Parse a CPU list in the form used by taskset and cpuset, e.g. "2", "0-3" or "1,4-6". An empty set is an error.
+ */
+int aeron_cpu_set_parse(const char *str, aeron_cpu_set_t *cpu_set);
+
+bool aeron_cpu_set_is_empty(const aeron_cpu_set_t *cpu_set);
+
+inline bool aeron_cpu_set_is_set(const aeron_cpu_set_t *cpu_set, size_t cpu)
+{
+    return cpu < AERON_CPU_SET_MAX_CPUS && 0 != (cpu_set->bits[cpu / 64] & (UINT64_C(1) << (cpu % 64)));
+}
+
+/*
+ * Threads created with the attributes only run on the CPUs in the set.
+ */
+int aeron_thread_attr_set_cpu_affinity(pthread_attr_t *attr, const aeron_cpu_set_t *cpu_set);
+
+int aeron_thread_set_cpu_affinity(const aeron_cpu_set_t *cpu_set);
+
+/*
+ * Set the memory policy of the calling thread so pages it first touches are allocated on the node when it has free
+ * memory. Threads created afterwards inherit the policy. AERON_NUMA_NODE_NONE restores the default local policy.
+ */
+int aeron_numa_set_preferred_node(int32_t node);
+
+/*
+ * Save the memory policy of the calling thread, including one inherited from e.g. numactl, so it can be restored.
+ */
+int aeron_numa_get_policy(aeron_numa_policy_t *policy);
+
+/*
+ * Restore a memory policy previously saved with aeron_numa_get_policy on the calling thread.
+ */
+int aeron_numa_set_policy(const aeron_numa_policy_t *policy);
+
+/*
+ * Prefer the node for the pages of a mapping, moving those already touched when they are not shared. Only the pages
+ * wholly inside the range are bound. Does nothing for AERON_NUMA_NODE_NONE.
+ */
+int aeron_numa_bind_preferred(void *addr, size_t length, int32_t node);
+
+#endif //AERON_AFFINITY_H
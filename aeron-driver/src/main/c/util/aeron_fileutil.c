@@ -167,6 +167,11 @@ int aeron_is_directory(const char* path)
     return GetFileAttributes(path) == FILE_ATTRIBUTE_DIRECTORY;
 }
 
+uint64_t aeron_hugetlbfs_page_size(const char *path)
+{
+    return 0;
+}
+
 #else
 #include <unistd.h>
 #include <sys/mman.h>
@@ -174,6 +179,12 @@ int aeron_is_directory(const char* path)
 #include <errno.h>
 #include <ftw.h>
 #include <stdio.h>
+#include <limits.h>
+
+#if defined(__linux__)
+#include <sys/vfs.h>
+#define AERON_HUGETLBFS_MAGIC (0x958458f6)
+#endif
 
 static int aeron_mmap(aeron_mapped_file_t *mapping, int fd, off_t offset)
 {
@@ -232,6 +243,43 @@ int aeron_create_file(const char* path)
 {
     return open(path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
 }
+
+uint64_t aeron_hugetlbfs_page_size(const char *path)
+{
+#if defined(__linux__)
+    char dir[PATH_MAX];
+    struct statfs sfs;
+
+    snprintf(dir, sizeof(dir), "%s", path);
+
+    /* the path may not have been created yet so check the nearest existing parent */
+    while (statfs(dir, &sfs) < 0)
+    {
+        char *separator = strrchr(dir, '/');
+
+        if (ENOENT != errno || NULL == separator)
+        {
+            return 0;
+        }
+
+        if (separator == dir)
+        {
+            separator[1] = '\0';
+        }
+        else
+        {
+            *separator = '\0';
+        }
+    }
+
+    if (AERON_HUGETLBFS_MAGIC == (uint32_t)sfs.f_type)
+    {
+        return (uint64_t)sfs.f_bsize;
+    }
+#endif
+
+    return 0;
+}
 #endif
 
 #include <string.h>
@@ -241,9 +289,7 @@ int aeron_create_file(const char* path)
 #include "util/aeron_fileutil.h"
 #include "aeron_error.h"
 
-#define AERON_BLOCK_SIZE (4 * 1024)
-
-static void aeron_touch_pages(volatile uint8_t *base, size_t length, size_t page_size)
+void aeron_touch_pages(volatile uint8_t *base, size_t length, size_t page_size)
 {
     for (size_t i = 0; i < length; i += page_size)
     {
@@ -252,6 +298,18 @@ static void aeron_touch_pages(volatile uint8_t *base, size_t length, size_t page
     }
 }
 
+int aeron_advise_huge_pages(void *addr, size_t length, uint64_t page_size)
+{
+#if defined(MADV_HUGEPAGE)
+    if (page_size > (uint64_t)sysconf(_SC_PAGESIZE))
+    {
+        return madvise(addr, length, MADV_HUGEPAGE);
+    }
+#endif
+
+    return 0;
+}
+
 int aeron_map_new_file(aeron_mapped_file_t *mapped_file, const char *path, bool fill_with_zeroes)
 {
     int fd, result = -1;
@@ -403,9 +461,12 @@ int aeron_map_raw_log(
                 return -1;
             }
 
+            /* a hint only, file systems without transparent huge page support ignore or reject it */
+            aeron_advise_huge_pages(mapped_raw_log->mapped_file.addr, log_length, page_size);
+
             if (!use_sparse_files)
             {
-                aeron_touch_pages(mapped_raw_log->mapped_file.addr, log_length, page_size);
+                aeron_touch_pages(mapped_raw_log->mapped_file.addr, log_length, AERON_BLOCK_SIZE);
             }
 
             for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
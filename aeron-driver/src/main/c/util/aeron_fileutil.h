@@ -57,6 +57,24 @@ typedef uint64_t (*aeron_usable_fs_space_func_t)(const char *path);
 uint64_t aeron_usable_fs_space(const char *path);
 uint64_t aeron_usable_fs_space_disabled(const char *path);
 
+/*
+ * Huge page size of the hugetlbfs mount holding path, or its nearest existing parent, or 0 when not on hugetlbfs.
+ */
+uint64_t aeron_hugetlbfs_page_size(const char *path);
+
+#define AERON_BLOCK_SIZE (4 * 1024)
+
+/*
+ * Write the first byte of every page_size step of the region so it is faulted in up front.
+ */
+void aeron_touch_pages(volatile uint8_t *base, size_t length, size_t page_size);
+
+/*
+ * Advise transparent huge pages for the region when page_size exceeds the OS page size. Returns 0 on success or
+ * when there is nothing to advise, otherwise -1 with errno set.
+ */
+int aeron_advise_huge_pages(void *addr, size_t length, uint64_t page_size);
+
 #define AERON_LOG_META_DATA_SECTION_INDEX (AERON_LOGBUFFER_PARTITION_COUNT)
 
 typedef struct aeron_mapped_raw_log_stct
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include "aeron_gtest_compat.h"
+
+extern "C"
+{
+#include "aeron_agent.h"
+#include "util/aeron_affinity.h"
+#include "util/aeron_error.h"
+}
+
+static int noWork(void *state)
+{
+    return 0;
+}
+
+static void noIdle(void *state, int work_count)
+{
+}
+
+class AffinityTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_hasPolicy = aeron_numa_get_policy(&m_originalPolicy) == 0;
+    }
+
+    void TearDown() override
+    {
+        if (m_hasPolicy)
+        {
+            aeron_numa_set_policy(&m_originalPolicy);
+        }
+    }
+
+protected:
+    static bool isSamePolicy(const aeron_numa_policy_t &a, const aeron_numa_policy_t &b)
+    {
+        return a.mode == b.mode && 0 == std::memcmp(a.node_mask, b.node_mask, sizeof(a.node_mask));
+    }
+
+    aeron_numa_policy_t m_originalPolicy = {};
+    bool m_hasPolicy = false;
+};
+
+TEST_F(AffinityTest, shouldRestoreSavedNumaPolicy)
+{
+    if (!m_hasPolicy || aeron_numa_set_preferred_node(0) < 0)
+    {
+        /* kernel without NUMA support or a sandbox that forbids memory policies */
+        GTEST_SKIP();
+    }
+
+    aeron_numa_policy_t policy;
+    ASSERT_EQ(aeron_numa_set_policy(&m_originalPolicy), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_numa_get_policy(&policy), 0) << aeron_errmsg();
+
+    EXPECT_TRUE(isSamePolicy(policy, m_originalPolicy));
+}
+
+TEST_F(AffinityTest, shouldKeepCallerNumaPolicyWhenStartingAgentOnNode)
+{
+    if (!m_hasPolicy || aeron_numa_set_preferred_node(0) < 0)
+    {
+        GTEST_SKIP();
+    }
+
+    aeron_numa_policy_t callerPolicy;
+    ASSERT_EQ(aeron_numa_get_policy(&callerPolicy), 0) << aeron_errmsg();
+
+    aeron_agent_runner_t runner;
+    ASSERT_EQ(aeron_agent_init(&runner, "test", nullptr, nullptr, nullptr, noWork, nullptr, noIdle, nullptr), 0);
+    ASSERT_EQ(aeron_agent_set_placement(&runner, nullptr, 0), 0);
+    ASSERT_EQ(aeron_agent_start(&runner), 0) << aeron_errmsg();
+
+    aeron_numa_policy_t policy;
+    ASSERT_EQ(aeron_numa_get_policy(&policy), 0) << aeron_errmsg();
+
+    aeron_agent_stop(&runner);
+    aeron_agent_close(&runner);
+
+    EXPECT_TRUE(isSamePolicy(policy, callerPolicy));
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_counters_manager.h"
+#include "aeron_congestion_control.h"
+#include "aeron_driver_context.h"
+#include "aeron_position.h"
+}
+
+#define CHANNEL "aeron:udp?endpoint=localhost:40123"
+#define STREAM_ID (1001)
+#define SESSION_ID (-1)
+#define REGISTRATION_ID (7)
+#define TERM_LENGTH (1024 * 1024)
+#define MTU_LENGTH (4096)
+#define NUM_COUNTERS (16)
+
+static int64_t null_epoch_clock()
+{
+    return 0;
+}
+
+class CongestionControlTest : public testing::Test
+{
+public:
+    CongestionControlTest()
+    {
+        m_metadata.fill(0);
+        m_values.fill(0);
+
+        EXPECT_EQ(aeron_driver_context_init(&m_context), 0);
+        EXPECT_EQ(aeron_counters_manager_init(
+            &m_counters_manager,
+            m_metadata.data(),
+            m_metadata.size(),
+            m_values.data(),
+            m_values.size(),
+            null_epoch_clock,
+            0), 0);
+    }
+
+    ~CongestionControlTest() override
+    {
+        if (nullptr != m_strategy)
+        {
+            m_strategy->fini(m_strategy);
+        }
+
+        aeron_counters_manager_close(&m_counters_manager);
+        aeron_driver_context_close(m_context);
+    }
+
+    int createStrategy(aeron_congestion_control_strategy_supplier_func_t supplier)
+    {
+        return supplier(
+            &m_strategy,
+            strlen(CHANNEL),
+            CHANNEL,
+            STREAM_ID,
+            SESSION_ID,
+            REGISTRATION_ID,
+            TERM_LENGTH,
+            MTU_LENGTH,
+            m_context,
+            &m_counters_manager);
+    }
+
+    int32_t findCounter(const char *name)
+    {
+        for (int32_t id = 0; id < NUM_COUNTERS; id++)
+        {
+            auto *metadata = reinterpret_cast<aeron_counter_metadata_descriptor_t *>(
+                m_metadata.data() + (id * AERON_COUNTERS_MANAGER_METADATA_LENGTH));
+
+            if (AERON_COUNTER_RECORD_ALLOCATED == metadata->state &&
+                AERON_COUNTER_PER_IMAGE_TYPE_ID == metadata->type_id &&
+                0 == strncmp(reinterpret_cast<const char *>(metadata->label), name, strlen(name)))
+            {
+                return id;
+            }
+        }
+
+        return -1;
+    }
+
+    int64_t counterValue(const char *name)
+    {
+        return aeron_counter_get(aeron_counter_addr(&m_counters_manager, findCounter(name)));
+    }
+
+    int32_t onTrackRebuild(int64_t now_ns, bool loss_occurred, bool *should_force_sm)
+    {
+        return m_strategy->on_track_rebuild(m_strategy->state, should_force_sm, now_ns, 0, 0, 0, 0, 0, loss_occurred);
+    }
+
+protected:
+    aeron_driver_context_t *m_context = nullptr;
+    aeron_counters_manager_t m_counters_manager = {};
+    aeron_congestion_control_strategy_t *m_strategy = nullptr;
+    std::array<uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_METADATA_LENGTH> m_metadata = {};
+    std::array<uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_VALUE_LENGTH> m_values = {};
+};
+
+TEST_F(CongestionControlTest, shouldLoadCubicStrategyByName)
+{
+    EXPECT_TRUE(
+        aeron_congestion_control_strategy_supplier_load("aeron_cubic_congestion_control_strategy_supplier") ==
+        aeron_cubic_congestion_control_strategy_supplier);
+    EXPECT_TRUE(
+        aeron_congestion_control_strategy_supplier_load("aeron_static_window_congestion_control_strategy_supplier") ==
+        aeron_static_window_congestion_control_strategy_supplier);
+}
+
+TEST_F(CongestionControlTest, shouldStartCubicWindowAtMtuAndAllocateIndicators)
+{
+    ASSERT_EQ(createStrategy(aeron_cubic_congestion_control_strategy_supplier), 0);
+
+    EXPECT_EQ(m_strategy->initial_window_length(m_strategy->state), MTU_LENGTH);
+    EXPECT_GE(findCounter(AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_NAME), 0);
+    EXPECT_GE(findCounter(AERON_CUBICCONGESTIONCONTROL_LOSS_INDICATOR_NAME), 0);
+    EXPECT_EQ(counterValue(AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_NAME), MTU_LENGTH);
+
+    m_strategy->fini(m_strategy);
+    m_strategy = nullptr;
+
+    EXPECT_EQ(findCounter(AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_NAME), -1);
+    EXPECT_EQ(findCounter(AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_NAME), -1);
+    EXPECT_EQ(findCounter(AERON_CUBICCONGESTIONCONTROL_LOSS_INDICATOR_NAME), -1);
+}
+
+TEST_F(CongestionControlTest, shouldGrowCubicWindowWithoutLossAndBackOffOnLoss)
+{
+    ASSERT_EQ(createStrategy(aeron_cubic_congestion_control_strategy_supplier), 0);
+
+    const int32_t max_window = static_cast<int32_t>(m_context->initial_window_length);
+    bool should_force_sm = true;
+    int64_t now_ns = m_context->nano_clock() + (10 * 1000 * 1000 * 1000LL);
+
+    const int32_t grown_window = onTrackRebuild(now_ns, false, &should_force_sm);
+    EXPECT_FALSE(should_force_sm);
+    EXPECT_EQ(grown_window, max_window);
+    EXPECT_EQ(counterValue(AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_NAME), grown_window);
+
+    now_ns += 1000;
+    const int32_t reduced_window = onTrackRebuild(now_ns, true, &should_force_sm);
+    EXPECT_TRUE(should_force_sm);
+    EXPECT_LT(reduced_window, grown_window);
+    EXPECT_EQ(reduced_window % MTU_LENGTH, 0);
+    EXPECT_EQ(counterValue(AERON_CUBICCONGESTIONCONTROL_LOSS_INDICATOR_NAME), 1);
+    EXPECT_EQ(counterValue(AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_NAME), reduced_window);
+
+    now_ns += 1000;
+    EXPECT_EQ(onTrackRebuild(now_ns, false, &should_force_sm), reduced_window) << "window updated within an RTT";
+}
+
+TEST_F(CongestionControlTest, shouldLimitOutstandingRttMeasurementsAndRecordRtt)
+{
+    ASSERT_EQ(createStrategy(aeron_cubic_congestion_control_strategy_supplier), 0);
+
+    int64_t now_ns = m_context->nano_clock();
+
+    ASSERT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+    m_strategy->on_rttm_sent(m_strategy->state, now_ns);
+
+    now_ns += 20 * 1000 * 1000;
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    now_ns += 2 * 1000 * 1000 * 1000LL;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns)) << "reply assumed lost";
+    m_strategy->on_rttm_sent(m_strategy->state, now_ns);
+
+    m_strategy->on_rttm(m_strategy->state, now_ns, 250 * 1000, nullptr);
+    EXPECT_EQ(counterValue(AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_NAME), 250 * 1000);
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    now_ns += 20 * 1000 * 1000;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+}
+
+TEST_F(CongestionControlTest, shouldNotMeasureRttWithStaticWindow)
+{
+    ASSERT_EQ(createStrategy(aeron_static_window_congestion_control_strategy_supplier), 0);
+
+    bool should_force_sm = true;
+    const int32_t window = m_strategy->initial_window_length(m_strategy->state);
+
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, m_context->nano_clock()));
+    EXPECT_EQ(onTrackRebuild(m_context->nano_clock(), true, &should_force_sm), window);
+    EXPECT_FALSE(should_force_sm);
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+#include "aeron_driver_conductor_test.h"
+
+static const int DUTY_CYCLES = 1000;
+static const size_t IMAGE_COUNTS[] = { 1, 10, 100, 500, 1000 };
+
+/*
+ * Time of a conductor duty cycle, with no client commands, as the number of images grows. Simulated time advances by
+ * a millisecond per duty cycle so the periodic image sweep is included in the average. The full scan mode marks every
+ * image for rebuild on every duty cycle, which is what the conductor did before images were tracked from receiver
+ * signals.
+ */
+class DriverConductorBenchmark : public DriverConductorTest
+{
+public:
+    void TestBody() override
+    {
+    }
+
+    void createImages(size_t count)
+    {
+        const int64_t client_id = nextCorrelationId();
+
+        if (addNetworkSubscription(client_id, nextCorrelationId(), CHANNEL_1, STREAM_ID_1, -1) < 0)
+        {
+            throw std::runtime_error("could not add subscription");
+        }
+        doWork();
+
+        aeron_receive_channel_endpoint_t *endpoint = aeron_driver_conductor_find_receive_channel_endpoint(
+            &m_conductor.m_conductor, CHANNEL_1);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            aeron_command_create_publication_image_t cmd;
+
+            cmd.base.func = aeron_driver_conductor_on_create_publication_image;
+            cmd.base.item = NULL;
+            cmd.endpoint = endpoint;
+            cmd.session_id = SESSION_ID + (int32_t)i;
+            cmd.stream_id = STREAM_ID_1;
+            cmd.term_offset = 0;
+            cmd.active_term_id = INITIAL_TERM_ID;
+            cmd.initial_term_id = INITIAL_TERM_ID;
+            cmd.mtu_length = (int32_t)m_context.m_context->mtu_length;
+            cmd.term_length = TERM_LENGTH;
+
+            fill_sockaddr_ipv4(&cmd.src_address, SRC_IP_ADDR, SRC_UDP_PORT);
+            fill_sockaddr_ipv4(&cmd.control_address, CONTROL_IP_ADDR, CONTROL_UDP_PORT);
+
+            aeron_driver_conductor_on_create_publication_image(&m_conductor.m_conductor, &cmd);
+        }
+
+        if (aeron_driver_conductor_num_images(&m_conductor.m_conductor) != count)
+        {
+            throw std::runtime_error("could not create images");
+        }
+
+        readAllBroadcastsFromConductor(null_handler);
+    }
+
+    double nanosPerDutyCycle(bool isFullScan)
+    {
+        aeron_driver_conductor_t *conductor = &m_conductor.m_conductor;
+        std::chrono::steady_clock::duration elapsed(0);
+
+        for (int i = 0; i < DUTY_CYCLES; i++)
+        {
+            ms_timestamp++;
+
+            const auto start = std::chrono::steady_clock::now();
+            if (isFullScan)
+            {
+                for (size_t j = 0, length = conductor->publication_images.length; j < length; j++)
+                {
+                    aeron_driver_conductor_mark_image_for_rebuild(
+                        conductor, conductor->publication_images.array[j].image);
+                }
+            }
+
+            doWork();
+            elapsed += std::chrono::steady_clock::now() - start;
+        }
+
+        return std::chrono::duration<double, std::nano>(elapsed).count() / DUTY_CYCLES;
+    }
+};
+
+int main(int argc, char **argv)
+{
+    std::cout << std::left << std::setw(10) << "images"
+        << std::setw(20) << "signalled ns/cycle"
+        << std::setw(20) << "full scan ns/cycle" << "\n";
+
+    for (size_t count : IMAGE_COUNTS)
+    {
+        double signalledNanos;
+        double fullScanNanos;
+
+        {
+            DriverConductorBenchmark benchmark;
+            benchmark.createImages(count);
+            signalledNanos = benchmark.nanosPerDutyCycle(false);
+        }
+
+        {
+            DriverConductorBenchmark benchmark;
+            benchmark.createImages(count);
+            fullScanNanos = benchmark.nanosPerDutyCycle(true);
+        }
+
+        std::cout << std::left << std::setw(10) << count << std::fixed << std::setprecision(1)
+            << std::setw(20) << signalledNanos
+            << std::setw(20) << fullScanNanos << "\n";
+    }
+
+    return 0;
+}
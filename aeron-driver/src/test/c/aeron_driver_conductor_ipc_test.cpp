@@ -146,6 +146,72 @@ TEST_F(DriverConductorIpcTest, shouldBeAbleToAddMultipleIpcPublications)
     EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 4u);
 }
 
+TEST_F(DriverConductorIpcTest, shouldBeAbleToAddIpcPublicationsAndSubscriptionInOneCommandBatch)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t batch_id = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+    int64_t pub_id_2 = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addIpcCommandBatch(
+        client_id,
+        batch_id,
+        {
+            { AERON_COMMAND_ADD_PUBLICATION, pub_id_1 },
+            { AERON_COMMAND_ADD_EXCLUSIVE_PUBLICATION, pub_id_2 },
+            { AERON_COMMAND_ADD_SUBSCRIPTION, sub_id }
+        }), 0);
+    doWork();
+
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 2u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor), 1u);
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_BATCH);
+
+        const command::BatchMessageFlyweight batch(buffer, offset);
+        ASSERT_EQ(batch.entryCount(), 3);
+        EXPECT_EQ(batch.clientId(), client_id);
+        EXPECT_EQ(batch.correlationId(), batch_id);
+
+        util::index_t entry_offset = command::BatchMessageFlyweight::firstEntryOffset();
+        util::index_t message_offset = offset + command::BatchMessageFlyweight::entryMessageOffset(entry_offset);
+        EXPECT_EQ(batch.entryMsgTypeId(entry_offset), AERON_RESPONSE_ON_PUBLICATION_READY);
+        EXPECT_EQ(command::PublicationBuffersReadyFlyweight(buffer, message_offset).correlationId(), pub_id_1);
+
+        entry_offset = command::BatchMessageFlyweight::nextEntryOffset(entry_offset, batch.entryLength(entry_offset));
+        message_offset = offset + command::BatchMessageFlyweight::entryMessageOffset(entry_offset);
+        EXPECT_EQ(batch.entryMsgTypeId(entry_offset), AERON_RESPONSE_ON_EXCLUSIVE_PUBLICATION_READY);
+        EXPECT_EQ(command::PublicationBuffersReadyFlyweight(buffer, message_offset).correlationId(), pub_id_2);
+
+        entry_offset = command::BatchMessageFlyweight::nextEntryOffset(entry_offset, batch.entryLength(entry_offset));
+        message_offset = offset + command::BatchMessageFlyweight::entryMessageOffset(entry_offset);
+        EXPECT_EQ(batch.entryMsgTypeId(entry_offset), AERON_RESPONSE_ON_SUBSCRIPTION_READY);
+        EXPECT_EQ(command::SubscriptionReadyFlyweight(buffer, message_offset).correlationId(), sub_id);
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+}
+
+TEST_F(DriverConductorIpcTest, shouldSendSingleResponseFromCommandBatchWithoutBatch)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addIpcCommandBatch(client_id, nextCorrelationId(), { { AERON_COMMAND_ADD_PUBLICATION, pub_id } }), 0);
+    doWork();
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_PUBLICATION_READY);
+        EXPECT_EQ(command::PublicationBuffersReadyFlyweight(buffer, offset).correlationId(), pub_id);
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+}
+
 TEST_F(DriverConductorIpcTest, shouldBeAbleToAddAndRemoveMultipleIpcPublicationsToSameStreamId)
 {
     int64_t client_id = nextCorrelationId();
@@ -672,6 +672,59 @@ TEST_F(DriverConductorNetworkTest, shouldCreatePublicationImageForActiveNetworkS
     EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
 }
 
+TEST_F(DriverConductorNetworkTest, shouldOnlyTrackImageRebuildWhileReceivedDataIsUnconsumed)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint = aeron_driver_conductor_find_receive_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
+
+    aeron_publication_image_t *image = aeron_driver_conductor_find_publication_image(
+        &m_conductor.m_conductor, endpoint, STREAM_ID_1);
+    ASSERT_NE(image, (aeron_publication_image_t *)NULL);
+    EXPECT_TRUE(image->conductor_fields.is_rebuild_pending);
+    EXPECT_EQ(m_conductor.m_conductor.rebuild_images.length, 1u);
+
+    doWork();
+    EXPECT_FALSE(image->conductor_fields.is_rebuild_pending);
+    EXPECT_EQ(m_conductor.m_conductor.rebuild_images.length, 0u);
+
+    aeron_spsc_concurrent_array_queue_t *queue = &m_context.m_context->image_rebuild_queue;
+    aeron_publication_image_signal_rebuild(image, queue);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(queue), 0u);
+
+    const int64_t join_position = aeron_counter_get(image->rcv_hwm_position.value_addr);
+    const int64_t hwm_position = join_position + 1024;
+    const size_t index = aeron_logbuffer_index_by_position(join_position, image->position_bits_to_shift);
+    aeron_data_header_t *data_header = (aeron_data_header_t *)image->mapped_raw_log.term_buffers[index].addr;
+
+    data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+    data_header->frame_header.frame_length = 1024;
+    aeron_counter_set_ordered(image->rcv_hwm_position.value_addr, hwm_position);
+    aeron_publication_image_signal_rebuild(image, queue);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(queue), 1u);
+
+    doWork();
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(queue), 0u);
+    EXPECT_TRUE(image->conductor_fields.is_rebuild_pending);
+
+    doWork();
+    EXPECT_TRUE(image->conductor_fields.is_rebuild_pending);
+
+    EXPECT_EQ(aeron_counter_get(image->rcv_pos_position.value_addr), hwm_position);
+    aeron_counter_set_ordered(image->conductor_fields.subscribable.array[0].value_addr, hwm_position);
+
+    doWork();
+    EXPECT_FALSE(image->conductor_fields.is_rebuild_pending);
+    EXPECT_EQ(m_conductor.m_conductor.rebuild_images.length, 0u);
+}
+
 TEST_F(DriverConductorNetworkTest, shouldNotCreatePublicationImageForNonActiveNetworkSubscription)
 {
     int64_t client_id = nextCorrelationId();
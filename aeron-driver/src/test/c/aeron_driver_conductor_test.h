@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <thread>
 #include <exception>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <concurrent/CountersReader.h>
@@ -48,6 +49,7 @@ extern "C"
 #include "command/CounterMessageFlyweight.h"
 #include "command/CounterUpdateFlyweight.h"
 #include "command/ClientTimeoutFlyweight.h"
+#include "command/BatchMessageFlyweight.h"
 
 using namespace aeron::concurrent::broadcast;
 using namespace aeron::concurrent::ringbuffer;
@@ -373,6 +375,53 @@ public:
         return writeCommand(AERON_COMMAND_REMOVE_COUNTER, command.length());
     }
 
+    int addIpcCommandBatch(
+        int64_t client_id, int64_t correlation_id, const std::vector<std::pair<int32_t, int64_t>> &commands)
+    {
+        command::BatchMessageFlyweight batch(m_command, 0);
+        util::index_t entry_offset = command::BatchMessageFlyweight::firstEntryOffset();
+        util::index_t length = entry_offset;
+
+        for (size_t i = 0; i < commands.size(); i++)
+        {
+            AERON_DECL_ALIGNED(uint8_t entry_buffer[AERON_MAX_PATH], 16);
+            AtomicBuffer entry(entry_buffer, sizeof(entry_buffer));
+            const int32_t msg_type_id = commands[i].first;
+            util::index_t entry_length;
+
+            if (AERON_COMMAND_ADD_SUBSCRIPTION == msg_type_id)
+            {
+                command::SubscriptionMessageFlyweight command(entry, 0);
+
+                command.clientId(client_id);
+                command.correlationId(commands[i].second);
+                command.streamId(STREAM_ID_1 + (int32_t)i);
+                command.registrationCorrelationId(-1);
+                command.channel(AERON_IPC_CHANNEL);
+                entry_length = command.length();
+            }
+            else
+            {
+                command::PublicationMessageFlyweight command(entry, 0);
+
+                command.clientId(client_id);
+                command.correlationId(commands[i].second);
+                command.streamId(STREAM_ID_1 + (int32_t)i);
+                command.channel(AERON_IPC_CHANNEL);
+                entry_length = command.length();
+            }
+
+            length = batch.putEntry(entry_offset, msg_type_id, entry_buffer, entry_length);
+            entry_offset = command::BatchMessageFlyweight::nextEntryOffset(entry_offset, entry_length);
+        }
+
+        batch.clientId(client_id);
+        batch.correlationId(correlation_id);
+        batch.entryCount((int32_t)commands.size());
+
+        return writeCommand(AERON_COMMAND_BATCH, length);
+    }
+
     template<typename F>
     bool findCounter(int32_t counter_id, F&& func)
     {
@@ -14,13 +14,41 @@
  * limitations under the License.
  */
 
+#include <fstream>
 #include <functional>
+#include <sstream>
+#include <string>
 
 #include <gtest/gtest.h>
+#include "aeron_gtest_compat.h"
 
 extern "C"
 {
 #include "aeronmd.h"
+#include "aeron_driver.h"
+#include "aeron_driver_context.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
+#include "util/aeron_affinity.h"
+#include "util/aeron_fileutil.h"
+}
+
+static std::string hugetlbfsMountPoint()
+{
+    std::ifstream mounts("/proc/mounts");
+    std::string line;
+
+    while (std::getline(mounts, line))
+    {
+        std::istringstream fields(line);
+        std::string device, mountPoint, type;
+
+        if (fields >> device >> mountPoint >> type && "hugetlbfs" == type)
+        {
+            return mountPoint;
+        }
+    }
+
+    return "";
 }
 
 class DriverConfigurationTest : public testing::Test
@@ -54,3 +82,148 @@ TEST_F(DriverConfigurationTest, shouldNotFindNonBuiltinFlowControlStrategies)
 {
     EXPECT_EQ(aeron_flow_control_strategy_supplier_by_name("should not be found"), nullptr);
 }
+
+TEST_F(DriverConfigurationTest, shouldRejectOutOfRangeNetworkPublicationMaxMessagesPerSend)
+{
+    EXPECT_EQ(aeron_driver_context_set_network_publication_max_messages_per_send(m_context, 0), -1);
+    EXPECT_EQ(aeron_driver_context_set_network_publication_max_messages_per_send(m_context, 65), -1);
+    EXPECT_EQ(aeron_driver_context_set_network_publication_max_messages_per_send(m_context, 64), 0);
+    EXPECT_EQ(aeron_driver_context_get_network_publication_max_messages_per_send(m_context), 64u);
+}
+
+TEST_F(DriverConfigurationTest, shouldRejectOutOfRangeIoVectorCapacity)
+{
+    EXPECT_EQ(aeron_driver_context_set_receiver_io_vector_capacity(m_context, 0), -1);
+    EXPECT_EQ(aeron_driver_context_set_receiver_io_vector_capacity(m_context, 65), -1);
+    EXPECT_EQ(aeron_driver_context_set_receiver_io_vector_capacity(m_context, 16), 0);
+    EXPECT_EQ(aeron_driver_context_get_receiver_io_vector_capacity(m_context), 16u);
+
+    EXPECT_EQ(aeron_driver_context_set_sender_io_vector_capacity(m_context, 0), -1);
+    EXPECT_EQ(aeron_driver_context_set_sender_io_vector_capacity(m_context, 65), -1);
+    EXPECT_EQ(aeron_driver_context_set_sender_io_vector_capacity(m_context, 8), 0);
+    EXPECT_EQ(aeron_driver_context_get_sender_io_vector_capacity(m_context), 8u);
+}
+
+TEST_F(DriverConfigurationTest, shouldDefaultUdpOffloadsToDisabled)
+{
+    EXPECT_FALSE(aeron_driver_context_get_socket_udp_gso(m_context));
+    EXPECT_FALSE(aeron_driver_context_get_socket_udp_gro(m_context));
+
+    EXPECT_EQ(aeron_driver_context_set_socket_udp_gso(m_context, true), 0);
+    EXPECT_EQ(aeron_driver_context_set_socket_udp_gro(m_context, true), 0);
+    EXPECT_TRUE(aeron_driver_context_get_socket_udp_gso(m_context));
+    EXPECT_TRUE(aeron_driver_context_get_socket_udp_gro(m_context));
+}
+
+TEST_F(DriverConfigurationTest, shouldRejectNonPowerOfTwoIoUringBufferCount)
+{
+    EXPECT_FALSE(aeron_driver_context_get_udp_transport_poller_io_uring(m_context));
+    EXPECT_EQ(aeron_driver_context_get_udp_transport_poller_io_uring_buffer_count(m_context), 256u);
+
+    EXPECT_EQ(aeron_driver_context_set_udp_transport_poller_io_uring_buffer_count(m_context, 0), -1);
+    EXPECT_EQ(aeron_driver_context_set_udp_transport_poller_io_uring_buffer_count(m_context, 100), -1);
+    EXPECT_EQ(aeron_driver_context_set_udp_transport_poller_io_uring_buffer_count(m_context, 65536), -1);
+    EXPECT_EQ(aeron_driver_context_set_udp_transport_poller_io_uring_buffer_count(m_context, 1024), 0);
+    EXPECT_EQ(aeron_driver_context_get_udp_transport_poller_io_uring_buffer_count(m_context), 1024u);
+}
+
+TEST_F(DriverConfigurationTest, shouldParseSignedConfigValuesAndRejectGarbage)
+{
+    EXPECT_EQ(aeron_config_parse_int64("TEST", nullptr, -1, INT64_MIN, INT64_MAX), -1);
+    EXPECT_EQ(aeron_config_parse_int64("TEST", "-7", -1, INT64_MIN, INT64_MAX), -7);
+    EXPECT_EQ(aeron_config_parse_int64("TEST", "0x10", -1, INT64_MIN, INT64_MAX), 16);
+    EXPECT_EQ(aeron_config_parse_int64("TEST", "-5", 3, 0, INT32_MAX), 0);
+    EXPECT_EQ(aeron_config_parse_int64("TEST", "abc", 3, 0, INT32_MAX), 3);
+    EXPECT_EQ(aeron_config_parse_int64("TEST", "12abc", 3, 0, INT32_MAX), 3);
+    EXPECT_EQ(aeron_config_parse_int64("TEST", "", 3, 0, INT32_MAX), 3);
+}
+
+TEST_F(DriverConfigurationTest, shouldRoundIoUringBufferCountFromEnvironmentUpToPowerOfTwo)
+{
+    aeron_driver_context_t *context = nullptr;
+
+    setenv(AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT_ENV_VAR, "100", 1);
+    ASSERT_EQ(aeron_driver_context_init(&context), 0);
+    unsetenv(AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT_ENV_VAR);
+
+    EXPECT_EQ(aeron_driver_context_get_udp_transport_poller_io_uring_buffer_count(context), 128u);
+    aeron_driver_context_close(context);
+}
+
+static int32_t conductorNumaNodeFromEnvironment(const char *value)
+{
+    aeron_driver_context_t *context = nullptr;
+
+    setenv(AERON_CONDUCTOR_NUMA_NODE_ENV_VAR, value, 1);
+    const int result = aeron_driver_context_init(&context);
+    unsetenv(AERON_CONDUCTOR_NUMA_NODE_ENV_VAR);
+
+    EXPECT_EQ(result, 0);
+    const int32_t numa_node = aeron_driver_context_get_conductor_numa_node(context);
+    aeron_driver_context_close(context);
+
+    return numa_node;
+}
+
+TEST_F(DriverConfigurationTest, shouldParseNumaNodeFromEnvironment)
+{
+    EXPECT_EQ(aeron_driver_context_get_conductor_numa_node(m_context), AERON_NUMA_NODE_NONE);
+    EXPECT_EQ(conductorNumaNodeFromEnvironment("2"), 2);
+    EXPECT_EQ(conductorNumaNodeFromEnvironment("-1"), AERON_NUMA_NODE_NONE);
+    EXPECT_EQ(conductorNumaNodeFromEnvironment("-7"), AERON_NUMA_NODE_NONE);
+    EXPECT_EQ(conductorNumaNodeFromEnvironment("abc"), AERON_NUMA_NODE_NONE);
+    EXPECT_EQ(conductorNumaNodeFromEnvironment("3x"), AERON_NUMA_NODE_NONE);
+}
+
+TEST_F(DriverConfigurationTest, shouldLoadUdpChannelTransportBindingsByName)
+{
+    EXPECT_EQ(
+        aeron_driver_context_get_udp_channel_transport_bindings(m_context), &aeron_udp_channel_transport_bindings_default);
+    EXPECT_EQ(
+        aeron_udp_channel_transport_bindings_load(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DEFAULT_NAME),
+        &aeron_udp_channel_transport_bindings_default);
+    EXPECT_EQ(aeron_udp_channel_transport_bindings_load("no_such_transport_bindings"), nullptr);
+
+    aeron_udp_channel_transport_bindings_t bindings = aeron_udp_channel_transport_bindings_default;
+
+    EXPECT_EQ(aeron_driver_context_set_udp_channel_transport_bindings(m_context, nullptr), -1);
+    EXPECT_EQ(aeron_driver_context_set_udp_channel_transport_bindings(m_context, &bindings), 0);
+    EXPECT_EQ(aeron_driver_context_get_udp_channel_transport_bindings(m_context), &bindings);
+}
+
+TEST_F(DriverConfigurationTest, shouldNotReportHugetlbfsPageSizeOutsideHugetlbfsMount)
+{
+    EXPECT_EQ(aeron_hugetlbfs_page_size("/tmp"), 0u);
+    EXPECT_EQ(aeron_hugetlbfs_page_size("/tmp/aeron-not-created/publications"), 0u);
+}
+
+TEST_F(DriverConfigurationTest, shouldValidatePageSizeAgainstHugetlbfsPageSize)
+{
+    const std::string mountPoint = hugetlbfsMountPoint();
+    if (mountPoint.empty())
+    {
+        GTEST_SKIP();
+    }
+
+    const uint64_t hugePageSize = aeron_hugetlbfs_page_size(mountPoint.c_str());
+    ASSERT_GT(hugePageSize, 0u);
+    ASSERT_EQ(aeron_driver_context_set_dir(m_context, (mountPoint + "/aeron-test").c_str()), 0);
+
+    aeron_driver_t driver = {};
+    driver.context = m_context;
+
+    m_context->file_page_size = hugePageSize;
+    EXPECT_EQ(aeron_driver_validate_page_size(&driver), 0) << aeron_errmsg();
+
+    if (hugePageSize * 2 <= AERON_PAGE_MAX_SIZE)
+    {
+        m_context->file_page_size = hugePageSize * 2;
+        EXPECT_EQ(aeron_driver_validate_page_size(&driver), 0) << aeron_errmsg();
+    }
+
+    if (hugePageSize / 2 >= AERON_PAGE_MIN_SIZE)
+    {
+        m_context->file_page_size = hugePageSize / 2;
+        EXPECT_EQ(aeron_driver_validate_page_size(&driver), -1);
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cerrno>
+
+#include <gtest/gtest.h>
+#include "aeron_gtest_compat.h"
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+extern "C"
+{
+#include "util/aeron_fileutil.h"
+}
+
+#define BLOCK_COUNT (4)
+
+class FileUtilTest : public testing::Test
+{
+public:
+    FileUtilTest()
+    {
+        m_buffer.fill(0xFF);
+    }
+
+protected:
+    std::array<uint8_t, (BLOCK_COUNT * AERON_BLOCK_SIZE) + 1> m_buffer = {};
+};
+
+TEST_F(FileUtilTest, shouldTouchFirstByteOfEveryBlock)
+{
+    aeron_touch_pages(m_buffer.data(), m_buffer.size(), AERON_BLOCK_SIZE);
+
+    for (size_t i = 0; i < m_buffer.size(); i++)
+    {
+        ASSERT_EQ(m_buffer[i], 0 == (i % AERON_BLOCK_SIZE) ? 0u : 0xFFu) << "index " << i;
+    }
+}
+
+TEST_F(FileUtilTest, shouldOnlyTouchWithinLength)
+{
+    aeron_touch_pages(m_buffer.data(), AERON_BLOCK_SIZE, AERON_BLOCK_SIZE);
+
+    EXPECT_EQ(m_buffer[0], 0u);
+    EXPECT_EQ(m_buffer[AERON_BLOCK_SIZE], 0xFFu);
+}
+
+#if !defined(_WIN32)
+TEST_F(FileUtilTest, shouldNotAdviseHugePagesForOsPageSize)
+{
+    const size_t os_page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+    EXPECT_EQ(aeron_advise_huge_pages(m_buffer.data(), m_buffer.size(), os_page_size), 0);
+}
+
+TEST_F(FileUtilTest, shouldAdviseHugePagesOnRegularMapping)
+{
+    const size_t huge_page_size = 2 * 1024 * 1024;
+    const size_t length = 2 * huge_page_size;
+    void *addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(addr, MAP_FAILED);
+
+    const int result = aeron_advise_huge_pages(addr, length, huge_page_size);
+    const int errcode = errno;
+    munmap(addr, length);
+
+    if (result < 0 && EINVAL == errcode)
+    {
+        /* kernel built without transparent huge page support */
+        GTEST_SKIP();
+    }
+
+    EXPECT_EQ(result, 0);
+}
+#endif
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "protocol/aeron_udp_protocol.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_bitutil.h"
+#include "aeron_flow_control.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define POSITION_BITS_TO_SHIFT (aeron_number_of_trailing_zeroes(TERM_LENGTH))
+#define INITIAL_TERM_ID (0)
+#define WINDOW_LENGTH (16 * 1024)
+#define GROUP_TAG (101)
+
+class FlowControlTest : public testing::Test
+{
+public:
+    ~FlowControlTest() override
+    {
+        if (nullptr != m_strategy)
+        {
+            m_strategy->fini(m_strategy);
+        }
+    }
+
+    int createStrategy(aeron_flow_control_strategy_supplier_func_t supplier, const char *channel)
+    {
+        return supplier(&m_strategy, strlen(channel), channel, 1001, 1, INITIAL_TERM_ID, TERM_LENGTH);
+    }
+
+    int64_t onStatusMessage(int64_t receiver_id, int32_t term_offset, bool has_tag, int64_t tag, int64_t snd_lmt)
+    {
+        std::array<uint8_t, sizeof(aeron_status_message_header_t) + AERON_STATUS_MESSAGE_GROUP_TAG_LENGTH> buffer = {};
+        auto *sm = reinterpret_cast<aeron_status_message_header_t *>(buffer.data());
+        size_t length = sizeof(aeron_status_message_header_t);
+
+        sm->frame_header.type = AERON_HDR_TYPE_SM;
+        sm->consumption_term_id = INITIAL_TERM_ID;
+        sm->consumption_term_offset = term_offset;
+        sm->receiver_window = WINDOW_LENGTH;
+        sm->receiver_id = receiver_id;
+
+        if (has_tag)
+        {
+            memcpy(buffer.data() + length, &tag, sizeof(tag));
+            length += AERON_STATUS_MESSAGE_GROUP_TAG_LENGTH;
+        }
+
+        sm->frame_header.frame_length = static_cast<int32_t>(length);
+
+        return m_strategy->on_status_message(
+            m_strategy->state,
+            buffer.data(),
+            length,
+            &m_addr,
+            snd_lmt,
+            INITIAL_TERM_ID,
+            POSITION_BITS_TO_SHIFT,
+            0);
+    }
+
+protected:
+    aeron_flow_control_strategy_t *m_strategy = nullptr;
+    struct sockaddr_storage m_addr = {};
+};
+
+TEST_F(FlowControlTest, shouldResolveStrategyFromUriValue)
+{
+    EXPECT_TRUE(aeron_flow_control_strategy_supplier_from_uri_value("max") ==
+        aeron_max_multicast_flow_control_strategy_supplier);
+    EXPECT_TRUE(aeron_flow_control_strategy_supplier_from_uri_value("min,g:/3") ==
+        aeron_min_flow_control_strategy_supplier);
+    EXPECT_TRUE(aeron_flow_control_strategy_supplier_from_uri_value("tagged,g:101/3") ==
+        aeron_tagged_flow_control_strategy_supplier);
+    EXPECT_TRUE(aeron_flow_control_strategy_supplier_from_uri_value("minimum") == nullptr);
+}
+
+TEST_F(FlowControlTest, shouldParseGroupOption)
+{
+    int64_t group_tag = -1;
+    int32_t group_min_size = 0;
+
+    EXPECT_EQ(aeron_flow_control_parse_group_option("tagged", &group_tag, &group_min_size), 0);
+    EXPECT_EQ(group_tag, -1);
+    EXPECT_EQ(group_min_size, 0);
+
+    EXPECT_EQ(aeron_flow_control_parse_group_option("tagged,g:101", &group_tag, &group_min_size), 0);
+    EXPECT_EQ(group_tag, 101);
+    EXPECT_EQ(group_min_size, 0);
+
+    EXPECT_EQ(aeron_flow_control_parse_group_option("min,g:/3", &group_tag, &group_min_size), 0);
+    EXPECT_EQ(group_tag, 101);
+    EXPECT_EQ(group_min_size, 3);
+
+    EXPECT_EQ(aeron_flow_control_parse_group_option("tagged,g:-7/5", &group_tag, &group_min_size), 0);
+    EXPECT_EQ(group_tag, -7);
+    EXPECT_EQ(group_min_size, 5);
+
+    EXPECT_EQ(aeron_flow_control_parse_group_option("tagged,g:x/5", &group_tag, &group_min_size), -1);
+    EXPECT_EQ(aeron_flow_control_parse_group_option("tagged,g:1/-5", &group_tag, &group_min_size), -1);
+}
+
+TEST_F(FlowControlTest, shouldOnlyTrackReceiversWithGroupTag)
+{
+    ASSERT_EQ(createStrategy(
+        aeron_tagged_flow_control_strategy_supplier, "aeron:udp?endpoint=224.0.1.1:40456|fc=tagged,g:101"), 0);
+
+    EXPECT_FALSE(m_strategy->has_required_receivers(m_strategy));
+
+    EXPECT_EQ(onStatusMessage(1, 0, false, 0, 0), 0) << "untagged receiver";
+    EXPECT_EQ(onStatusMessage(2, 0, true, GROUP_TAG + 1, 0), 0) << "receiver in another group";
+    EXPECT_FALSE(m_strategy->has_required_receivers(m_strategy));
+
+    EXPECT_EQ(onStatusMessage(3, 1024, true, GROUP_TAG, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_TRUE(m_strategy->has_required_receivers(m_strategy));
+
+    EXPECT_EQ(onStatusMessage(1, 0, false, 0, 1024 + WINDOW_LENGTH), 1024 + WINDOW_LENGTH) << "slow untagged receiver";
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, 0, 0, 0, false), 1024 + WINDOW_LENGTH);
+}
+
+TEST_F(FlowControlTest, shouldHoldSenderLimitUntilGroupMinSizeReached)
+{
+    ASSERT_EQ(createStrategy(
+        aeron_tagged_flow_control_strategy_supplier, "aeron:udp?endpoint=224.0.1.1:40456|fc=tagged,g:101/2"), 0);
+
+    EXPECT_EQ(onStatusMessage(1, 2048, true, GROUP_TAG, 0), 0);
+    EXPECT_FALSE(m_strategy->has_required_receivers(m_strategy));
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, 0, 0, 0, false), 0);
+
+    EXPECT_EQ(onStatusMessage(2, 1024, true, GROUP_TAG, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_TRUE(m_strategy->has_required_receivers(m_strategy));
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, 0, 0, 0, false), 1024 + WINDOW_LENGTH);
+}
+
+TEST_F(FlowControlTest, shouldApplyGroupMinSizeToMinStrategy)
+{
+    ASSERT_EQ(createStrategy(
+        aeron_min_flow_control_strategy_supplier, "aeron:udp?endpoint=224.0.1.1:40456|fc=min,g:/2"), 0);
+
+    EXPECT_EQ(onStatusMessage(1, 1024, false, 0, 0), 0);
+    EXPECT_FALSE(m_strategy->has_required_receivers(m_strategy));
+
+    EXPECT_EQ(onStatusMessage(2, 2048, true, GROUP_TAG, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_TRUE(m_strategy->has_required_receivers(m_strategy));
+}
+
+TEST_F(FlowControlTest, shouldRejectInvalidGroupOption)
+{
+    EXPECT_EQ(createStrategy(
+        aeron_tagged_flow_control_strategy_supplier, "aeron:udp?endpoint=224.0.1.1:40456|fc=tagged,g:abc"), -1);
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_GTEST_COMPAT_H
+#define AERON_GTEST_COMPAT_H
+
+#include <gtest/gtest.h>
+
+/*
+ * GTEST_SKIP() arrived in googletest 1.10, the bundled 1.8.0 can only end the test early with a message. The test is
+ * then still counted as passed but the output carries the reason it did not run.
+ */
+#if !defined(GTEST_SKIP)
+#define GTEST_SKIP() return GTEST_MESSAGE_("Skipped", ::testing::TestPartResult::kSuccess)
+#endif
+
+#endif //AERON_GTEST_COMPAT_H
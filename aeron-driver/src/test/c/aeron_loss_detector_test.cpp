@@ -15,6 +15,7 @@
  */
 
 #include <array>
+#include <vector>
 #include <functional>
 
 #include <gtest/gtest.h>
@@ -181,6 +182,82 @@ int64_t static_feedback_generator_20ms(aeron_feedback_delay_generator_state_t *s
     return 20 * 1000 * 1000LL;
 }
 
+static void fillFrames(uint8_t *ptr, int32_t frame_length, int count)
+{
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    for (int i = 0; i < count; i++)
+    {
+        aeron_frame_header_t *hdr = (aeron_frame_header_t *)(ptr + (i * aligned_frame_length));
+        hdr->frame_length = frame_length;
+        hdr->type = AERON_HDR_TYPE_DATA;
+    }
+}
+
+TEST_F(TermGapScannerTest, shouldReportLongGapAfterRunOfSmallMessagesWithAndWithoutSimd)
+{
+    const int32_t frame_length = HEADER_LENGTH + 64;
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int32_t tail = 20 * aligned_frame_length;
+    const int32_t next_frame_offset = tail + 2048;
+    const int32_t high_water_mark = next_frame_offset + aligned_frame_length;
+
+    fillFrames(m_ptr, frame_length, 20);
+    fillFrames(m_ptr + next_frame_offset, frame_length, 1);
+
+    for (bool simd : { false, true })
+    {
+        aeron_term_scanner_simd_enable(simd);
+
+        bool on_gap_detected_called = false;
+        m_on_gap_detected =
+            [&](int32_t term_id, int32_t term_offset, size_t length)
+            {
+                EXPECT_EQ(term_id, TERM_ID);
+                EXPECT_EQ(term_offset, tail);
+                EXPECT_EQ(length, (size_t)(next_frame_offset - tail));
+                on_gap_detected_called = true;
+            };
+
+        ASSERT_EQ(aeron_term_gap_scanner_scan_for_gap(
+            m_ptr, TERM_ID, 0, high_water_mark, TermGapScannerTest::on_gap_detected, this), tail);
+
+        EXPECT_TRUE(on_gap_detected_called);
+    }
+
+    aeron_term_scanner_simd_enable(true);
+}
+
+TEST_F(TermGapScannerTest, shouldReportGapUpToHighWaterMarkWithAndWithoutSimd)
+{
+    const int32_t frame_length = HEADER_LENGTH + 64;
+    const int32_t tail = 3 * AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int32_t high_water_mark = 4096 + (AERON_LOGBUFFER_FRAME_ALIGNMENT * 3);
+
+    fillFrames(m_ptr, frame_length, 3);
+
+    for (bool simd : { false, true })
+    {
+        aeron_term_scanner_simd_enable(simd);
+
+        bool on_gap_detected_called = false;
+        m_on_gap_detected =
+            [&](int32_t term_id, int32_t term_offset, size_t length)
+            {
+                EXPECT_EQ(term_offset, tail);
+                EXPECT_EQ(length, (size_t)(high_water_mark - tail));
+                on_gap_detected_called = true;
+            };
+
+        ASSERT_EQ(aeron_term_gap_scanner_scan_for_gap(
+            m_ptr, TERM_ID, 0, high_water_mark, TermGapScannerTest::on_gap_detected, this), tail);
+
+        EXPECT_TRUE(on_gap_detected_called);
+    }
+
+    aeron_term_scanner_simd_enable(true);
+}
+
 class LossDetectorTest : public testing::Test
 {
 public:
@@ -237,7 +314,7 @@ TEST_F(LossDetectorTest, shouldNotSendNakWhenBufferIsEmpty)
 
     ASSERT_EQ(feedback_delay_state_init(true), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [](int32_t term_id, int32_t term_offset, size_t length) { FAIL(); };
 
@@ -265,7 +342,7 @@ TEST_F(LossDetectorTest, shouldNotNakIfNoMissingData)
 
     ASSERT_EQ(feedback_delay_state_init(true), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [](int32_t term_id, int32_t term_offset, size_t length) { FAIL(); };
 
@@ -293,7 +370,7 @@ TEST_F(LossDetectorTest, shouldNakMissingData)
 
     ASSERT_EQ(feedback_delay_state_init(false), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -329,7 +406,7 @@ TEST_F(LossDetectorTest, shouldRetransmitNakForMissingData)
 
     ASSERT_EQ(feedback_delay_state_init(false), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -372,7 +449,7 @@ TEST_F(LossDetectorTest, shouldStopNakOnReceivingData)
 
     ASSERT_EQ(feedback_delay_state_init(false), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -420,7 +497,7 @@ TEST_F(LossDetectorTest, shouldHandleMoreThan2Gaps)
 
     ASSERT_EQ(feedback_delay_state_init(false), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -480,7 +557,7 @@ TEST_F(LossDetectorTest, shouldReplaceOldNakWithNewNak)
 
     ASSERT_EQ(feedback_delay_state_init(false), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -534,7 +611,7 @@ TEST_F(LossDetectorTest, shouldHandleImmediateNak)
 
     ASSERT_EQ(feedback_delay_state_init(true), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -563,7 +640,7 @@ TEST_F(LossDetectorTest, shouldNotNakImmediatelyByDefault)
 
     ASSERT_EQ(feedback_delay_state_init(false), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -592,7 +669,7 @@ TEST_F(LossDetectorTest, shouldOnlySendNaksOnceOnMultipleScans)
 
     ASSERT_EQ(feedback_delay_state_init(true), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -626,7 +703,7 @@ TEST_F(LossDetectorTest, shouldHandleHwmGreaterThanCompletedBuffer)
 
     ASSERT_EQ(feedback_delay_state_init(true), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -655,7 +732,7 @@ TEST_F(LossDetectorTest, shouldHandleNonZeroInitialTermOffset)
 
     ASSERT_EQ(feedback_delay_state_init(true), 0);
     ASSERT_EQ(aeron_loss_detector_init(
-        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
 
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
@@ -671,3 +748,102 @@ TEST_F(LossDetectorTest, shouldHandleNonZeroInitialTermOffset)
     EXPECT_EQ(called, 1);
     EXPECT_TRUE(loss_found);
 }
+
+TEST_F(LossDetectorTest, shouldReportAllGapsInScanWhenTrackingMultipleGaps)
+{
+    const int64_t rebuild_position = 0;
+    const int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 5);
+    bool loss_found;
+    std::vector<int32_t> gap_offsets;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+    insert_frame(offset_of_message(4));
+
+    ASSERT_EQ(feedback_delay_state_init(true), 0);
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 4), 0);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_id, TERM_ID);
+        EXPECT_EQ(length, ALIGNED_FRAME_LENGTH);
+        gap_offsets.push_back(term_offset);
+    };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(loss_found);
+    EXPECT_EQ(gap_offsets, std::vector<int32_t>({ offset_of_message(1), offset_of_message(3) }));
+}
+
+TEST_F(LossDetectorTest, shouldOnlyReportFirstGapWhenTrackingSingleGap)
+{
+    const int64_t rebuild_position = 0;
+    const int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 5);
+    bool loss_found;
+    std::vector<int32_t> gap_offsets;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+    insert_frame(offset_of_message(4));
+
+    ASSERT_EQ(feedback_delay_state_init(true), 0);
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 1), 0);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        gap_offsets.push_back(term_offset);
+    };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(loss_found);
+    EXPECT_EQ(gap_offsets, std::vector<int32_t>({ offset_of_message(1) }));
+}
+
+TEST_F(LossDetectorTest, shouldAddGapFoundWhileWaitingForTimerToNextReport)
+{
+    const int64_t rebuild_position = 0;
+    int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 3);
+    bool loss_found;
+    std::vector<int32_t> gap_offsets;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+
+    ASSERT_EQ(feedback_delay_state_init(false), 0);
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this, 4), 0);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        gap_offsets.push_back(term_offset);
+    };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(loss_found);
+    EXPECT_TRUE(gap_offsets.empty());
+
+    insert_frame(offset_of_message(4));
+    hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 5);
+
+    m_time = 10 * 1000 * 1000L;
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_FALSE(loss_found);
+    EXPECT_TRUE(gap_offsets.empty());
+
+    m_time = 30 * 1000 * 1000L;
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_FALSE(loss_found);
+    EXPECT_EQ(gap_offsets, std::vector<int32_t>({ offset_of_message(1), offset_of_message(3) }));
+}
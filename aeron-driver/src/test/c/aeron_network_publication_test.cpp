@@ -0,0 +1,248 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include "protocol/aeron_udp_protocol.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "media/aeron_send_channel_endpoint.h"
+#include "aeron_network_publication.h"
+}
+
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT (103)
+#endif
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define MTU_LENGTH (1408)
+#define FRAME_LENGTH (1024)
+
+typedef std::array<std::uint8_t, TERM_LENGTH> term_buffer_t;
+
+struct sent_message_t
+{
+    size_t length;
+    size_t segment_length;
+};
+
+class NetworkPublicationTest : public testing::Test
+{
+public:
+    NetworkPublicationTest()
+    {
+        m_sent.clear();
+        m_term.fill(0);
+
+        m_bindings = aeron_udp_channel_transport_bindings_default;
+        m_bindings.sendmmsg_func = capture_sendmmsg;
+
+        m_endpoint.transport_bindings = &m_bindings;
+        m_endpoint.conductor_fields.udp_channel = &m_channel;
+        m_endpoint.destination_tracker = nullptr;
+
+        for (auto &term_buffer : m_publication.mapped_raw_log.term_buffers)
+        {
+            term_buffer.addr = m_term.data();
+            term_buffer.length = TERM_LENGTH;
+        }
+
+        m_publication.endpoint = &m_endpoint;
+        m_publication.term_length_mask = TERM_LENGTH - 1;
+        m_publication.position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes(TERM_LENGTH);
+        m_publication.mtu_length = MTU_LENGTH;
+        m_publication.max_messages_per_send = AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND;
+        m_publication.snd_pos_position.value_addr = &m_snd_pos;
+        m_publication.snd_lmt_position.value_addr = &m_snd_lmt;
+        m_publication.snd_bpe_counter.value_addr = &m_counter;
+        m_publication.short_sends_counter = &m_counter;
+        m_publication.heartbeats_sent_counter = &m_counter;
+        m_publication.sender_flow_control_limits_counter = &m_counter;
+        m_publication.send_batches_counter = &m_counter;
+        m_publication.send_batch_messages_counter = &m_counter;
+        m_publication.send_batches_at_limit_counter = &m_counter;
+        m_snd_lmt = TERM_LENGTH;
+    }
+
+    static int capture_sendmmsg(aeron_udp_channel_transport_t *transport, struct mmsghdr *msgvec, size_t vlen)
+    {
+        for (size_t i = 0; i < vlen; i++)
+        {
+            struct msghdr *message = &msgvec[i].msg_hdr;
+            size_t segment_length = 0;
+
+            if (NULL != message->msg_control)
+            {
+                for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(message); NULL != cmsg; cmsg = CMSG_NXTHDR(message, cmsg))
+                {
+                    if (IPPROTO_UDP == cmsg->cmsg_level && UDP_SEGMENT == cmsg->cmsg_type)
+                    {
+                        uint16_t gso_size;
+
+                        memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+                        segment_length = gso_size;
+                    }
+                }
+            }
+
+            m_sent.push_back({ message->msg_iov[0].iov_len, segment_length });
+            msgvec[i].msg_len = static_cast<unsigned int>(message->msg_iov[0].iov_len);
+        }
+
+        return static_cast<int>(vlen);
+    }
+
+    void appendFrames(size_t count, int32_t frame_length)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            auto *data_header = reinterpret_cast<aeron_data_header_t *>(m_term.data() + m_term_offset);
+
+            data_header->frame_header.frame_length = frame_length;
+            data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+            m_term_offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        }
+    }
+
+    int sendData()
+    {
+        return aeron_network_publication_send_data(&m_publication, 0, 0, 0);
+    }
+
+    static int64_t flow_control_on_sm(
+        void *state,
+        const uint8_t *sm,
+        size_t length,
+        struct sockaddr_storage *recv_addr,
+        int64_t snd_lmt,
+        int32_t initial_term_id,
+        size_t position_bits_to_shift,
+        int64_t now_ns)
+    {
+        return snd_lmt + TERM_LENGTH;
+    }
+
+protected:
+    static std::vector<sent_message_t> m_sent;
+
+    term_buffer_t m_term = {};
+    size_t m_term_offset = 0;
+    int64_t m_snd_pos = 0;
+    int64_t m_snd_lmt = 0;
+    int64_t m_counter = 0;
+    aeron_udp_channel_transport_bindings_t m_bindings = {};
+    aeron_udp_channel_t m_channel = {};
+    aeron_send_channel_endpoint_t m_endpoint = {};
+    aeron_network_publication_t m_publication = {};
+    aeron_flow_control_strategy_t m_flow_control = {};
+    aeron_logbuffer_metadata_t m_log_meta_data = {};
+    aeron_clock_cache_t m_cached_clock = {};
+};
+
+std::vector<sent_message_t> NetworkPublicationTest::m_sent;
+
+TEST_F(NetworkPublicationTest, shouldCoalesceEqualChunksIntoOneGsoMessage)
+{
+    m_endpoint.transport.gso_enabled = true;
+    appendFrames(4, FRAME_LENGTH);
+
+    EXPECT_EQ(sendData(), 4 * FRAME_LENGTH);
+    ASSERT_EQ(m_sent.size(), 1u);
+    EXPECT_EQ(m_sent[0].length, 4u * FRAME_LENGTH);
+    EXPECT_EQ(m_sent[0].segment_length, static_cast<size_t>(FRAME_LENGTH));
+    EXPECT_EQ(m_snd_pos, 4 * FRAME_LENGTH);
+}
+
+TEST_F(NetworkPublicationTest, shouldEndGsoRunWithShortLastSegment)
+{
+    const int32_t short_frame_length = FRAME_LENGTH / 2;
+
+    m_endpoint.transport.gso_enabled = true;
+    appendFrames(3, FRAME_LENGTH);
+    appendFrames(1, short_frame_length);
+    appendFrames(2, FRAME_LENGTH);
+
+    EXPECT_EQ(sendData(), 5 * FRAME_LENGTH + short_frame_length);
+    ASSERT_EQ(m_sent.size(), 2u);
+    EXPECT_EQ(m_sent[0].length, 3u * FRAME_LENGTH + short_frame_length);
+    EXPECT_EQ(m_sent[0].segment_length, static_cast<size_t>(FRAME_LENGTH));
+    EXPECT_EQ(m_sent[1].length, 2u * FRAME_LENGTH);
+    EXPECT_EQ(m_sent[1].segment_length, static_cast<size_t>(FRAME_LENGTH));
+}
+
+TEST_F(NetworkPublicationTest, shouldNotMarkSingleChunkAsGsoMessage)
+{
+    m_endpoint.transport.gso_enabled = true;
+    appendFrames(1, FRAME_LENGTH);
+
+    EXPECT_EQ(sendData(), FRAME_LENGTH);
+    ASSERT_EQ(m_sent.size(), 1u);
+    EXPECT_EQ(m_sent[0].length, static_cast<size_t>(FRAME_LENGTH));
+    EXPECT_EQ(m_sent[0].segment_length, 0u);
+}
+
+TEST_F(NetworkPublicationTest, shouldStartNewMessageForLongerChunk)
+{
+    m_endpoint.transport.gso_enabled = true;
+    appendFrames(1, FRAME_LENGTH);
+    appendFrames(1, MTU_LENGTH);
+
+    EXPECT_EQ(sendData(), FRAME_LENGTH + MTU_LENGTH);
+    ASSERT_EQ(m_sent.size(), 2u);
+    EXPECT_EQ(m_sent[0].length, static_cast<size_t>(FRAME_LENGTH));
+    EXPECT_EQ(m_sent[0].segment_length, 0u);
+    EXPECT_EQ(m_sent[1].length, static_cast<size_t>(MTU_LENGTH));
+    EXPECT_EQ(m_sent[1].segment_length, 0u);
+}
+
+TEST_F(NetworkPublicationTest, shouldSendOneMessagePerChunkWithoutGso)
+{
+    appendFrames(4, FRAME_LENGTH);
+
+    EXPECT_EQ(sendData(), 4 * FRAME_LENGTH);
+    ASSERT_EQ(m_sent.size(), 4u);
+    for (auto &message : m_sent)
+    {
+        EXPECT_EQ(message.length, static_cast<size_t>(FRAME_LENGTH));
+        EXPECT_EQ(message.segment_length, 0u);
+    }
+}
+
+TEST_F(NetworkPublicationTest, shouldConnectOnStatusMessageWhenStrategyHasNoRequiredReceiversCheck)
+{
+    aeron_status_message_header_t sm = {};
+    struct sockaddr_storage addr = {};
+
+    m_flow_control.on_status_message = flow_control_on_sm;
+    m_flow_control.has_required_receivers = nullptr;
+    m_publication.flow_control = &m_flow_control;
+    m_publication.log_meta_data = &m_log_meta_data;
+    m_publication.cached_clock = &m_cached_clock;
+
+    aeron_network_publication_on_status_message(
+        &m_publication, reinterpret_cast<const uint8_t *>(&sm), sizeof(sm), &addr);
+
+    EXPECT_EQ(m_snd_lmt, 2 * TERM_LENGTH);
+    EXPECT_TRUE(m_publication.has_receivers);
+    EXPECT_TRUE(m_publication.is_connected);
+    EXPECT_EQ(m_log_meta_data.is_connected, 1);
+}
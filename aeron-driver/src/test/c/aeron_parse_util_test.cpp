@@ -23,6 +23,7 @@
 extern "C"
 {
 #include "util/aeron_parse_util.h"
+#include "util/aeron_affinity.h"
 }
 
 class ParseUtilTest : public testing::Test
@@ -266,4 +267,30 @@ TEST_F(ParseUtilTest, shouldSplitInterface)
     EXPECT_EQ(std::string(split_interface.port), "1234");
     EXPECT_EQ(std::string(split_interface.prefix), "");
     EXPECT_EQ(split_interface.ip_version_hint, 6);
-}
\ No newline at end of file
+}
+
+TEST_F(ParseUtilTest, shouldParseCpuSetLists)
+{
+    aeron_cpu_set_t cpu_set;
+
+    EXPECT_EQ(aeron_cpu_set_parse("0-3,8", &cpu_set), 0);
+    EXPECT_TRUE(aeron_cpu_set_is_set(&cpu_set, 0));
+    EXPECT_TRUE(aeron_cpu_set_is_set(&cpu_set, 3));
+    EXPECT_FALSE(aeron_cpu_set_is_set(&cpu_set, 4));
+    EXPECT_TRUE(aeron_cpu_set_is_set(&cpu_set, 8));
+
+    EXPECT_EQ(aeron_cpu_set_parse("65", &cpu_set), 0);
+    EXPECT_FALSE(aeron_cpu_set_is_set(&cpu_set, 1));
+    EXPECT_TRUE(aeron_cpu_set_is_set(&cpu_set, 65));
+}
+
+TEST_F(ParseUtilTest, shouldNotParseInvalidCpuSetLists)
+{
+    aeron_cpu_set_t cpu_set;
+
+    EXPECT_EQ(aeron_cpu_set_parse("", &cpu_set), -1);
+    EXPECT_EQ(aeron_cpu_set_parse("a", &cpu_set), -1);
+    EXPECT_EQ(aeron_cpu_set_parse("3-1", &cpu_set), -1);
+    EXPECT_EQ(aeron_cpu_set_parse("0,", &cpu_set), -1);
+    EXPECT_EQ(aeron_cpu_set_parse("100000", &cpu_set), -1);
+}
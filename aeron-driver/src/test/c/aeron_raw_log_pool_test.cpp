@@ -0,0 +1,194 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "aeron_raw_log_pool.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define OTHER_TERM_LENGTH (128 * 1024)
+#define LARGE_TERM_LENGTH (1024 * 1024)
+#define PAGE_SIZE (4 * 1024)
+#define CAPACITY (2)
+
+class RawLogPoolTest : public testing::Test
+{
+public:
+    RawLogPoolTest()
+    {
+        char dir_template[] = "/tmp/aeron_raw_log_pool_test_XXXXXX";
+
+        m_dir = mkdtemp(dir_template);
+        mkdir((m_dir + "/" AERON_RAW_LOG_POOL_DIR).c_str(), S_IRWXU);
+
+        aeron_raw_log_pool_init(&m_pool, m_dir.c_str(), CAPACITY, PAGE_SIZE, aeron_map_raw_log, aeron_map_raw_log_close);
+    }
+
+    ~RawLogPoolTest() override
+    {
+        aeron_raw_log_pool_close(&m_pool);
+        aeron_delete_directory(m_dir.c_str());
+    }
+
+    std::string logPath(int id)
+    {
+        return m_dir + "/" + std::to_string(id) + ".logbuffer";
+    }
+
+    static bool exists(const std::string &path)
+    {
+        return 0 == access(path.c_str(), F_OK);
+    }
+
+    void prefaultAll()
+    {
+        while (aeron_raw_log_pool_do_work(&m_pool) > 0)
+        {
+        }
+    }
+
+protected:
+    std::string m_dir;
+    aeron_raw_log_pool_t m_pool = {};
+};
+
+TEST_F(RawLogPoolTest, shouldPreallocateUpToCapacity)
+{
+    ASSERT_EQ(aeron_raw_log_pool_preallocate(&m_pool, TERM_LENGTH), 0);
+    ASSERT_EQ(aeron_raw_log_pool_preallocate(&m_pool, TERM_LENGTH), 0);
+
+    EXPECT_EQ(aeron_raw_log_pool_available(&m_pool, TERM_LENGTH), static_cast<size_t>(CAPACITY));
+    EXPECT_EQ(aeron_raw_log_pool_available(&m_pool, OTHER_TERM_LENGTH), 0u);
+    EXPECT_EQ(aeron_raw_log_pool_do_work(&m_pool), 0);
+}
+
+TEST_F(RawLogPoolTest, shouldAcquirePooledLogAtPath)
+{
+    aeron_mapped_raw_log_t log = {};
+    const std::string path = logPath(1);
+
+    ASSERT_EQ(aeron_raw_log_pool_preallocate(&m_pool, TERM_LENGTH), 0);
+    ASSERT_EQ(aeron_raw_log_pool_acquire(&m_pool, &log, path.c_str(), true, TERM_LENGTH), 0);
+
+    EXPECT_TRUE(exists(path));
+    EXPECT_EQ(log.term_length, static_cast<size_t>(TERM_LENGTH));
+    EXPECT_EQ(log.term_buffers[1].addr, static_cast<uint8_t *>(log.mapped_file.addr) + TERM_LENGTH);
+    EXPECT_EQ(aeron_raw_log_pool_available(&m_pool, TERM_LENGTH), static_cast<size_t>(CAPACITY - 1));
+
+    EXPECT_EQ(aeron_map_raw_log_close(&log, path.c_str()), 0);
+}
+
+TEST_F(RawLogPoolTest, shouldCreateLogWhenNoneOfTermLengthAvailable)
+{
+    aeron_mapped_raw_log_t log = {};
+    const std::string path = logPath(1);
+
+    ASSERT_EQ(aeron_raw_log_pool_preallocate(&m_pool, TERM_LENGTH), 0);
+    ASSERT_EQ(aeron_raw_log_pool_acquire(&m_pool, &log, path.c_str(), true, OTHER_TERM_LENGTH), 0);
+
+    EXPECT_TRUE(exists(path));
+    EXPECT_EQ(log.term_length, static_cast<size_t>(OTHER_TERM_LENGTH));
+    EXPECT_EQ(aeron_raw_log_pool_available(&m_pool, TERM_LENGTH), static_cast<size_t>(CAPACITY));
+
+    EXPECT_EQ(aeron_map_raw_log_close(&log, path.c_str()), 0);
+}
+
+TEST_F(RawLogPoolTest, shouldReplaceReleasedLogWithNewSpare)
+{
+    aeron_mapped_raw_log_t log = {};
+    const std::string path = logPath(1);
+
+    ASSERT_EQ(aeron_raw_log_pool_acquire(&m_pool, &log, path.c_str(), false, LARGE_TERM_LENGTH), 0);
+    const size_t log_length = log.mapped_file.length;
+
+    ASSERT_EQ(aeron_raw_log_pool_release(&m_pool, &log, path.c_str()), 0);
+    EXPECT_FALSE(exists(path));
+    EXPECT_EQ(log.mapped_file.addr, nullptr);
+    EXPECT_EQ(aeron_raw_log_pool_available(&m_pool, LARGE_TERM_LENGTH), 0u);
+
+    EXPECT_EQ(aeron_raw_log_pool_do_work(&m_pool), 1);
+    EXPECT_EQ(aeron_raw_log_pool_available(&m_pool, LARGE_TERM_LENGTH), 0u) << "pre-faulted in chunks";
+    prefaultAll();
+    EXPECT_EQ(aeron_raw_log_pool_available(&m_pool, LARGE_TERM_LENGTH), 1u);
+
+    const std::string reuse_path = logPath(2);
+    ASSERT_EQ(aeron_raw_log_pool_acquire(&m_pool, &log, reuse_path.c_str(), false, LARGE_TERM_LENGTH), 0);
+    EXPECT_EQ(log.mapped_file.length, log_length);
+    for (size_t i = 0; i < log_length; i++)
+    {
+        ASSERT_EQ(static_cast<uint8_t *>(log.mapped_file.addr)[i], 0u) << "offset " << i;
+    }
+
+    EXPECT_EQ(aeron_map_raw_log_close(&log, reuse_path.c_str()), 0);
+}
+
+TEST_F(RawLogPoolTest, shouldNotExposeNewStreamThroughMappingOfReleasedLog)
+{
+    aeron_mapped_raw_log_t log = {};
+    const std::string path = logPath(1);
+
+    ASSERT_EQ(aeron_raw_log_pool_acquire(&m_pool, &log, path.c_str(), false, TERM_LENGTH), 0);
+    const size_t log_length = log.mapped_file.length;
+    memset(log.mapped_file.addr, 0x11, log_length);
+
+    /* a client that has not noticed the stream went away keeps its own mapping of the log */
+    int fd = open(path.c_str(), O_RDWR);
+    ASSERT_GE(fd, 0);
+    void *client_addr = mmap(nullptr, log_length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(client_addr, MAP_FAILED);
+
+    ASSERT_EQ(aeron_raw_log_pool_release(&m_pool, &log, path.c_str()), 0);
+    prefaultAll();
+
+    const std::string reuse_path = logPath(2);
+    ASSERT_EQ(aeron_raw_log_pool_acquire(&m_pool, &log, reuse_path.c_str(), false, TERM_LENGTH), 0);
+    memset(log.mapped_file.addr, 0x22, log_length);
+    memset(client_addr, 0x33, log_length);
+
+    for (size_t i = 0; i < log_length; i++)
+    {
+        ASSERT_EQ(static_cast<uint8_t *>(client_addr)[i], 0x33u) << "offset " << i;
+        ASSERT_EQ(static_cast<uint8_t *>(log.mapped_file.addr)[i], 0x22u) << "offset " << i;
+    }
+
+    munmap(client_addr, log_length);
+    EXPECT_EQ(aeron_map_raw_log_close(&log, reuse_path.c_str()), 0);
+}
+
+TEST_F(RawLogPoolTest, shouldDeleteReleasedLogWhenPoolIsFull)
+{
+    aeron_mapped_raw_log_t log = {};
+    const std::string path = logPath(1);
+
+    ASSERT_EQ(aeron_raw_log_pool_preallocate(&m_pool, TERM_LENGTH), 0);
+    ASSERT_EQ(aeron_map_raw_log(&log, path.c_str(), true, TERM_LENGTH, PAGE_SIZE), 0);
+
+    ASSERT_EQ(aeron_raw_log_pool_release(&m_pool, &log, path.c_str()), 0);
+    EXPECT_FALSE(exists(path));
+    EXPECT_EQ(aeron_raw_log_pool_available(&m_pool, TERM_LENGTH), static_cast<size_t>(CAPACITY));
+    EXPECT_EQ(aeron_raw_log_pool_do_work(&m_pool), 0);
+}
@@ -15,6 +15,7 @@
  */
 
 #include <array>
+#include <vector>
 #include <functional>
 
 #include <gtest/gtest.h>
@@ -35,13 +36,15 @@ extern "C"
 #define ALIGNED_FRAME_LENGTH (AERON_ALIGN(MESSAGE_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT))
 
 #define LINGER_TIMEOUT_20MS (20 * 1000 * 1000L)
+#define MAX_RESEND (AERON_RETRANSMIT_HANDLER_MAX_RESEND_DEFAULT)
 
 class RetransmitHandlerTest : public testing::Test
 {
 public:
     RetransmitHandlerTest() :
         m_time(0),
-        m_invalid_packet_counter(0)
+        m_invalid_packet_counter(0),
+        m_overflow_counter(0)
     {
     }
 
@@ -60,13 +63,15 @@ public:
 protected:
     int64_t m_time;
     int64_t m_invalid_packet_counter;
+    int64_t m_overflow_counter;
     aeron_retransmit_handler_t m_handler;
     std::function<int(int32_t,int32_t,size_t)> m_resend;
 };
 
 TEST_F(RetransmitHandlerTest, shouldImmediateRetransmitOnNak)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, MAX_RESEND), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -88,7 +93,8 @@ TEST_F(RetransmitHandlerTest, shouldImmediateRetransmitOnNak)
 
 TEST_F(RetransmitHandlerTest, shouldNotRetransmitOnNakWhileInLinger)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, MAX_RESEND), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -116,7 +122,8 @@ TEST_F(RetransmitHandlerTest, shouldNotRetransmitOnNakWhileInLinger)
 
 TEST_F(RetransmitHandlerTest, shouldRetransmitOnNakAfterLinger)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, MAX_RESEND), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -144,7 +151,8 @@ TEST_F(RetransmitHandlerTest, shouldRetransmitOnNakAfterLinger)
 
 TEST_F(RetransmitHandlerTest, shouldRetransmitOnMultipleNaks)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, MAX_RESEND), 0);
 
     const int32_t nak_offset_1 = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length_1 = ALIGNED_FRAME_LENGTH;
@@ -177,3 +185,102 @@ TEST_F(RetransmitHandlerTest, shouldRetransmitOnMultipleNaks)
         &m_handler, TERM_ID, nak_offset_2, nak_length_2, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 2u);
 }
+
+TEST_F(RetransmitHandlerTest, shouldRetransmitEachRangeOfNakList)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, MAX_RESEND), 0);
+
+    const aeron_nak_range_t ranges[] =
+    {
+        { ALIGNED_FRAME_LENGTH * 2, ALIGNED_FRAME_LENGTH },
+        { ALIGNED_FRAME_LENGTH * 5, ALIGNED_FRAME_LENGTH * 2 },
+        { ALIGNED_FRAME_LENGTH * 9, ALIGNED_FRAME_LENGTH }
+    };
+
+    std::vector<int32_t> offsets;
+    std::vector<size_t> lengths;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_id, TERM_ID);
+        offsets.push_back(term_offset);
+        lengths.push_back(length);
+        return 0;
+    };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak_list(
+        &m_handler, TERM_ID, ranges, 3, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+
+    EXPECT_EQ(offsets, std::vector<int32_t>({ ranges[0].term_offset, ranges[1].term_offset, ranges[2].term_offset }));
+    EXPECT_EQ(lengths, std::vector<size_t>(
+        { (size_t)ranges[0].length, (size_t)ranges[1].length, (size_t)ranges[2].length }));
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak_list(
+        &m_handler, TERM_ID, ranges, 3, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(offsets.size(), 3u);
+}
+
+TEST_F(RetransmitHandlerTest, shouldCountInvalidRangeOfNakList)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, MAX_RESEND), 0);
+
+    const aeron_nak_range_t ranges[] =
+    {
+        { ALIGNED_FRAME_LENGTH * 2, 0 },
+        { ALIGNED_FRAME_LENGTH * 5, ALIGNED_FRAME_LENGTH }
+    };
+
+    size_t called = 0;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_offset, ranges[1].term_offset);
+        called++;
+        return 0;
+    };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak_list(
+        &m_handler, TERM_ID, ranges, 2, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 1u);
+    EXPECT_EQ(m_invalid_packet_counter, 1);
+}
+
+TEST_F(RetransmitHandlerTest, shouldCountOverflowWhenActionPoolIsFull)
+{
+    const size_t max_resend = 2;
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, max_resend), 0);
+
+    size_t called = 0;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        called++;
+        return 0;
+    };
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(aeron_retransmit_handler_on_nak(
+            &m_handler, TERM_ID, ALIGNED_FRAME_LENGTH * i, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time,
+            RetransmitHandlerTest::on_resend, this), 0);
+    }
+
+    EXPECT_EQ(called, 2u);
+    EXPECT_EQ(m_overflow_counter, 1);
+
+    m_time = LINGER_TIMEOUT_20MS + 1;
+    EXPECT_EQ(aeron_retransmit_handler_process_timeouts(&m_handler, m_time, RetransmitHandlerTest::on_resend, this), 2);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, ALIGNED_FRAME_LENGTH * 2, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 3u);
+    EXPECT_EQ(m_overflow_counter, 1);
+}
+
+TEST_F(RetransmitHandlerTest, shouldRejectInvalidMaxResend)
+{
+    EXPECT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, 0), -1);
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, &m_overflow_counter, 0, LINGER_TIMEOUT_20MS, MAX_RESEND), 0);
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "protocol/aeron_udp_protocol.h"
+#include "media/aeron_send_channel_endpoint.h"
+}
+
+#define MAX_NAK_LIST_LENGTH \
+    (sizeof(aeron_nak_list_header_t) + ((AERON_NAK_LIST_MAX_RANGES + 1) * sizeof(aeron_nak_range_t)))
+
+class SendChannelEndpointTest : public testing::Test
+{
+public:
+    SendChannelEndpointTest()
+    {
+        m_buffer.fill(0);
+    }
+
+    size_t nakListLength(int32_t range_count)
+    {
+        auto *header = reinterpret_cast<aeron_nak_list_header_t *>(m_buffer.data());
+
+        header->frame_header.type = AERON_HDR_TYPE_NAK_LIST;
+        header->range_count = range_count;
+
+        const size_t ranges_length = range_count > 0 ? (size_t)range_count * sizeof(aeron_nak_range_t) : 0;
+
+        return sizeof(aeron_nak_list_header_t) + ranges_length;
+    }
+
+    bool isValid(size_t length)
+    {
+        return aeron_send_channel_endpoint_is_valid_nak_list(m_buffer.data(), length);
+    }
+
+protected:
+    std::array<uint8_t, MAX_NAK_LIST_LENGTH> m_buffer = {};
+};
+
+TEST_F(SendChannelEndpointTest, shouldAcceptNakListWithAllItsRanges)
+{
+    EXPECT_TRUE(isValid(nakListLength(1)));
+    EXPECT_TRUE(isValid(nakListLength(3)));
+    EXPECT_TRUE(isValid(nakListLength(AERON_NAK_LIST_MAX_RANGES)));
+}
+
+TEST_F(SendChannelEndpointTest, shouldRejectNakListShorterThanHeader)
+{
+    nakListLength(1);
+
+    EXPECT_FALSE(isValid(0));
+    EXPECT_FALSE(isValid(sizeof(aeron_nak_list_header_t) - 1));
+}
+
+TEST_F(SendChannelEndpointTest, shouldRejectNakListTruncatedWithinRanges)
+{
+    const size_t length = nakListLength(3);
+
+    EXPECT_FALSE(isValid(length - 1));
+    EXPECT_FALSE(isValid(length - sizeof(aeron_nak_range_t)));
+    EXPECT_FALSE(isValid(sizeof(aeron_nak_list_header_t)));
+}
+
+TEST_F(SendChannelEndpointTest, shouldRejectNakListWithoutRanges)
+{
+    EXPECT_FALSE(isValid(nakListLength(0)));
+}
+
+TEST_F(SendChannelEndpointTest, shouldRejectNakListWithNegativeRangeCount)
+{
+    nakListLength(-1);
+    EXPECT_FALSE(isValid(m_buffer.size()));
+
+    nakListLength(INT32_MIN);
+    EXPECT_FALSE(isValid(m_buffer.size()));
+}
+
+TEST_F(SendChannelEndpointTest, shouldRejectNakListWithMoreThanMaxRanges)
+{
+    EXPECT_FALSE(isValid(nakListLength(AERON_NAK_LIST_MAX_RANGES + 1)));
+
+    nakListLength(INT32_MAX);
+    EXPECT_FALSE(isValid(m_buffer.size()));
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <string>
+
+extern "C"
+{
+#include "concurrent/aeron_term_scanner.h"
+#include "concurrent/aeron_term_gap_scanner.h"
+}
+
+static const int32_t TERM_LENGTH = 16 * 1024 * 1024;
+static const size_t MTU_LENGTH = 1408;
+static const int32_t MESSAGE_LENGTH = 64;
+static const int ITERATIONS = 20;
+
+static int64_t checksum = 0;
+
+static void fillTerm(std::vector<uint8_t>& term, int32_t length)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH + MESSAGE_LENGTH;
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    for (int32_t offset = 0; offset + aligned_frame_length <= length; offset += aligned_frame_length)
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(term.data() + offset);
+        data_header->frame_header.frame_length = frame_length;
+        data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+    }
+}
+
+static void onGapDetected(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
+{
+    checksum += term_offset + (int64_t)length;
+}
+
+template<typename F>
+static void run(const std::string& name, int64_t bytesPerIteration, F&& scan)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        scan();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double nanos = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << std::left << std::setw(40) << name << std::fixed << std::setprecision(3)
+        << (nanos / ((double)bytesPerIteration * ITERATIONS / 1024.0)) << " ns/KB\n";
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<uint8_t> term(TERM_LENGTH, 0);
+    std::vector<uint8_t> emptyTerm(TERM_LENGTH, 0);
+    fillTerm(term, TERM_LENGTH);
+
+    auto scanForAvailability = [&]()
+    {
+        size_t offset = 0;
+        size_t padding = 0;
+        while (offset < (size_t)TERM_LENGTH)
+        {
+            const size_t available = aeron_term_scanner_scan_for_availability(
+                term.data() + offset, TERM_LENGTH - offset, MTU_LENGTH, &padding);
+            if (0 == available)
+            {
+                break;
+            }
+
+            offset += available + padding;
+        }
+
+        checksum += (int64_t)offset;
+    };
+
+    auto scanCompleteTermForGap = [&]()
+    {
+        checksum += aeron_term_gap_scanner_scan_for_gap(term.data(), 0, 0, TERM_LENGTH, onGapDetected, nullptr);
+    };
+
+    auto scanEmptyTermForGap = [&]()
+    {
+        checksum += aeron_term_gap_scanner_scan_for_gap(emptyTerm.data(), 0, 0, TERM_LENGTH, onGapDetected, nullptr);
+    };
+
+    for (int warmup = 0; warmup < 2; warmup++)
+    {
+        for (bool simd : { false, true })
+        {
+            const std::string mode = aeron_term_scanner_simd_enable(simd) ? " (simd)" : " (scalar)";
+
+            run("scan_for_availability" + mode, TERM_LENGTH, scanForAvailability);
+            run("scan_for_gap over frames" + mode, TERM_LENGTH, scanCompleteTermForGap);
+            run("scan_for_gap over gap" + mode, TERM_LENGTH, scanEmptyTermForGap);
+        }
+
+        std::cout << "\n";
+    }
+
+    std::cout << "checksum: " << checksum << "\n";
+
+    return 0;
+}
@@ -189,3 +189,77 @@ TEST_F(TermScannerTest, shouldScanLastMessageInBufferMinusPaddingLimitedByMtu)
         m_ptr, CAPACITY - offset, mtu, &m_padding), (size_t)aligned_frame_length);
     EXPECT_EQ(m_padding, 0u);
 }
+
+static void fillFrames(uint8_t *ptr, int32_t frame_length, int count)
+{
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    for (int i = 0; i < count; i++)
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(ptr + (i * aligned_frame_length));
+        data_header->frame_header.frame_length = frame_length;
+        data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+    }
+}
+
+TEST_F(TermScannerTest, shouldScanRunOfSmallMessagesUpToMtuWithAndWithoutSimd)
+{
+    int32_t frame_length = AERON_DATA_HEADER_LENGTH + 64;
+    size_t aligned_frame_length = (size_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    fillFrames(m_ptr, frame_length, 100);
+
+    for (bool simd : { false, true })
+    {
+        aeron_term_scanner_simd_enable(simd);
+        EXPECT_EQ(aeron_term_scanner_scan_for_availability(
+            m_ptr, CAPACITY, MTU_LENGTH, &m_padding), (MTU_LENGTH / aligned_frame_length) * aligned_frame_length);
+        EXPECT_EQ(m_padding, 0u);
+    }
+
+    aeron_term_scanner_simd_enable(true);
+}
+
+TEST_F(TermScannerTest, shouldStopRunOfSmallMessagesAtPaddingWithAndWithoutSimd)
+{
+    int32_t frame_length = AERON_DATA_HEADER_LENGTH + 64;
+    size_t aligned_frame_length = (size_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    int32_t padding_frame_length = 1024;
+
+    fillFrames(m_ptr, frame_length, 100);
+
+    aeron_data_header_t *data_header = (aeron_data_header_t *)(m_ptr + (6 * aligned_frame_length));
+    data_header->frame_header.frame_length = padding_frame_length;
+    data_header->frame_header.type = AERON_HDR_TYPE_PAD;
+
+    for (bool simd : { false, true })
+    {
+        aeron_term_scanner_simd_enable(simd);
+        EXPECT_EQ(aeron_term_scanner_scan_for_availability(
+            m_ptr, CAPACITY, MTU_LENGTH, &m_padding), (6 * aligned_frame_length) + AERON_DATA_HEADER_LENGTH);
+        EXPECT_EQ(m_padding, (size_t)(padding_frame_length - AERON_DATA_HEADER_LENGTH));
+    }
+
+    aeron_term_scanner_simd_enable(true);
+}
+
+TEST_F(TermScannerTest, shouldScanPastChangeOfMessageLengthWithAndWithoutSimd)
+{
+    int32_t frame_length = AERON_DATA_HEADER_LENGTH + 64;
+    size_t aligned_frame_length = (size_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    int32_t other_frame_length = AERON_DATA_HEADER_LENGTH + 8;
+    size_t other_aligned_frame_length = (size_t)AERON_ALIGN(other_frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    fillFrames(m_ptr, frame_length, 5);
+    fillFrames(m_ptr + (5 * aligned_frame_length), other_frame_length, 2);
+
+    for (bool simd : { false, true })
+    {
+        aeron_term_scanner_simd_enable(simd);
+        EXPECT_EQ(aeron_term_scanner_scan_for_availability(
+            m_ptr, CAPACITY, MTU_LENGTH, &m_padding), (5 * aligned_frame_length) + (2 * other_aligned_frame_length));
+        EXPECT_EQ(m_padding, 0u);
+    }
+
+    aeron_term_scanner_simd_enable(true);
+}
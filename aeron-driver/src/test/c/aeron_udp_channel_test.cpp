@@ -284,3 +284,15 @@ TEST_F(UdpChannelTest, shouldCanonicalizeForIpv6Multicast)
     ASSERT_EQ(parse_udp_channel("aeron:udp?interface=[::1]:54321/64|endpoint=[FF01::FD]:40456"), 0) << aeron_errmsg();
     EXPECT_STREQ(m_channel->canonical_form, "UDP-00000000000000000000000000000001-54321-ff0100000000000000000000000000fd-40456");
 }
+
+TEST_F(UdpChannelTest, shouldParseGroupTag)
+{
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=224.0.1.1:40456"), 0) << aeron_errmsg();
+    EXPECT_FALSE(m_channel->has_group_tag);
+
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=224.0.1.1:40456|gtag=-101"), 0) << aeron_errmsg();
+    EXPECT_TRUE(m_channel->has_group_tag);
+    EXPECT_EQ(m_channel->group_tag, -101);
+
+    EXPECT_EQ(parse_udp_channel("aeron:udp?endpoint=224.0.1.1:40456|gtag=abc"), -1);
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "aeron_gtest_compat.h"
+
+extern "C"
+{
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <arpa/inet.h>
+#include "media/aeron_udp_channel_transport.h"
+}
+
+#if !defined(UDP_GRO)
+#define UDP_GRO (104)
+#endif
+
+#define SEGMENT_LENGTH (1024)
+#define NUM_SEGMENTS (4)
+#define BUFFER_LENGTH (NUM_SEGMENTS * SEGMENT_LENGTH)
+
+class UdpChannelTransportTest : public testing::Test
+{
+public:
+    UdpChannelTransportTest()
+    {
+        m_segments.clear();
+        m_buffer.fill(0);
+
+        m_iov.iov_base = m_buffer.data();
+        m_iov.iov_len = m_buffer.size();
+        m_msg.msg_hdr.msg_name = &m_addr;
+        m_msg.msg_hdr.msg_namelen = sizeof(m_addr);
+        m_msg.msg_hdr.msg_iov = &m_iov;
+        m_msg.msg_hdr.msg_iovlen = 1;
+        m_msg.msg_hdr.msg_control = m_control;
+        m_msg.msg_hdr.msg_controllen = sizeof(m_control);
+    }
+
+    ~UdpChannelTransportTest() override
+    {
+        if (m_transports_open)
+        {
+            aeron_udp_channel_transport_close(&m_send_transport);
+            aeron_udp_channel_transport_close(&m_recv_transport);
+        }
+    }
+
+    static void on_segment(
+        void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    {
+        m_segments.push_back(length);
+    }
+
+    void addGroControlMessage(int gso_size)
+    {
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&m_msg.msg_hdr);
+
+        cmsg->cmsg_level = IPPROTO_UDP;
+        cmsg->cmsg_type = UDP_GRO;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(gso_size));
+        memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+        m_msg.msg_hdr.msg_controllen = CMSG_SPACE(sizeof(gso_size));
+    }
+
+    void openLoopbackTransports()
+    {
+        struct sockaddr_storage bind_addr = {};
+        auto *in4 = reinterpret_cast<struct sockaddr_in *>(&bind_addr);
+        socklen_t addr_len = sizeof(m_recv_addr);
+
+        in4->sin_family = AF_INET;
+        in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        ASSERT_EQ(aeron_udp_channel_transport_init(&m_recv_transport, &bind_addr, nullptr, 0, 0, 0, 0), 0);
+        ASSERT_EQ(aeron_udp_channel_transport_init(&m_send_transport, &bind_addr, nullptr, 0, 0, 0, 0), 0);
+        m_transports_open = true;
+
+        ASSERT_EQ(getsockname(
+            m_recv_transport.fd, reinterpret_cast<struct sockaddr *>(&m_recv_addr), &addr_len), 0);
+    }
+
+protected:
+    static std::vector<size_t> m_segments;
+
+    std::array<uint8_t, BUFFER_LENGTH> m_buffer = {};
+    uint64_t m_control[AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH / sizeof(uint64_t)] = {};
+    struct iovec m_iov = {};
+    struct sockaddr_storage m_addr = {};
+    struct mmsghdr m_msg = {};
+
+    bool m_transports_open = false;
+    struct sockaddr_storage m_recv_addr = {};
+    aeron_udp_channel_transport_t m_send_transport = {};
+    aeron_udp_channel_transport_t m_recv_transport = {};
+};
+
+std::vector<size_t> UdpChannelTransportTest::m_segments;
+
+TEST_F(UdpChannelTransportTest, shouldReportSegmentLengthFromGroControlMessage)
+{
+    m_recv_transport.gro_enabled = true;
+    addGroControlMessage(SEGMENT_LENGTH);
+
+    EXPECT_EQ(aeron_udp_channel_transport_segment_length(
+        &m_recv_transport, &m_msg.msg_hdr, BUFFER_LENGTH), static_cast<size_t>(SEGMENT_LENGTH));
+}
+
+TEST_F(UdpChannelTransportTest, shouldIgnoreGroControlMessageWhenGroNotEnabled)
+{
+    addGroControlMessage(SEGMENT_LENGTH);
+
+    EXPECT_EQ(aeron_udp_channel_transport_segment_length(
+        &m_recv_transport, &m_msg.msg_hdr, BUFFER_LENGTH), static_cast<size_t>(BUFFER_LENGTH));
+}
+
+TEST_F(UdpChannelTransportTest, shouldUseDatagramLengthWithoutGroControlMessage)
+{
+    m_recv_transport.gro_enabled = true;
+    m_msg.msg_hdr.msg_controllen = 0;
+
+    EXPECT_EQ(aeron_udp_channel_transport_segment_length(
+        &m_recv_transport, &m_msg.msg_hdr, BUFFER_LENGTH), static_cast<size_t>(BUFFER_LENGTH));
+}
+
+TEST_F(UdpChannelTransportTest, shouldDispatchEachSegmentWithShortLastSegment)
+{
+    const size_t length = (NUM_SEGMENTS - 1) * SEGMENT_LENGTH + 96;
+
+    aeron_udp_channel_transport_dispatch_segments(
+        &m_recv_transport, m_buffer.data(), length, SEGMENT_LENGTH, &m_addr, on_segment, nullptr);
+
+    ASSERT_EQ(m_segments.size(), static_cast<size_t>(NUM_SEGMENTS));
+    for (size_t i = 0; i < NUM_SEGMENTS - 1; i++)
+    {
+        EXPECT_EQ(m_segments[i], static_cast<size_t>(SEGMENT_LENGTH));
+    }
+    EXPECT_EQ(m_segments[NUM_SEGMENTS - 1], 96u);
+}
+
+TEST_F(UdpChannelTransportTest, shouldReceiveGsoSendAsOriginalSegments)
+{
+    openLoopbackTransports();
+
+    if (!aeron_udp_channel_transport_try_enable_gso(&m_send_transport) ||
+        !aeron_udp_channel_transport_try_enable_gro(&m_recv_transport))
+    {
+        GTEST_SKIP() << "UDP GSO/GRO not supported";
+    }
+
+    const size_t length = (NUM_SEGMENTS - 1) * SEGMENT_LENGTH + 96;
+    std::array<uint8_t, BUFFER_LENGTH> send_buffer = {};
+    uint64_t send_control[AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH / sizeof(uint64_t)] = {};
+    struct iovec send_iov = { send_buffer.data(), length };
+    struct mmsghdr send_msg = {};
+
+    send_msg.msg_hdr.msg_name = &m_recv_addr;
+    send_msg.msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+    send_msg.msg_hdr.msg_iov = &send_iov;
+    send_msg.msg_hdr.msg_iovlen = 1;
+    aeron_udp_channel_transport_set_gso_segment_length(
+        &send_msg.msg_hdr, reinterpret_cast<uint8_t *>(send_control), SEGMENT_LENGTH);
+
+    ASSERT_EQ(aeron_udp_channel_transport_sendmmsg(&m_send_transport, &send_msg, 1), 1);
+
+    /* the kernel may deliver one coalesced datagram or the individual segments, either way dispatch is per segment */
+    int64_t bytes_received = 0;
+    for (int i = 0; i < 1000 && m_segments.size() < NUM_SEGMENTS; i++)
+    {
+        ASSERT_GE(aeron_udp_channel_transport_recvmmsg(
+            &m_recv_transport, &m_msg, 1, &bytes_received, on_segment, nullptr), 0);
+    }
+
+    ASSERT_EQ(m_segments.size(), static_cast<size_t>(NUM_SEGMENTS));
+    for (size_t i = 0; i < NUM_SEGMENTS - 1; i++)
+    {
+        EXPECT_EQ(m_segments[i], static_cast<size_t>(SEGMENT_LENGTH));
+    }
+    EXPECT_EQ(m_segments[NUM_SEGMENTS - 1], 96u);
+    EXPECT_EQ(bytes_received, static_cast<int64_t>(length));
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "protocol/aeron_udp_protocol.h"
+#include "media/aeron_udp_destination_tracker.h"
+}
+
+#define NUM_DESTINATIONS (3)
+#define NUM_FRAMES (4)
+#define TIMEOUT_NS (AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS)
+
+static int64_t now_ns = 0;
+
+class UdpDestinationTrackerTest : public testing::Test
+{
+public:
+    UdpDestinationTrackerTest()
+    {
+        now_ns = 0;
+        m_calls.clear();
+        m_sent.clear();
+        m_send_limit = SIZE_MAX;
+        m_fail_port = 0;
+        m_bindings = aeron_udp_channel_transport_bindings_default;
+        m_bindings.sendmmsg_func = capture_sendmmsg;
+        aeron_udp_destination_tracker_init(&m_tracker, &m_bindings, &m_cached_clock, TIMEOUT_NS);
+
+        for (size_t i = 0; i < NUM_FRAMES; i++)
+        {
+            m_iov[i].iov_base = &m_frames[i];
+            m_iov[i].iov_len = sizeof(m_frames[i]);
+            m_msgvec[i].msg_hdr = {};
+            m_msgvec[i].msg_hdr.msg_iov = &m_iov[i];
+            m_msgvec[i].msg_hdr.msg_iovlen = 1;
+            m_msgvec[i].msg_len = 0;
+            m_frames[i] = i;
+        }
+    }
+
+    ~UdpDestinationTrackerTest() override
+    {
+        aeron_udp_destination_tracker_close(&m_tracker);
+    }
+
+    static int capture_sendmmsg(aeron_udp_channel_transport_t *transport, struct mmsghdr *msgvec, size_t vlen)
+    {
+        const size_t limit = vlen < m_send_limit ? vlen : m_send_limit;
+
+        m_calls.push_back(vlen);
+        for (size_t i = 0; i < limit; i++)
+        {
+            auto *addr = reinterpret_cast<struct sockaddr_in *>(msgvec[i].msg_hdr.msg_name);
+            uint64_t frame = *reinterpret_cast<uint64_t *>(msgvec[i].msg_hdr.msg_iov[0].iov_base);
+
+            if (ntohs(addr->sin_port) == m_fail_port)
+            {
+                return 0 == i ? -1 : static_cast<int>(i);
+            }
+
+            m_sent.emplace_back(ntohs(addr->sin_port), frame);
+            msgvec[i].msg_len = static_cast<unsigned int>(msgvec[i].msg_hdr.msg_iov[0].iov_len);
+        }
+
+        return static_cast<int>(limit);
+    }
+
+    void onStatusMessage(int64_t receiver_id, uint16_t port)
+    {
+        aeron_status_message_header_t sm = {};
+        struct sockaddr_storage addr = {};
+        auto *in4 = reinterpret_cast<struct sockaddr_in *>(&addr);
+
+        in4->sin_family = AF_INET;
+        in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        in4->sin_port = htons(port);
+        sm.receiver_id = receiver_id;
+
+        aeron_clock_update_cached_nano_time(&m_cached_clock, now_ns);
+        ASSERT_EQ(aeron_udp_destination_tracker_on_status_message(
+            &m_tracker, reinterpret_cast<const uint8_t *>(&sm), sizeof(sm), &addr), 0);
+    }
+
+    void addDestinations()
+    {
+        for (int i = 0; i < NUM_DESTINATIONS; i++)
+        {
+            onStatusMessage(i + 1, static_cast<uint16_t>(40001 + i));
+        }
+    }
+
+protected:
+    static std::vector<size_t> m_calls;
+    static std::vector<std::pair<uint16_t, uint64_t>> m_sent;
+    static size_t m_send_limit;
+    static uint16_t m_fail_port;
+
+    aeron_udp_channel_transport_bindings_t m_bindings = {};
+    aeron_clock_cache_t m_cached_clock = {};
+    aeron_udp_destination_tracker_t m_tracker = {};
+    aeron_udp_channel_transport_t m_transport = {};
+    std::array<uint64_t, NUM_FRAMES> m_frames = {};
+    std::array<struct iovec, NUM_FRAMES> m_iov = {};
+    struct mmsghdr m_msgvec[NUM_FRAMES] = {};
+};
+
+std::vector<size_t> UdpDestinationTrackerTest::m_calls;
+std::vector<std::pair<uint16_t, uint64_t>> UdpDestinationTrackerTest::m_sent;
+size_t UdpDestinationTrackerTest::m_send_limit;
+uint16_t UdpDestinationTrackerTest::m_fail_port;
+
+TEST_F(UdpDestinationTrackerTest, shouldSendBatchToAllDestinationsInOneCall)
+{
+    addDestinations();
+
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_msgvec, NUM_FRAMES), NUM_FRAMES);
+    ASSERT_EQ(m_calls.size(), 1u);
+    EXPECT_EQ(m_calls[0], static_cast<size_t>(NUM_DESTINATIONS * NUM_FRAMES));
+
+    ASSERT_EQ(m_sent.size(), static_cast<size_t>(NUM_DESTINATIONS * NUM_FRAMES));
+    for (size_t frame = 0, k = 0; frame < NUM_FRAMES; frame++)
+    {
+        for (uint16_t port = 40001; port < 40001 + NUM_DESTINATIONS; port++, k++)
+        {
+            EXPECT_EQ(m_sent[k].second, frame);
+            EXPECT_EQ(m_sent[k].first, port);
+        }
+
+        EXPECT_EQ(m_msgvec[frame].msg_len, sizeof(uint64_t));
+    }
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldReportFramesSentToEveryDestinationOnPartialSend)
+{
+    addDestinations();
+    m_send_limit = NUM_DESTINATIONS + 1;
+
+    /* each short send loses one message and sending resumes after it, so frames 1 and 3 miss a destination */
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_msgvec, NUM_FRAMES), 2);
+    EXPECT_EQ(m_sent.size(), static_cast<size_t>(NUM_DESTINATIONS * NUM_FRAMES - 2));
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldKeepSendingToLaterDestinationsWhenOneFails)
+{
+    addDestinations();
+    m_fail_port = 40002;
+
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_msgvec, NUM_FRAMES), 0);
+
+    ASSERT_EQ(m_sent.size(), static_cast<size_t>((NUM_DESTINATIONS - 1) * NUM_FRAMES));
+    for (size_t frame = 0, k = 0; frame < NUM_FRAMES; frame++)
+    {
+        EXPECT_EQ(m_sent[k].first, 40001);
+        EXPECT_EQ(m_sent[k++].second, frame);
+        EXPECT_EQ(m_sent[k].first, 40003);
+        EXPECT_EQ(m_sent[k++].second, frame);
+        EXPECT_EQ(m_msgvec[frame].msg_len, sizeof(uint64_t));
+    }
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldKeepSendingToLaterDestinationsWhenFirstFails)
+{
+    addDestinations();
+    m_fail_port = 40001;
+
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmsg(&m_tracker, &m_transport, &m_msgvec[0].msg_hdr), 0);
+
+    ASSERT_EQ(m_sent.size(), static_cast<size_t>(NUM_DESTINATIONS - 1));
+    EXPECT_EQ(m_sent[0].first, 40002);
+    EXPECT_EQ(m_sent[1].first, 40003);
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldSendSingleMessageToAllDestinationsInOneCall)
+{
+    addDestinations();
+
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmsg(
+        &m_tracker, &m_transport, &m_msgvec[0].msg_hdr), static_cast<int>(sizeof(uint64_t)));
+    ASSERT_EQ(m_calls.size(), 1u);
+    EXPECT_EQ(m_calls[0], static_cast<size_t>(NUM_DESTINATIONS));
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldOnlyExpireDestinationsWhenChecked)
+{
+    addDestinations();
+
+    now_ns += TIMEOUT_NS / 2;
+    onStatusMessage(1, 40001);
+
+    now_ns += (TIMEOUT_NS / 2) + 1;
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_msgvec, NUM_FRAMES), NUM_FRAMES);
+    EXPECT_EQ(m_tracker.destinations.length, static_cast<size_t>(NUM_DESTINATIONS));
+
+    EXPECT_EQ(aeron_udp_destination_tracker_check_for_expiry(&m_tracker, now_ns), NUM_DESTINATIONS - 1);
+    ASSERT_EQ(m_tracker.destinations.length, 1u);
+    EXPECT_EQ(m_tracker.destinations.array[0].receiver_id, 1);
+}
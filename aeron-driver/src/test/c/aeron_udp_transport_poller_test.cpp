@@ -0,0 +1,208 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "aeron_gtest_compat.h"
+
+extern "C"
+{
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include "util/aeron_error.h"
+#include "aeron_driver_context.h"
+#include "media/aeron_udp_transport_poller.h"
+}
+
+#define NUM_TRANSPORTS (AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD + 2)
+#define VECTOR_CAPACITY (4)
+#define BUFFER_LENGTH (1024)
+
+class UdpTransportPollerTest : public testing::Test
+{
+public:
+    UdpTransportPollerTest()
+    {
+        EXPECT_EQ(aeron_driver_context_init(&m_context), 0);
+        EXPECT_EQ(aeron_udp_transport_poller_init(&m_poller, m_context, BUFFER_LENGTH), 0);
+
+        for (size_t i = 0; i < VECTOR_CAPACITY; i++)
+        {
+            m_iov[i].iov_base = m_buffers[i].data();
+            m_iov[i].iov_len = BUFFER_LENGTH;
+            m_msgvec[i].msg_hdr.msg_name = &m_addrs[i];
+            m_msgvec[i].msg_hdr.msg_namelen = sizeof(m_addrs[i]);
+            m_msgvec[i].msg_hdr.msg_iov = &m_iov[i];
+            m_msgvec[i].msg_hdr.msg_iovlen = 1;
+            m_msgvec[i].msg_hdr.msg_control = nullptr;
+            m_msgvec[i].msg_hdr.msg_controllen = 0;
+            m_msgvec[i].msg_hdr.msg_flags = 0;
+            m_msgvec[i].msg_len = 0;
+        }
+
+        m_send_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    }
+
+    ~UdpTransportPollerTest() override
+    {
+        for (size_t i = 0; i < m_num_transports; i++)
+        {
+            aeron_udp_transport_poller_remove(&m_poller, &m_transports[i]);
+            aeron_udp_channel_transport_close(&m_transports[i]);
+        }
+
+        aeron_udp_transport_poller_close(&m_poller);
+        aeron_driver_context_close(m_context);
+        close(m_send_fd);
+    }
+
+    static void on_datagram(
+        void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    {
+        auto *test = static_cast<UdpTransportPollerTest *>(clientd);
+        size_t index = reinterpret_cast<size_t>(transport_clientd);
+
+        ASSERT_EQ(length, sizeof(index));
+        ASSERT_EQ(0, std::memcmp(buffer, &index, sizeof(index)));
+        test->m_received[index]++;
+    }
+
+    void addTransports()
+    {
+        for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+        {
+            struct sockaddr_storage bind_addr = {};
+            auto *in4 = reinterpret_cast<struct sockaddr_in *>(&bind_addr);
+            socklen_t addr_len = sizeof(struct sockaddr_in);
+
+            in4->sin_family = AF_INET;
+            in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            in4->sin_port = 0;
+
+            ASSERT_EQ(aeron_udp_channel_transport_init(
+                &m_transports[i], &bind_addr, &bind_addr, 0, 0, 0, 0), 0);
+            m_num_transports++;
+
+            m_transports[i].dispatch_clientd = reinterpret_cast<void *>(i);
+            ASSERT_EQ(getsockname(
+                m_transports[i].fd, reinterpret_cast<struct sockaddr *>(&m_endpoints[i]), &addr_len), 0);
+            ASSERT_EQ(aeron_udp_transport_poller_add(&m_poller, &m_transports[i]), 0);
+        }
+    }
+
+    void sendTo(size_t index)
+    {
+        ASSERT_EQ(sendto(
+            m_send_fd,
+            &index,
+            sizeof(index),
+            0,
+            reinterpret_cast<struct sockaddr *>(&m_endpoints[index]),
+            sizeof(struct sockaddr_in)), static_cast<ssize_t>(sizeof(index)));
+    }
+
+    int pollUntil(int expected)
+    {
+        int received = 0;
+
+        for (int i = 0; i < 1000 && received < expected; i++)
+        {
+            int64_t bytes_received = 0;
+            int result = aeron_udp_transport_poller_poll(
+                &m_poller, m_msgvec, VECTOR_CAPACITY, &bytes_received, on_datagram, this);
+            if (result < 0)
+            {
+                return result;
+            }
+
+            received += result;
+            if (0 == result)
+            {
+                usleep(1000);
+            }
+        }
+
+        return received;
+    }
+
+protected:
+    aeron_driver_context_t *m_context = nullptr;
+    aeron_udp_transport_poller_t m_poller = {};
+    std::array<aeron_udp_channel_transport_t, NUM_TRANSPORTS> m_transports = {};
+    std::array<struct sockaddr_storage, NUM_TRANSPORTS> m_endpoints = {};
+    std::array<int, NUM_TRANSPORTS> m_received = {};
+    std::array<std::array<uint8_t, BUFFER_LENGTH>, VECTOR_CAPACITY> m_buffers = {};
+    std::array<struct iovec, VECTOR_CAPACITY> m_iov = {};
+    std::array<struct sockaddr_storage, VECTOR_CAPACITY> m_addrs = {};
+    struct mmsghdr m_msgvec[VECTOR_CAPACITY] = {};
+    size_t m_num_transports = 0;
+    int m_send_fd = -1;
+};
+
+TEST_F(UdpTransportPollerTest, shouldDispatchDatagramsFromEveryTransport)
+{
+    addTransports();
+
+    for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+    {
+        sendTo(i);
+        sendTo(i);
+    }
+
+    EXPECT_EQ(pollUntil(NUM_TRANSPORTS * 2), NUM_TRANSPORTS * 2);
+    for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+    {
+        EXPECT_EQ(m_received[i], 2) << "transport " << i;
+    }
+}
+
+TEST_F(UdpTransportPollerTest, shouldDispatchDatagramsFromEveryTransportThroughIoUring)
+{
+    if (aeron_udp_transport_poller_enable_io_uring(&m_poller, 16, BUFFER_LENGTH) < 0)
+    {
+        GTEST_SKIP() << "io_uring not available: " << aeron_errmsg();
+    }
+
+    addTransports();
+
+    /* more datagrams than provided buffers exercises rearming after the kernel runs out */
+    for (int round = 0; round < 4; round++)
+    {
+        for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+        {
+            sendTo(i);
+        }
+
+        EXPECT_EQ(pollUntil(NUM_TRANSPORTS), NUM_TRANSPORTS);
+    }
+
+    for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+    {
+        EXPECT_EQ(m_received[i], 4) << "transport " << i;
+    }
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&m_poller, &m_transports[0]), 0);
+    sendTo(0);
+    sendTo(1);
+
+    EXPECT_EQ(pollUntil(2), 1);
+    EXPECT_EQ(m_received[0], 4);
+    EXPECT_EQ(m_received[1], 5);
+}
@@ -146,6 +146,32 @@ TEST_F(UriTest, shouldParsePublicationParamLingerTimeout)
     EXPECT_EQ(params.linger_timeout_ns, 7777u);
 }
 
+TEST_F(UriTest, shouldParsePublicationParamMaxMessagesPerSend)
+{
+    aeron_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|max-msgs-per-send=32", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_EQ(params.max_messages_per_send, 32u);
+}
+
+TEST_F(UriTest, shouldParsePublicationParamMaxMessagesPerSendDefault)
+{
+    aeron_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_EQ(params.max_messages_per_send, m_context->network_publication_max_messages_per_send);
+}
+
+TEST_F(UriTest, shouldErrorParsingTooLargeMaxMessagesPerSend)
+{
+    aeron_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|max-msgs-per-send=65", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+}
+
 TEST_F(UriTest, shouldParsePublicationParamUdpTermLength)
 {
     aeron_uri_publication_params_t params;
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2014-2019 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <string>
+
+#include "FragmentAssembler.h"
+
+using namespace std;
+using namespace aeron;
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::logbuffer;
+
+static const int32_t TERM_LENGTH = LogBufferDescriptor::TERM_MIN_LENGTH;
+static const int32_t INITIAL_TERM_ID = 7;
+static const util::index_t MESSAGE_LENGTH = 32;
+static const int ITERATIONS = 20000;
+
+static int64_t totalBytes = 0;
+
+static int fillTerm(AtomicBuffer& termBuffer)
+{
+    const util::index_t frameLength = DataFrameHeader::LENGTH + MESSAGE_LENGTH;
+    const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+    int frames = 0;
+
+    for (util::index_t offset = 0; offset + alignedLength <= termBuffer.capacity(); offset += alignedLength)
+    {
+        DataFrameHeader::DataFrameHeaderDefn& frame =
+            termBuffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(offset);
+
+        frame.frameLength = frameLength;
+        frame.version = DataFrameHeader::CURRENT_VERSION;
+        frame.flags = FrameDescriptor::UNFRAGMENTED;
+        frame.type = DataFrameHeader::HDR_TYPE_DATA;
+        frame.termOffset = offset;
+        frame.sessionId = 1;
+        frame.streamId = 1;
+        frame.termId = INITIAL_TERM_ID;
+        frames++;
+    }
+
+    return frames;
+}
+
+template <typename F>
+static void run(const string& name, AtomicBuffer& termBuffer, int framesPerTerm, F&& handler)
+{
+    Header header(INITIAL_TERM_ID, TERM_LENGTH, nullptr);
+    exception_handler_t exceptionHandler = [](const std::exception& ex) { cerr << ex.what() << endl; };
+    TermReader::ReadOutcome outcome = {};
+    int64_t fragments = 0;
+
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        TermReader::read(outcome, termBuffer, 0, handler, framesPerTerm, header, exceptionHandler);
+        fragments += outcome.fragmentsRead;
+    }
+    const auto end = chrono::steady_clock::now();
+
+    const double nanos = chrono::duration<double, std::nano>(end - start).count();
+    cout << left << setw(40) << name << fixed << setprecision(2) << (nanos / fragments) << " ns/fragment\n";
+}
+
+int main(int argc, char** argv)
+{
+    vector<uint8_t> term(TERM_LENGTH, 0);
+    AtomicBuffer termBuffer(term.data(), TERM_LENGTH);
+    const int framesPerTerm = fillTerm(termBuffer);
+
+    auto onMessage = [](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        totalBytes += length;
+    };
+
+    FragmentAssembler fragmentAssembler(onMessage);
+    auto inlinedFragmentAssembler = makeFragmentAssembler(onMessage);
+
+    for (int warmup = 0; warmup < 2; warmup++)
+    {
+        run("direct handler", termBuffer, framesPerTerm, onMessage);
+        run("FragmentAssembler::handler()", termBuffer, framesPerTerm, fragmentAssembler.handler());
+        run("makeFragmentAssembler", termBuffer, framesPerTerm, inlinedFragmentAssembler);
+        cout << "\n";
+    }
+
+    cout << "bytes: " << totalBytes << "\n";
+
+    return 0;
+}